@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/batch.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long rowCount = 4096;
+    const long iterations = 100;
+    // One value per second, as in a log, and one value per day, so that no two rows share a day.
+    for (const long long step : { 1000000007LL, 86399999999937LL }) {
+        std::vector<std::int64_t> nanoseconds;
+        for (long i = 0; i < rowCount; ++i)
+            nanoseconds.push_back(1700000000123456789LL + i * step);
+        const Format format("yyyy-MM-dd hh:mm:ss.fff");
+        const BatchFormatter formatter(format);
+        std::string data;
+        std::vector<std::int32_t> offsets(nanoseconds.size() + 1);
+
+        std::printf("step of %lld ns (per row)\n", step);
+        benchmark::measure("  DateTime::toString(Format)", iterations, [&](long) {
+            std::vector<std::string> column;
+            column.reserve(nanoseconds.size());
+            for (const auto& value : nanoseconds)
+                column.push_back(DateTime(std::chrono::nanoseconds(value)).toString(format));
+            benchmark::doNotOptimize(column);
+        }, rowCount);
+        benchmark::measure("  BatchFormatter::format", iterations, [&](long) {
+            data.clear();
+            benchmark::doNotOptimize(formatter.format(nanoseconds.data(), nanoseconds.size(), data, offsets.data()));
+        }, rowCount);
+    }
+    return 0;
+}
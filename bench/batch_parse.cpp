@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/batch.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long rowCount = 4096;
+    const long iterations = 100;
+    for (const auto& pattern : { "yyyy-MM-dd hh:mm:ss.fff", "dd/MM/yyyy hh:mm:ss.fff" }) {
+        const Format format(pattern);
+        std::vector<std::string> column;
+        std::string data;
+        std::vector<std::int64_t> offsets(1, 0);
+        for (long i = 0; i < rowCount; ++i) {
+            column.push_back(DateTime(std::chrono::nanoseconds(1700000000123456789LL + i * 86399999999937LL)).toString(format));
+            data += column.back();
+            offsets.push_back(static_cast<std::int64_t>(data.size()));
+        }
+        std::vector<std::int64_t> nanoseconds(column.size());
+        std::vector<std::uint8_t> validity((column.size() + 7) / 8);
+        const BatchParser parser(format);
+
+        std::printf("%s (per row)\n", pattern);
+        benchmark::measure("  DateTime::fromString(Format)", iterations, [&](long) {
+            for (long i = 0; i < rowCount; ++i)
+                nanoseconds[i] = DateTime::fromString(column[i], format).toNanosecondsSinceEpoch();
+            benchmark::doNotOptimize(nanoseconds);
+        }, rowCount);
+        benchmark::measure("  BatchParser::parse(strings)", iterations, [&](long) {
+            benchmark::doNotOptimize(parser.parse(column.data(), column.size(), nanoseconds.data(), validity.data()));
+        }, rowCount);
+        benchmark::measure("  BatchParser::parse(buffer, offsets)", iterations, [&](long) {
+            benchmark::doNotOptimize(parser.parse(data.data(), offsets.data(), column.size(), nanoseconds.data(), validity.data()));
+        }, rowCount);
+    }
+    return 0;
+}
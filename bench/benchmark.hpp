@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_BENCHMARK_HPP
+#define XCLOX_BENCHMARK_HPP
+
+#include <chrono>
+#include <cstdio>
+
+namespace benchmark {
+
+/// Prevents the compiler from optimizing away the computation of \p value.
+template <typename T>
+inline void doNotOptimize(const T& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+/// Runs \p function \p iterations times, and prints the average time in nanoseconds of one of the \p itemsPerIteration items processed by each iteration.
+template <typename Function>
+inline double measure(const char* name, long iterations, const Function& function, long itemsPerIteration = 1)
+{
+    // Warm up caches and branch predictors.
+    for (long i = 0; i < iterations / 10; ++i)
+        function(i);
+    const auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < iterations; ++i)
+        function(i);
+    const auto elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+    const double perItem = elapsed / static_cast<double>(iterations) / static_cast<double>(itemsPerIteration);
+    std::printf("%-48s %10.2f ns/op\n", name, perItem);
+    return perItem;
+}
+
+} // namespace benchmark
+
+#endif // XCLOX_BENCHMARK_HPP
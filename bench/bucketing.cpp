@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/batch.hpp"
+#include "xclox/compact.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace xclox;
+
+// Prints the time to bucket the values by rounding every one of them with DateTime::floor(unit), and with BatchBucketer.
+template <typename Unit>
+void run(const char* name, const std::vector<std::int64_t>& values, const Unit& unit, long iterations)
+{
+    const long rowCount = static_cast<long>(values.size());
+    std::vector<DateTime> datetimes;
+    for (const auto value : values)
+        datetimes.push_back(CompactDateTime(CompactDateTime::Nanoseconds(value)).toDateTime());
+    std::vector<std::int64_t> ids(values.size());
+    const BatchBucketer bucketer(unit);
+
+    std::printf("%s\n", name);
+    benchmark::measure("  DateTime::floor", iterations, [&](long) {
+        for (long i = 0; i < rowCount; ++i)
+            ids[i] = datetimes[i].floor(unit).toDaysSinceEpoch();
+        benchmark::doNotOptimize(ids.data());
+    }, rowCount);
+    benchmark::measure("  BatchBucketer::bucket", iterations, [&](long) {
+        bucketer.bucket(values.data(), values.size(), ids.data());
+        benchmark::doNotOptimize(ids.data());
+    }, rowCount);
+}
+
+int main()
+{
+    const long rowCount = 1 << 20;
+    const long iterations = 20;
+    // Timestamps of 2020 to 2028, in a scrambled order, and the same sorted.
+    std::vector<std::int64_t> values(rowCount);
+    std::uint64_t seed = 12345;
+    for (long i = 0; i < rowCount; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        values[i] = 1577836800000000000LL + static_cast<std::int64_t>((seed >> 11) % 283996800000000000ULL);
+    }
+    std::vector<std::int64_t> sorted(values);
+    std::sort(sorted.begin(), sorted.end());
+
+    std::printf("%ld scrambled rows (per row)\n", rowCount);
+    run("5 minutes", values, std::chrono::minutes(5), iterations);
+    run("ISO weeks", values, DateTime::CalendarUnit::Week, iterations);
+    run("months", values, DateTime::CalendarUnit::Month, iterations);
+    run("quarters", values, DateTime::CalendarUnit::Quarter, iterations);
+    std::printf("%ld sorted rows (per row)\n", rowCount);
+    run("5 minutes", sorted, std::chrono::minutes(5), iterations);
+    run("months", sorted, DateTime::CalendarUnit::Month, iterations);
+    return 0;
+}
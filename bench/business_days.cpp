@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/calendar.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 5;
+    const long count = 200000;
+    const Date first(2000, 1, 1);
+    const Date last(2050, 1, 1);
+
+    std::vector<Date> holidays;
+    for (int year = 2000; year < 2050; ++year) {
+        for (int month : { 1, 5, 12 })
+            holidays.push_back(Date(year, month, month == 12 ? 25 : 1));
+    }
+    std::sort(holidays.begin(), holidays.end());
+    const BusinessCalendar calendar(first, last, holidays);
+
+    std::vector<Date> dates;
+    std::vector<int> offsets;
+    for (long seed = 1, i = 0; i < count; ++i) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        dates.push_back(Date(2001, 1, 1).addDays(static_cast<int>(seed % 16000)));
+        offsets.push_back(static_cast<int>(seed >> 16) % 40 - 10);
+    }
+    const auto isBusinessDay = [&](const Date& date) {
+        return date.dayOfWeek() < 6 && !std::binary_search(holidays.begin(), holidays.end(), date);
+    };
+
+    std::printf("%ld settlement dates, T-10 to T+29 (per date)\n", count);
+    benchmark::measure("  Date::addDays", iterations, [&](long) {
+        long sum = 0;
+        for (size_t i = 0; i < dates.size(); ++i) {
+            Date date = dates[i];
+            const int step = offsets[i] < 0 ? -1 : 1;
+            for (int days = offsets[i]; days != 0; days -= step) {
+                date = date.addDays(step);
+                while (!isBusinessDay(date))
+                    date = date.addDays(step);
+            }
+            sum += date.day();
+        }
+        benchmark::doNotOptimize(sum);
+    }, count);
+    benchmark::measure("  BusinessCalendar::addBusinessDays", iterations, [&](long) {
+        long sum = 0;
+        for (size_t i = 0; i < dates.size(); ++i)
+            sum += calendar.addBusinessDays(dates[i], offsets[i]).day();
+        benchmark::doNotOptimize(sum);
+    }, count);
+    benchmark::measure("  BusinessCalendar::businessDaysBetween", iterations, [&](long) {
+        long sum = 0;
+        for (size_t i = 0; i + 1 < dates.size(); ++i)
+            sum += calendar.businessDaysBetween(dates[i], dates[i + 1]);
+        benchmark::doNotOptimize(sum);
+    }, count);
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/formatter.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long lineCount = 4096;
+    const long iterations = 100;
+    // Log lines 50 microseconds apart, so that about 20000 of them share a second, and 50 milliseconds apart, so that about 20 do.
+    for (const long long step : { 50000LL, 50000000LL }) {
+        std::vector<DateTime> timestamps;
+        DateTime value(Date(2024, 2, 18), Time(21, 46, 7, 987));
+        for (long i = 0; i < lineCount; ++i, value = value.addNanoseconds(step))
+            timestamps.push_back(value);
+        const Format format("yyyy-MM-dd hh:mm:ss.ffffff");
+        const CachedFormatter formatter(format);
+        char buffer[64];
+
+        std::printf("step of %lld ns (per line)\n", step);
+        const double plain = benchmark::measure("  DateTime::toString(Format)", iterations, [&](long) {
+            for (const auto& timestamp : timestamps)
+                benchmark::doNotOptimize(timestamp.toString(format));
+        }, lineCount);
+        benchmark::measure("  DateTime::toChars(Format)", iterations, [&](long) {
+            for (const auto& timestamp : timestamps)
+                benchmark::doNotOptimize(timestamp.toChars(buffer, buffer + sizeof(buffer), format));
+        }, lineCount);
+        benchmark::measure("  CachedFormatter::toString", iterations, [&](long) {
+            for (const auto& timestamp : timestamps)
+                benchmark::doNotOptimize(formatter.toString(timestamp));
+        }, lineCount);
+        const double cached = benchmark::measure("  CachedFormatter::toChars", iterations, [&](long) {
+            for (const auto& timestamp : timestamps)
+                benchmark::doNotOptimize(formatter.toChars(buffer, buffer + sizeof(buffer), timestamp));
+        }, lineCount);
+        std::printf("  lines per second: %.0f (toString) vs %.0f (CachedFormatter::toChars)\n", 1e9 / plain, 1e9 / cached);
+    }
+    return 0;
+}
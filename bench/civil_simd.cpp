@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/date.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+using namespace xclox;
+
+namespace {
+
+const size_t ChunkSize = 1 << 16;
+
+using DaysToYmd = size_t (*)(const std::int32_t*, size_t, int*, int*, int*);
+using YmdToDays = size_t (*)(const int*, const int*, const int*, size_t, std::int32_t*);
+
+struct Kernel {
+    const char* name;
+    DaysToYmd daysToYmd;
+    YmdToDays ymdToDays;
+};
+
+size_t daysToYmdScalar(const std::int32_t* days, size_t count, int* year, int* month, int* day)
+{
+    for (size_t i = 0; i < count; ++i)
+        internal::daysToYmd(internal::Days(days[i]), &year[i], &month[i], &day[i]);
+    return count;
+}
+
+size_t ymdToDaysScalar(const int* year, const int* month, const int* day, size_t count, std::int32_t* days)
+{
+    for (size_t i = 0; i < count; ++i)
+        days[i] = static_cast<std::int32_t>(internal::ymdToDays(year[i], month[i], day[i]).count());
+    return count;
+}
+
+size_t daysToYmdDispatched(const std::int32_t* days, size_t count, int* year, int* month, int* day)
+{
+    internal::daysToYmd(days, count, year, month, day);
+    return count;
+}
+
+size_t ymdToDaysDispatched(const int* year, const int* month, const int* day, size_t count, std::int32_t* days)
+{
+    internal::ymdToDays(year, month, day, count, days);
+    return count;
+}
+
+std::vector<Kernel> getKernels()
+{
+    std::vector<Kernel> kernels = { { "scalar (per value)", daysToYmdScalar, ymdToDaysScalar }, { "dispatched", daysToYmdDispatched, ymdToDaysDispatched } };
+#ifdef XCLOX_HAS_AVX
+    if (internal::getSimdLevel() >= internal::SimdLevel::Avx2)
+        kernels.push_back({ "AVX2", internal::daysToYmdAvx2, internal::ymdToDaysAvx2 });
+    if (internal::getSimdLevel() >= internal::SimdLevel::Avx512)
+        kernels.push_back({ "AVX-512", internal::daysToYmdAvx512, internal::ymdToDaysAvx512 });
+#endif
+    return kernels;
+}
+
+// Compares every kernel with the scalar conversions of single values over every day of the supported range, and returns the number of mismatches.
+long sweep(const std::vector<Kernel>& kernels)
+{
+    std::vector<std::int32_t> days(ChunkSize), roundTrip(ChunkSize);
+    std::vector<int> years(ChunkSize), months(ChunkSize), monthDays(ChunkSize);
+    std::vector<int> expectedYears(ChunkSize), expectedMonths(ChunkSize), expectedDays(ChunkSize);
+    long mismatches = 0;
+    const long long first = -static_cast<long long>(internal::CivilDaysOffset);
+    const long long last = std::numeric_limits<std::int32_t>::max();
+    for (long long start = first; start <= last; start += static_cast<long long>(ChunkSize)) {
+        const size_t count = static_cast<size_t>(std::min<long long>(ChunkSize, last - start + 1));
+        for (size_t i = 0; i < count; ++i)
+            days[i] = static_cast<std::int32_t>(start + static_cast<long long>(i));
+        daysToYmdScalar(days.data(), count, expectedYears.data(), expectedMonths.data(), expectedDays.data());
+        for (size_t k = 1; k < kernels.size(); ++k) {
+            const size_t converted = kernels[k].daysToYmd(days.data(), count, years.data(), months.data(), monthDays.data());
+            kernels[k].ymdToDays(expectedYears.data(), expectedMonths.data(), expectedDays.data(), converted, roundTrip.data());
+            for (size_t i = 0; i < converted; ++i)
+                mismatches += years[i] != expectedYears[i] || months[i] != expectedMonths[i] || monthDays[i] != expectedDays[i] || roundTrip[i] != days[i];
+        }
+    }
+    return mismatches;
+}
+
+} // namespace
+
+// Run with --sweep to also check every kernel over every day of the supported range, which takes a few minutes.
+int main(int argc, char* argv[])
+{
+    const std::vector<Kernel> kernels = getKernels();
+    const long iterations = 2000;
+    // Days spread over a few centuries around the epoch, as timestamps are.
+    std::vector<std::int32_t> days(ChunkSize), roundTrip(ChunkSize);
+    std::vector<int> years(ChunkSize), months(ChunkSize), monthDays(ChunkSize);
+    for (size_t i = 0; i < ChunkSize; ++i)
+        days[i] = static_cast<std::int32_t>(i * 2654435761u % 146097) - 73048;
+
+    std::printf("days to civil dates (per value)\n");
+    for (const auto& kernel : kernels) {
+        benchmark::measure((std::string("  ") + kernel.name).c_str(), iterations, [&](long) {
+            kernel.daysToYmd(days.data(), ChunkSize, years.data(), months.data(), monthDays.data());
+            benchmark::doNotOptimize(years.data());
+        }, ChunkSize);
+    }
+    std::printf("civil dates to days (per value)\n");
+    for (const auto& kernel : kernels) {
+        benchmark::measure((std::string("  ") + kernel.name).c_str(), iterations, [&](long) {
+            kernel.ymdToDays(years.data(), months.data(), monthDays.data(), ChunkSize, roundTrip.data());
+            benchmark::doNotOptimize(roundTrip.data());
+        }, ChunkSize);
+    }
+
+    if (argc < 2 || std::strcmp(argv[1], "--sweep") != 0)
+        return 0;
+    std::printf("sweeping every day from %lld to %d...\n", -static_cast<long long>(internal::CivilDaysOffset), std::numeric_limits<std::int32_t>::max());
+    const long mismatches = sweep(kernels);
+    std::printf("  mismatches: %ld\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/date.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long count = 4096;
+    const long iterations = 4000;
+    for (const auto& window : { std::make_pair(1970, 2100), std::make_pair(-3000, -1000) }) {
+        // Random days of the years [first, last), in the window of the table or outside it.
+        const long first = internal::ymdToDaysByFormula(window.first, 1, 1).count();
+        const long span = internal::ymdToDaysByFormula(window.second, 1, 1).count() - first;
+        std::vector<long> days(count);
+        std::vector<int> years(count), months(count), monthDays(count);
+        for (long i = 0; i < count; ++i) {
+            days[i] = first + static_cast<long>(static_cast<unsigned long>(i) * 2654435761u % static_cast<unsigned long>(span));
+            internal::daysToYmdByFormula(internal::Days(days[i]), &years[i], &months[i], &monthDays[i]);
+        }
+
+        std::printf("days of the years %d to %d (per value)\n", window.first, window.second - 1);
+        const double formula = benchmark::measure("  daysToYmd by formula", iterations, [&](long) {
+            for (long i = 0; i < count; ++i)
+                internal::daysToYmdByFormula(internal::Days(days[i]), &years[i], &months[i], &monthDays[i]);
+            benchmark::doNotOptimize(years.data());
+        }, count);
+        const double table = benchmark::measure("  daysToYmd (table, then formula)", iterations, [&](long) {
+            for (long i = 0; i < count; ++i)
+                internal::daysToYmd(internal::Days(days[i]), &years[i], &months[i], &monthDays[i]);
+            benchmark::doNotOptimize(years.data());
+        }, count);
+        std::printf("  speedup: %.2fx\n", formula / table);
+        const double reverseFormula = benchmark::measure("  ymdToDays by formula", iterations, [&](long) {
+            for (long i = 0; i < count; ++i)
+                days[i] = internal::ymdToDaysByFormula(years[i], months[i], monthDays[i]).count();
+            benchmark::doNotOptimize(days.data());
+        }, count);
+        const double reverseTable = benchmark::measure("  ymdToDays (table, then formula)", iterations, [&](long) {
+            for (long i = 0; i < count; ++i)
+                days[i] = internal::ymdToDays(years[i], months[i], monthDays[i]).count();
+            benchmark::doNotOptimize(days.data());
+        }, count);
+        std::printf("  speedup: %.2fx\n", reverseFormula / reverseTable);
+    }
+    return 0;
+}
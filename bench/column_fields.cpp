@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/column.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long rowCount = 1 << 20;
+    const long iterations = 20;
+    // Timestamps about 37 minutes apart, so that consecutive rows rarely share a day and a cache of the last day would not help.
+    std::vector<std::int64_t> values(rowCount);
+    for (long i = 0; i < rowCount; ++i)
+        values[i] = 1600000000000000000LL + i * 2222222222222LL;
+    const DateTimeColumn column(values);
+    std::vector<DateTime> datetimes;
+    for (long i = 0; i < rowCount; ++i)
+        datetimes.push_back(column.at(i).toDateTime());
+    std::vector<int> years(rowCount), months(rowCount), days(rowCount), hours(rowCount), weekdays(rowCount);
+
+    std::printf("group keys of %ld rows (per row)\n", rowCount);
+    benchmark::measure("  DateTime::year/month/day", iterations, [&](long) {
+        for (long i = 0; i < rowCount; ++i) {
+            years[i] = datetimes[i].year();
+            months[i] = datetimes[i].month();
+            days[i] = datetimes[i].day();
+        }
+        benchmark::doNotOptimize(years.data());
+    }, rowCount);
+    benchmark::measure("  CompactDateTime::getYearMonthDay", iterations, [&](long) {
+        for (long i = 0; i < rowCount; ++i)
+            CompactDateTime(CompactDateTime::Nanoseconds(values[i])).getYearMonthDay(&years[i], &months[i], &days[i]);
+        benchmark::doNotOptimize(years.data());
+    }, rowCount);
+    benchmark::measure("  DateTimeColumn::getYearMonthDay", iterations, [&](long) {
+        column.getYearMonthDay(years.data(), months.data(), days.data());
+        benchmark::doNotOptimize(years.data());
+    }, rowCount);
+    benchmark::measure("  DateTime::hour", iterations, [&](long) {
+        for (long i = 0; i < rowCount; ++i)
+            hours[i] = datetimes[i].hour();
+        benchmark::doNotOptimize(hours.data());
+    }, rowCount);
+    benchmark::measure("  DateTimeColumn::getHours", iterations, [&](long) {
+        column.getHours(hours.data());
+        benchmark::doNotOptimize(hours.data());
+    }, rowCount);
+    benchmark::measure("  DateTime::dayOfWeek", iterations, [&](long) {
+        for (long i = 0; i < rowCount; ++i)
+            weekdays[i] = datetimes[i].dayOfWeek();
+        benchmark::doNotOptimize(weekdays.data());
+    }, rowCount);
+    benchmark::measure("  DateTimeColumn::getDaysOfWeek", iterations, [&](long) {
+        column.getDaysOfWeek(weekdays.data());
+        benchmark::doNotOptimize(weekdays.data());
+    }, rowCount);
+    return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/compact.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace xclox;
+
+using SecondDateTime = BasicDateTime<std::int32_t, std::ratio<1>>;
+using MillisecondDateTime = BasicDateTime<std::int64_t, std::milli>;
+
+// Stores the timestamps in a column of Type, then prints its memory and the time to count the rows within a day and to sort the column.
+template <typename Type>
+void run(const char* name, const std::vector<DateTime>& timestamps, long iterations)
+{
+    const long rowCount = static_cast<long>(timestamps.size());
+    std::vector<Type> column;
+    column.reserve(timestamps.size());
+    for (const auto& timestamp : timestamps)
+        column.emplace_back(timestamp);
+    const Type from(DateTime(Date(2024, 6, 1)));
+    const Type to(DateTime(Date(2024, 6, 2)));
+
+    std::printf("%s: %zu bytes per row, %.1f MiB per %ld rows\n", name, sizeof(Type), static_cast<double>(sizeof(Type) * timestamps.size()) / (1 << 20), rowCount);
+    benchmark::measure("  count the rows of a day", iterations, [&](long) {
+        long count = 0;
+        for (const auto& value : column)
+            count += (from <= value) & (value < to);
+        benchmark::doNotOptimize(count);
+    }, rowCount);
+    benchmark::measure("  sort", iterations / 10 + 1, [&](long) {
+        std::vector<Type> copy(column);
+        std::sort(copy.begin(), copy.end());
+        benchmark::doNotOptimize(copy.data());
+    }, rowCount);
+}
+
+int main()
+{
+    const long rowCount = 1 << 22;
+    const long iterations = 50;
+    // Timestamps of 2020 to 2028 to the second, in a scrambled order.
+    std::vector<DateTime> timestamps;
+    timestamps.reserve(rowCount);
+    std::uint32_t seed = 12345;
+    for (long i = 0; i < rowCount; ++i) {
+        seed = seed * 1664525 + 1013904223;
+        timestamps.push_back(DateTime(Date(2020, 1, 1)).addSeconds(static_cast<int>(seed % 283996800)));
+    }
+
+    run<DateTime>("DateTime", timestamps, iterations);
+    run<CompactDateTime>("CompactDateTime (int64 nanoseconds)", timestamps, iterations);
+    run<MillisecondDateTime>("BasicDateTime<int64_t, milli>", timestamps, iterations);
+    run<SecondDateTime>("BasicDateTime<int32_t, ratio<1>>", timestamps, iterations);
+    return 0;
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/leapseconds.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 10;
+    const long count = 1000000;
+    const LeapSeconds leapSeconds = LeapSeconds::builtIn();
+
+    std::vector<std::int64_t> random;
+    for (long seed = 1, i = 0; i < count; ++i) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        random.push_back((1136073600 + (static_cast<std::int64_t>(seed) << 4) % 630720000) * 1000000000 + seed % 1000000000); // 2006 through 2025
+    }
+    // The TAI seconds at which the offsets of TAI from UTC of the built-in table start, for converting by a binary search per sample.
+    std::vector<std::int64_t> taiTimes;
+    for (DateTime utc(Date(1972, 1, 1)); utc < leapSeconds.expiration(); utc = utc.addDays(1)) {
+        if (utc.date() == Date(1972, 1, 1) || leapSeconds.leapSecond(utc.date().subtractDays(1)) != 0)
+            taiTimes.push_back(leapSeconds.toTai(utc).toDaysSinceEpoch() * 86400LL + leapSeconds.toTai(utc).time().toSecondsSinceMidnight() - 1);
+    }
+    std::vector<std::int64_t> sorted = random;
+    std::sort(sorted.begin(), sorted.end());
+    std::vector<std::int64_t> output(random.size());
+
+    for (const std::vector<std::int64_t>* input : { &random, &sorted }) {
+        std::vector<DateTime> datetimes;
+        for (std::int64_t value : *input)
+            datetimes.push_back(DateTime(DateTime::Nanoseconds(value)));
+        std::printf("%ld %s GPS samples, 2006 through 2025 (per sample)\n", count, input == &sorted ? "sorted" : "random");
+        benchmark::measure("  std::upper_bound per sample", iterations, [&](long) {
+            for (size_t i = 0; i < input->size(); ++i) {
+                const std::int64_t seconds = (*input)[i] / 1000000000 + 19;
+                const std::int64_t offset = 9 + (std::upper_bound(taiTimes.begin(), taiTimes.end(), seconds) - taiTimes.begin());
+                output[i] = (*input)[i] + (19 - offset) * 1000000000;
+            }
+            benchmark::doNotOptimize(output.back());
+        }, count);
+        benchmark::measure("  LeapSeconds::fromGps", iterations, [&](long) {
+            long sum = 0;
+            for (const DateTime& datetime : datetimes)
+                sum += leapSeconds.fromGps(datetime).second();
+            benchmark::doNotOptimize(sum);
+        }, count);
+        benchmark::measure("  LeapSeconds::fromGps (batch)", iterations, [&](long) {
+            leapSeconds.fromGps(input->data(), input->size(), output.data());
+            benchmark::doNotOptimize(output.back());
+        }, count);
+    }
+    return 0;
+}
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/datetime.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 1000000;
+    std::vector<DateTime> values;
+    for (long i = 0; i < 1024; ++i)
+        values.push_back(DateTime(std::chrono::nanoseconds(1700000000123456789LL + i * 86399999999937LL)));
+
+    const char* pattern = "yyyy-MM-ddThh:mm:ss.fff";
+    const Format format(pattern);
+    char buffer[64];
+
+    benchmark::measure("DateTime::toString(string)", iterations, [&](long i) {
+        benchmark::doNotOptimize(values[i & 1023].toString(pattern));
+    });
+    benchmark::measure("DateTime::toString(Format)", iterations, [&](long i) {
+        benchmark::doNotOptimize(values[i & 1023].toString(format));
+    });
+    benchmark::measure("DateTime::toChars(Format)", iterations, [&](long i) {
+        benchmark::doNotOptimize(values[i & 1023].toChars(buffer, buffer + sizeof(buffer), format));
+        benchmark::doNotOptimize(buffer);
+    });
+    benchmark::measure("IsoMillisecondFormat::toString", iterations, [&](long i) {
+        benchmark::doNotOptimize(IsoMillisecondFormat::toString(values[i & 1023]));
+    });
+    benchmark::measure("IsoMillisecondFormat::toChars", iterations, [&](long i) {
+        benchmark::doNotOptimize(IsoMillisecondFormat::toChars(buffer, buffer + sizeof(buffer), values[i & 1023]));
+        benchmark::doNotOptimize(buffer);
+    });
+    benchmark::measure("IsoNanosecondFormat::toChars", iterations, [&](long i) {
+        benchmark::doNotOptimize(IsoNanosecondFormat::toChars(buffer, buffer + sizeof(buffer), values[i & 1023]));
+        benchmark::doNotOptimize(buffer);
+    });
+    return 0;
+}
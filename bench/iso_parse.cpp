@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/datetime.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 1000000;
+    std::vector<std::string> values;
+    for (long i = 0; i < 1024; ++i)
+        values.push_back(IsoNanosecondFormat::toString(DateTime(std::chrono::nanoseconds(1700000000123456789LL + i * 86399999999937LL))));
+
+    const Format format("yyyy-MM-ddThh:mm:ss.fffffffff");
+
+    benchmark::measure("DateTime::fromString(string)", iterations / 10, [&](long i) {
+        benchmark::doNotOptimize(DateTime::fromString(values[i & 1023], "yyyy-MM-ddThh:mm:ss.fffffffff"));
+    });
+    benchmark::measure("DateTime::fromString(Format)", iterations / 10, [&](long i) {
+        benchmark::doNotOptimize(DateTime::fromString(values[i & 1023], format));
+    });
+    benchmark::measure("IsoNanosecondFormat::fromString", iterations, [&](long i) {
+        benchmark::doNotOptimize(IsoNanosecondFormat::fromString(values[i & 1023]));
+    });
+    benchmark::measure("internal::parseIsoScalar", iterations, [&](long i) {
+        internal::DateTimeFields fields;
+        benchmark::doNotOptimize(internal::parseIsoScalar(values[i & 1023].data(), internal::IsoLayoutSize, 'T', fields));
+        benchmark::doNotOptimize(fields);
+    });
+#ifdef XCLOX_HAS_SSE2
+    benchmark::measure("internal::parseIsoSse2", iterations, [&](long i) {
+        internal::DateTimeFields fields;
+        benchmark::doNotOptimize(internal::parseIsoSse2<internal::IsoLayoutSize>(values[i & 1023].data(), 'T', fields));
+        benchmark::doNotOptimize(fields);
+    });
+#endif
+    return 0;
+}
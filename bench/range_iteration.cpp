@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/range.hpp"
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 20;
+    const Date firstDate(1900, 1, 1);
+    const Date lastDate(2200, 1, 1);
+    const long dayCount = static_cast<long>(DateRange(firstDate, lastDate).size());
+
+    std::printf("%ld days (per day)\n", dayCount);
+    benchmark::measure("  Date::addDays", iterations, [&](long) {
+        long sum = 0;
+        for (Date date = firstDate; date < lastDate; date = date.addDays(1))
+            sum += date.day();
+        benchmark::doNotOptimize(sum);
+    }, dayCount);
+    benchmark::measure("  DateRange", iterations, [&](long) {
+        long sum = 0;
+        for (const Date& date : DateRange(firstDate, lastDate))
+            sum += date.day();
+        benchmark::doNotOptimize(sum);
+    }, dayCount);
+
+    const DateTime first(Date(2000, 1, 1), Time(0, 0, 0));
+    const DateTime last(Date(2040, 1, 1), Time(0, 0, 0));
+    const long slotCount = static_cast<long>(DateTimeRange(first, last, std::chrono::minutes(15)).size());
+
+    std::printf("%ld quarter hours (per quarter hour)\n", slotCount);
+    benchmark::measure("  DateTime::addMinutes", iterations, [&](long) {
+        long sum = 0;
+        for (DateTime datetime = first; datetime < last; datetime = datetime.addMinutes(15))
+            sum += datetime.day() + datetime.minute();
+        benchmark::doNotOptimize(sum);
+    }, slotCount);
+    benchmark::measure("  DateTimeRange", iterations, [&](long) {
+        long sum = 0;
+        for (const DateTime& datetime : DateTimeRange(first, last, std::chrono::minutes(15)))
+            sum += datetime.day() + datetime.minute();
+        benchmark::doNotOptimize(sum);
+    }, slotCount);
+    return 0;
+}
@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/recurrence.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long ruleCount = 10000;
+    const long iterations = 5;
+    // A mix of common scheduling rules, each starting at a pseudo-random datetime of 2024.
+    const char* const texts[] = {
+        "FREQ=DAILY",
+        "FREQ=WEEKLY;BYDAY=MO,WE,FR",
+        "FREQ=WEEKLY;INTERVAL=2;BYDAY=TU,TH",
+        "FREQ=MONTHLY;BYDAY=2TU",
+        "FREQ=MONTHLY;BYDAY=-1FR",
+        "FREQ=MONTHLY;BYMONTHDAY=1,15",
+        "FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1",
+        "FREQ=YEARLY;BYMONTH=11;BYDAY=4TH",
+        "FREQ=DAILY;BYHOUR=9,13,17",
+        "FREQ=HOURLY;INTERVAL=6",
+    };
+    std::vector<Recurrence> rules;
+    std::vector<DateTime> starts;
+    std::uint64_t seed = 12345;
+    for (long i = 0; i < ruleCount; ++i) {
+        seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+        rules.push_back(Recurrence::fromString(texts[i % 10]));
+        starts.push_back(DateTime(Date(2024, 1, 1).addDays(static_cast<int>((seed >> 33) % 366)), Time(static_cast<int>((seed >> 20) % 24), 0, 0)));
+    }
+    const size_t capacity = 4 * 1830;
+    std::vector<DateTime> buffer(capacity);
+
+    long occurrenceCount = 0;
+    for (long i = 0; i < ruleCount; ++i)
+        occurrenceCount += static_cast<long>(rules[i].expand(starts[i], starts[i], starts[i].addDays(5 * 365), buffer.data(), capacity));
+
+    std::printf("%ld rules over 5 years, %ld occurrences\n", ruleCount, occurrenceCount);
+    const double perRule = benchmark::measure("  Recurrence::expand (per rule)", iterations, [&](long) {
+        size_t size = 0;
+        for (long i = 0; i < ruleCount; ++i)
+            size += rules[i].expand(starts[i], starts[i], starts[i].addDays(5 * 365), buffer.data(), capacity);
+        benchmark::doNotOptimize(size);
+    }, ruleCount);
+    std::printf("  %.2f ns per occurrence, %.1f ms for all rules\n", perRule * ruleCount / occurrenceCount, perRule * ruleCount / 1e6);
+
+    std::printf("the next occurrence after a datetime 4 years after the start (per rule)\n");
+    benchmark::measure("  Recurrence::next", iterations * 20, [&](long) {
+        long sum = 0;
+        for (long i = 0; i < ruleCount; ++i)
+            sum += rules[i].next(starts[i], starts[i].addDays(4 * 365)).day();
+        benchmark::doNotOptimize(sum);
+    }, ruleCount);
+    return 0;
+}
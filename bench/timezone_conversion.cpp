@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/timezone.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <ctime>
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 10;
+    const long count = 200000;
+    const TimeZone zone = TimeZone::fromName("America/New_York");
+    if (!zone.isValid()) {
+        std::printf("America/New_York is not found in /usr/share/zoneinfo\n");
+        return 0;
+    }
+
+    std::vector<std::int64_t> seconds;
+    for (long seed = 1, i = 0; i < count; ++i) {
+        seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+        seconds.push_back(946684800 + (static_cast<std::int64_t>(seed) << 10) % 1262304000); // 2000 through 2039
+    }
+    std::vector<std::int64_t> sorted = seconds;
+    std::sort(sorted.begin(), sorted.end());
+
+    for (const std::vector<std::int64_t>* input : { &seconds, &sorted }) {
+        std::vector<DateTime> datetimes;
+        std::vector<std::int64_t> nanoseconds;
+        for (std::int64_t value : *input) {
+            datetimes.push_back(DateTime(std::chrono::seconds(value)));
+            nanoseconds.push_back(value * 1000000000);
+        }
+        std::vector<std::int64_t> local(nanoseconds.size());
+        std::vector<DateTime> localDatetimes(nanoseconds.size());
+        std::printf("%ld %s datetimes (per datetime)\n", count, input == &sorted ? "sorted" : "random");
+#if defined(__unix__) || defined(__APPLE__)
+        setenv("TZ", "America/New_York", 1);
+        tzset();
+        benchmark::measure("  localtime_r", iterations, [&](long) {
+            long sum = 0;
+            for (std::int64_t value : *input) {
+                const std::time_t time = static_cast<std::time_t>(value);
+                std::tm fields;
+                localtime_r(&time, &fields);
+                sum += fields.tm_hour;
+            }
+            benchmark::doNotOptimize(sum);
+        }, count);
+#endif
+        benchmark::measure("  TimeZone::toLocal", iterations, [&](long) {
+            long sum = 0;
+            for (const DateTime& datetime : datetimes)
+                sum += zone.toLocal(datetime).hour();
+            benchmark::doNotOptimize(sum);
+        }, count);
+        benchmark::measure("  TimeZone::toLocal (batch, nanoseconds)", iterations, [&](long) {
+            zone.toLocal(nanoseconds.data(), nanoseconds.size(), local.data());
+            benchmark::doNotOptimize(local.back());
+        }, count);
+        benchmark::measure("  TimeZone::toLocal (batch, datetimes)", iterations, [&](long) {
+            zone.toLocal(nanoseconds.data(), nanoseconds.size(), localDatetimes.data());
+            benchmark::doNotOptimize(localDatetimes.back());
+        }, count);
+        benchmark::measure("  TimeZone::toUtc", iterations, [&](long) {
+            long sum = 0;
+            for (const DateTime& datetime : datetimes)
+                sum += zone.toUtc(datetime).hour();
+            benchmark::doNotOptimize(sum);
+        }, count);
+    }
+    return 0;
+}
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "benchmark.hpp"
+
+#include "xclox/tzdb.hpp"
+
+#include <string>
+#include <vector>
+
+using namespace xclox;
+
+int main()
+{
+    const long iterations = 5;
+    const TimeZoneDatabase& database = tzdb::database();
+    std::vector<std::string> names;
+    for (std::uint32_t i = 0; i < database.zoneCount; ++i)
+        names.push_back(database.characters + database.zones[i].name);
+    const long count = static_cast<long>(names.size());
+
+    std::printf("%ld time zones of the database %s (per time zone)\n", count, database.version);
+    benchmark::measure("  TimeZoneDatabase::find", iterations * 1000, [&](long) {
+        long sum = 0;
+        for (const std::string& name : names)
+            sum += database.find(name.c_str()) != nullptr;
+        benchmark::doNotOptimize(sum);
+    }, count);
+    benchmark::measure("  TimeZone::fromDatabase", iterations, [&](long) {
+        long sum = 0;
+        for (const std::string& name : names)
+            sum += TimeZone::fromDatabase(name, database).isValid();
+        benchmark::doNotOptimize(sum);
+    }, count);
+    if (!TimeZone::fromName(names.front()).isValid()) {
+        std::printf("%s is not found in /usr/share/zoneinfo\n", names.front().c_str());
+        return 0;
+    }
+    benchmark::measure("  TimeZone::fromName", iterations, [&](long) {
+        long sum = 0;
+        for (const std::string& name : names)
+            sum += TimeZone::fromName(name).isValid();
+        benchmark::doNotOptimize(sum);
+    }, count);
+    return 0;
+}
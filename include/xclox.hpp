@@ -9,7 +9,17 @@
 #define XCLOX_HPP
 
 #include "xclox/version.hpp"
+#include "xclox/batch.hpp"
+#include "xclox/calendar.hpp"
+#include "xclox/column.hpp"
+#include "xclox/compact.hpp"
 #include "xclox/datetime.hpp"
+#include "xclox/formatter.hpp"
+#include "xclox/http.hpp"
+#include "xclox/leapseconds.hpp"
+#include "xclox/range.hpp"
+#include "xclox/recurrence.hpp"
+#include "xclox/timezone.hpp"
 #include "xclox/ntp/client.hpp"
 
 /** @mainpage Documentation
@@ -26,7 +36,7 @@
  * The following example shows only the basic functionalities of the library.
  * For further details, please see the full pages of the particular classes and their unit tests.
  *
- * xclox::Time, xclox::Date, xclox::DateTime, xclox::ntp::Client.
+ * xclox::Time, xclox::Date, xclox::DateTime, xclox::CompactDate, xclox::BasicDateTime, xclox::CompactDateTime, xclox::DateTimeColumn, xclox::Format, xclox::BatchParser, xclox::BatchFormatter, xclox::BatchBucketer, xclox::DateRange, xclox::DateTimeRange, xclox::Recurrence, xclox::BusinessCalendar, xclox::TimeZone, xclox::LeapSeconds, xclox::CachedFormatter, xclox::HttpFormat, xclox::ntp::Client.
  *
  * @subsection Example
  * @include demo.cpp
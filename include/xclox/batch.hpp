@@ -0,0 +1,568 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_BATCH_HPP
+#define XCLOX_BATCH_HPP
+
+#include "datetime.hpp"
+
+#include <cstdint>
+
+namespace xclox {
+
+namespace internal {
+
+    // Returns the length of the ISO-8601 layout "yyyy-MM-ddThh:mm:ss" or "yyyy-MM-dd hh:mm:ss", followed by "." and one to nine 'f's or by nothing, if format is one, and stores its date-time separator in separator. Otherwise, returns zero.
+    inline size_t getIsoLayoutSize(const std::string& format, char& separator)
+    {
+        if (format.size() < 19 || format.compare(0, 10, "yyyy-MM-dd") != 0 || (format[10] != 'T' && format[10] != ' ') || format.compare(11, 8, "hh:mm:ss") != 0)
+            return 0;
+        if (format.size() > 19 && (format.size() == 20 || format.size() > IsoLayoutSize || format[19] != '.' || format.find_first_not_of('f', 20) != std::string::npos))
+            return 0;
+        separator = format[10];
+        return format.size();
+    }
+
+} // namespace internal
+
+/**
+ * @class BatchParser
+ *
+ * BatchParser is an immutable class for parsing whole columns of datetime strings, such as those of CSV files or Arrow/Parquet string columns, into nanoseconds since the epoch "1970-01-01 00:00:00 UTC".
+ *
+ * The format is analyzed once at construction time, and every string is then parsed into its fields and converted to a 64-bit integer directly, without creating Date, Time, or DateTime objects.
+ * If the format is the ISO-8601 layout "yyyy-MM-ddThh:mm:ss" or "yyyy-MM-dd hh:mm:ss", optionally followed by "." and one to nine 'f's, well-formed strings are parsed by the vectorized parser of IsoFormat.
+ * Any other string is parsed as DateTime::fromString() does, so the result is the same either way.
+ *
+ * The result of every batch is written into two caller-provided arrays:
+ * an array of 64-bit nanoseconds, where invalid strings yield zero,
+ * and a validity bitmap of (count + 7) / 8 bytes, where bit i % 8 of byte i / 8 (least significant bit first, as in Apache Arrow) is set if string i is valid.
+ * A string is invalid if it does not match the format, if it describes an invalid datetime, or if the datetime is outside the 64-bit nanosecond range (years 1677 to 2262).
+ *
+ * @code
+ *    const BatchParser parser("yyyy-MM-dd hh:mm:ss.fff");
+ *    std::vector<std::int64_t> nanoseconds(strings.size());
+ *    std::vector<std::uint8_t> validity((strings.size() + 7) / 8);
+ *    size_t validCount = parser.parse(strings.data(), strings.size(), nanoseconds.data(), validity.data());
+ * @endcode
+ *
+ * @see The unit tests in @ref batch.h for further details.
+ */
+class BatchParser {
+public:
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs a BatchParser object for the format string \p format. See DateTime::toString() for information about the format patterns.
+    explicit BatchParser(const std::string& format = "yyyy-MM-dd hh:mm:ss")
+        : BatchParser(Format(format))
+    {
+    }
+
+    /// Constructs a BatchParser object for the precompiled format \p format.
+    explicit BatchParser(const Format& format)
+        : m_format(format)
+        , m_isoSeparator('T')
+        , m_isoSize(internal::getIsoLayoutSize(format.toString(), m_isoSeparator))
+    {
+    }
+
+    /// Copy-constructs a BatchParser object from \p other.
+    BatchParser(const BatchParser& other) = default;
+
+    /// Move-constructs a BatchParser object from \p other.
+    BatchParser(BatchParser&& other) = default;
+
+    /// Default destructor.
+    ~BatchParser() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    BatchParser& operator=(const BatchParser& other) = default;
+
+    /// Move assignment operator.
+    BatchParser& operator=(BatchParser&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns the format of this parser.
+    const Format& format() const
+    {
+        return m_format;
+    }
+
+    /// @}
+
+    /**
+     * @name Parsing Methods
+     * @{
+     */
+
+    /**
+     * Parses the \p count strings of the array \p inputs into the arrays \p nanoseconds and \p validity, and returns the number of valid strings.
+     * The array \p nanoseconds must hold \p count elements, and \p validity must hold (count + 7) / 8 bytes.
+     */
+    size_t parse(const std::string* inputs, size_t count, std::int64_t* nanoseconds, std::uint8_t* validity) const
+    {
+        return parseEach(count, nanoseconds, validity, [inputs](size_t i, const char*& first, size_t& size) {
+            first = inputs[i].data();
+            size = inputs[i].size();
+        });
+    }
+
+    /**
+     * Parses \p count strings stored back to back in the character buffer \p data into the arrays \p nanoseconds and \p validity, and returns the number of valid strings.
+     * String i occupies the characters [offsets[i], offsets[i + 1]) of \p data, so the array \p offsets must hold count + 1 elements, as in Apache Arrow string columns.
+     * The array \p nanoseconds must hold \p count elements, and \p validity must hold (count + 7) / 8 bytes.
+     */
+    template <typename Offset>
+    size_t parse(const char* data, const Offset* offsets, size_t count, std::int64_t* nanoseconds, std::uint8_t* validity) const
+    {
+        return parseEach(count, nanoseconds, validity, [data, offsets](size_t i, const char*& first, size_t& size) {
+            first = data + offsets[i];
+            size = static_cast<size_t>(offsets[i + 1] - offsets[i]);
+        });
+    }
+
+    /// @}
+
+private:
+    template <typename Function>
+    size_t parseEach(size_t count, std::int64_t* nanoseconds, std::uint8_t* validity, const Function& getInput) const
+    {
+        std::fill(validity, validity + (count + 7) / 8, std::uint8_t(0));
+        size_t validCount = 0;
+        for (size_t i = 0; i < count; ++i) {
+            const char* first;
+            size_t size;
+            getInput(i, first, size);
+            if (parseOne(first, size, nanoseconds[i])) {
+                validity[i / 8] = static_cast<std::uint8_t>(validity[i / 8] | (1u << (i % 8)));
+                ++validCount;
+            } else {
+                nanoseconds[i] = 0;
+            }
+        }
+        return validCount;
+    }
+
+    bool parseOne(const char* input, size_t size, std::int64_t& nanoseconds) const
+    {
+        internal::DateTimeFields fields;
+        if (size == m_isoSize && internal::parseIso(input, size, m_isoSeparator, fields) && internal::fieldsToNanosecondsSinceEpoch(fields, nanoseconds))
+            return true;
+        return internal::parseDateTime(input, size, m_format, fields) && internal::fieldsToNanosecondsSinceEpoch(fields, nanoseconds);
+    }
+
+    Format m_format;
+    char m_isoSeparator;
+    size_t m_isoSize;
+};
+
+/**
+ * @class BatchFormatter
+ *
+ * BatchFormatter is an immutable class for formatting whole columns of nanoseconds since the epoch "1970-01-01 00:00:00 UTC" into datetime strings, the reverse of BatchParser.
+ *
+ * The format is analyzed once at construction time; the ISO-8601 layouts that BatchParser parses with its fast path are also written with straight-line digit stores, as IsoFormat does.
+ * The strings are written back to back into one character buffer, along with an array of offsets, as Apache Arrow string columns are laid out:
+ * string i occupies the characters [offsets[i], offsets[i + 1]) of the buffer, so the array of offsets must hold count + 1 elements.
+ * The buffer is grown once per batch rather than allocating a string per value, and consecutive values on the same day share one day-to-civil conversion.
+ *
+ * Every string is identical to the one DateTime::toString() returns for the same value and format.
+ * An optional validity bitmap, laid out as that of BatchParser, marks the null values, which yield empty strings.
+ *
+ * @code
+ *    const BatchFormatter formatter("yyyy-MM-dd hh:mm:ss.fff");
+ *    std::string data;
+ *    std::vector<std::int32_t> offsets(nanoseconds.size() + 1);
+ *    formatter.format(nanoseconds.data(), nanoseconds.size(), data, offsets.data());
+ * @endcode
+ *
+ * @see The unit tests in @ref batch.h for further details.
+ */
+class BatchFormatter {
+public:
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs a BatchFormatter object for the format string \p format. See DateTime::toString() for information about the format patterns.
+    explicit BatchFormatter(const std::string& format = "yyyy-MM-dd hh:mm:ss")
+        : BatchFormatter(Format(format))
+    {
+    }
+
+    /// Constructs a BatchFormatter object for the precompiled format \p format.
+    explicit BatchFormatter(const Format& format)
+        : m_format(format)
+        , m_maxSize(0)
+        , m_isoSeparator('T')
+        , m_isoSize(internal::getIsoLayoutSize(format.toString(), m_isoSeparator))
+    {
+        for (const auto& token : format.tokens())
+            m_maxSize += maxSize(token);
+    }
+
+    /// Copy-constructs a BatchFormatter object from \p other.
+    BatchFormatter(const BatchFormatter& other) = default;
+
+    /// Move-constructs a BatchFormatter object from \p other.
+    BatchFormatter(BatchFormatter&& other) = default;
+
+    /// Default destructor.
+    ~BatchFormatter() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    BatchFormatter& operator=(const BatchFormatter& other) = default;
+
+    /// Move assignment operator.
+    BatchFormatter& operator=(BatchFormatter&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns the format of this formatter.
+    const Format& format() const
+    {
+        return m_format;
+    }
+
+    /// Returns the maximum length of a formatted string, which bounds the buffer size needed by a batch.
+    size_t maxSize() const
+    {
+        return m_maxSize;
+    }
+
+    /// @}
+
+    /**
+     * @name Formatting Methods
+     * @{
+     */
+
+    /**
+     * Formats the \p count values of the array \p nanoseconds, appends them to \p data, and returns the number of characters appended.
+     * The offsets of the strings within \p data are stored in the array \p offsets, which must hold count + 1 elements.
+     * If \p validity is not null, value i is formatted only if bit i % 8 of byte i / 8 is set; otherwise, it yields an empty string.
+     */
+    template <typename Offset>
+    size_t format(const std::int64_t* nanoseconds, size_t count, std::string& data, Offset* offsets, const std::uint8_t* validity = nullptr) const
+    {
+        const size_t initialSize = data.size();
+        data.resize(initialSize + count * m_maxSize);
+        char* const first = &data[0];
+        char* const last = first + data.size();
+        size_t pos = initialSize;
+        long lastDays = 0;
+        internal::DateTimeFields fields = { 0, 0, 0, 0, 0, 0, 0 };
+        int weekday = 0;
+        for (size_t i = 0; i < count; ++i) {
+            offsets[i] = static_cast<Offset>(pos);
+            if (validity && (validity[i / 8] >> (i % 8) & 1) == 0)
+                continue;
+            // Round the days toward negative infinity, so that the time of day is never negative.
+            const std::int64_t value = nanoseconds[i];
+            const long days = static_cast<long>(value / internal::NanosecondsPerDay - (value % internal::NanosecondsPerDay < 0 ? 1 : 0));
+            const std::int64_t timeOfDay = value - days * internal::NanosecondsPerDay;
+            if (weekday == 0 || days != lastDays) {
+                internal::daysToYmd(internal::Days(days), &fields.year, &fields.month, &fields.day);
+                weekday = internal::dayOfWeek(internal::Days(days));
+                lastDays = days;
+            }
+            const std::int64_t seconds = timeOfDay / 1000000000;
+            fields.hour = static_cast<int>(seconds / 3600);
+            fields.minute = static_cast<int>(seconds / 60 % 60);
+            fields.second = static_cast<int>(seconds % 60);
+            fields.nanosecond = static_cast<long>(timeOfDay % 1000000000);
+            if (m_isoSize != 0) {
+                writeIso(first + pos, fields);
+                pos += m_isoSize;
+            } else {
+                internal::CharWriter output(first + pos, last);
+                for (const auto& token : m_format.tokens())
+                    internal::writeDateTime(output, token, fields, weekday);
+                pos += output.size();
+            }
+        }
+        offsets[count] = static_cast<Offset>(pos);
+        data.resize(pos);
+        return pos - initialSize;
+    }
+
+    /// @}
+
+private:
+    // Returns the maximum number of characters DateTime::toString() writes for token, given the years of the 64-bit nanosecond range.
+    static size_t maxSize(const Format::Token& token)
+    {
+        const auto count = static_cast<size_t>(token.count);
+        if (!token.isPattern)
+            return count;
+        switch (token.flag) {
+        case 'y':
+            return 4;
+        case 'M':
+        case 'd':
+            return count <= 2 ? 2 : count == 3 ? 3 : 9;
+        case 'h':
+        case 'H':
+        case 'm':
+        case 's':
+            return 2;
+        case 'E':
+            return 3;
+        case 'a':
+        case 'A':
+            return 2;
+        default:
+            return count;
+        }
+    }
+
+    // Writes fields in the ISO-8601 layout of the format with straight-line digit stores, as IsoFormat does. The years of the 64-bit nanosecond range always have four digits.
+    void writeIso(char* dst, const internal::DateTimeFields& fields) const
+    {
+        internal::FixedDigits<4>::write(dst, static_cast<unsigned>(fields.year));
+        dst[4] = '-';
+        internal::FixedDigits<2>::write(dst + 5, static_cast<unsigned>(fields.month));
+        dst[7] = '-';
+        internal::FixedDigits<2>::write(dst + 8, static_cast<unsigned>(fields.day));
+        dst[10] = m_isoSeparator;
+        internal::FixedDigits<2>::write(dst + 11, static_cast<unsigned>(fields.hour));
+        dst[13] = ':';
+        internal::FixedDigits<2>::write(dst + 14, static_cast<unsigned>(fields.minute));
+        dst[16] = ':';
+        internal::FixedDigits<2>::write(dst + 17, static_cast<unsigned>(fields.second));
+        if (m_isoSize > 19) {
+            char digits[9];
+            internal::FixedDigits<9>::write(digits, static_cast<unsigned long>(fields.nanosecond));
+            dst[19] = '.';
+            std::memcpy(dst + 20, digits, m_isoSize - 20);
+        }
+    }
+
+    Format m_format;
+    size_t m_maxSize;
+    char m_isoSeparator;
+    size_t m_isoSize;
+};
+
+/**
+ * @class BatchBucketer
+ *
+ * BatchBucketer is an immutable class for assigning whole columns of nanoseconds since the epoch "1970-01-01 00:00:00 UTC" to the buckets of time-series aggregations, such as 5 minutes, hours, ISO weeks, calendar months, or quarters.
+ *
+ * A bucket is either a fixed width counted from an origin, which is the epoch by default, or a calendar unit, as DateTime::floor() rounds to.
+ * Every value is assigned the 64-bit id of its bucket, without creating Date, Time, or DateTime objects, and the buckets are numbered consecutively in time:
+ * the bucket of a fixed width w with origin o, containing the value t, is floor((t - o) / w);
+ * the ISO weeks are numbered from the week starting on Monday "1969-12-29", and the months, quarters, and years from those starting at the epoch.
+ * start() returns the nanoseconds since the epoch at which a bucket starts, the value DateTime::floor() would return.
+ *
+ * The values are divided by a fixed width of at least 16.384 microseconds by multiplying them with its reciprocal, and then corrected exactly, which is faster than integer division.
+ * The days of a batch are converted to civil dates in blocks, with the vector instructions of the CPU if it supports them, to number the months, quarters, and years.
+ *
+ * @code
+ *    const BatchBucketer bucketer(std::chrono::minutes(5));
+ *    std::vector<std::int64_t> ids(nanoseconds.size());
+ *    bucketer.bucket(nanoseconds.data(), nanoseconds.size(), ids.data());
+ *    const std::int64_t firstStart = bucketer.start(ids.front());
+ * @endcode
+ *
+ * @see The unit tests in @ref batch.h for further details.
+ */
+class BatchBucketer {
+public:
+    using Nanoseconds = DateTime::Nanoseconds; ///< Nanosecond duration.
+    using CalendarUnit = DateTime::CalendarUnit; ///< Calendar unit enumeration.
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs a BatchBucketer object for buckets of the fixed \p width counted from \p origin since the epoch. A width of less than one nanosecond is taken as one nanosecond.
+    explicit BatchBucketer(const Nanoseconds& width, const Nanoseconds& origin = Nanoseconds::zero())
+        : m_width(width.count() < 1 ? 1 : width.count())
+        , m_origin(origin.count())
+        , m_unit(CalendarUnit::Week)
+    {
+    }
+
+    /// Constructs a BatchBucketer object for buckets of the calendar \p unit.
+    explicit BatchBucketer(CalendarUnit unit)
+        : m_width(0)
+        , m_origin(0)
+        , m_unit(unit)
+    {
+    }
+
+    /// Copy-constructs a BatchBucketer object from \p other.
+    BatchBucketer(const BatchBucketer& other) = default;
+
+    /// Move-constructs a BatchBucketer object from \p other.
+    BatchBucketer(BatchBucketer&& other) = default;
+
+    /// Default destructor.
+    ~BatchBucketer() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    BatchBucketer& operator=(const BatchBucketer& other) = default;
+
+    /// Move assignment operator.
+    BatchBucketer& operator=(BatchBucketer&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Bucketing Methods
+     * @{
+     */
+
+    /// Returns the id of the bucket containing \p nanoseconds since the epoch.
+    std::int64_t bucket(std::int64_t nanoseconds) const
+    {
+        std::int64_t id;
+        bucket(&nanoseconds, 1, &id);
+        return id;
+    }
+
+    /// Stores the ids of the buckets containing the \p count values of the array \p nanoseconds into the array \p ids, which must hold \p count elements.
+    void bucket(const std::int64_t* nanoseconds, size_t count, std::int64_t* ids) const
+    {
+        if (m_width > 0) {
+            bucketByWidth(nanoseconds, count, ids);
+        } else if (m_unit == CalendarUnit::Week) {
+            for (size_t i = 0; i < count; ++i)
+                ids[i] = internal::floorDivide(internal::floorDivide(nanoseconds[i], internal::NanosecondsPerDay) + 3, 7);
+        } else {
+            bucketByCalendar(nanoseconds, count, ids);
+        }
+    }
+
+    /// Returns the nanoseconds since the epoch at which the bucket \p id starts. It is not checked for overflow.
+    std::int64_t start(std::int64_t id) const
+    {
+        if (m_width > 0)
+            return m_origin + id * m_width;
+        switch (m_unit) {
+        case CalendarUnit::Week:
+            return (id * 7 - 3) * internal::NanosecondsPerDay;
+        case CalendarUnit::Month:
+            return monthStart(id);
+        case CalendarUnit::Quarter:
+            return monthStart(id * 3);
+        case CalendarUnit::Year:
+            return monthStart(id * 12);
+        }
+        return 0;
+    }
+
+    /// @}
+
+private:
+    static constexpr size_t BlockSize = 256;
+
+    // Returns the nanoseconds since the epoch at which the month id, counted from January 1970, starts.
+    static std::int64_t monthStart(std::int64_t id)
+    {
+        const std::int64_t years = internal::floorDivide(id, 12);
+        return internal::ymdToDays(static_cast<int>(1970 + years), static_cast<int>(id - years * 12 + 1), 1).count() * internal::NanosecondsPerDay;
+    }
+
+    void bucketByWidth(const std::int64_t* nanoseconds, size_t count, std::int64_t* ids) const
+    {
+        // A width of at least 2^14 nanoseconds leaves quotients below 2^50, so the quotient estimated with the reciprocal in double precision and truncated toward zero is at most one below or two above the floor, which the exact remainder corrects.
+        // The products and differences wrap around as unsigned integers, which yields the exact remainder, as it is small.
+        if (m_width >= (1 << 14)) {
+            // The members are copied, since the stores into ids might otherwise alias them.
+            const std::int64_t width = m_width;
+            const std::uint64_t origin = static_cast<std::uint64_t>(m_origin);
+            const double reciprocal = 1.0 / static_cast<double>(width);
+            for (size_t i = 0; i < count; ++i) {
+                const std::uint64_t offset = static_cast<std::uint64_t>(nanoseconds[i]) - origin;
+                const std::int64_t quotient = static_cast<std::int64_t>(static_cast<double>(static_cast<std::int64_t>(offset)) * reciprocal);
+                const std::int64_t remainder = static_cast<std::int64_t>(offset - static_cast<std::uint64_t>(quotient) * static_cast<std::uint64_t>(width));
+                ids[i] = quotient + (remainder >= width) - (remainder < 0) - (remainder < -width);
+            }
+        } else {
+            const std::int64_t width = m_width;
+            const std::int64_t origin = m_origin;
+            for (size_t i = 0; i < count; ++i)
+                ids[i] = internal::floorDivide(nanoseconds[i] - origin, width);
+        }
+    }
+
+    void bucketByCalendar(const std::int64_t* nanoseconds, size_t count, std::int64_t* ids) const
+    {
+        if (m_unit == CalendarUnit::Month)
+            bucketByMonths<1>(nanoseconds, count, ids);
+        else if (m_unit == CalendarUnit::Quarter)
+            bucketByMonths<3>(nanoseconds, count, ids);
+        else
+            bucketByMonths<12>(nanoseconds, count, ids);
+    }
+
+    template <int MonthsPerBucket>
+    static void bucketByMonths(const std::int64_t* nanoseconds, size_t count, std::int64_t* ids)
+    {
+        // The months are counted from January 1670, before the earliest 64-bit nanoseconds, so that they are divided as positive numbers.
+        const int firstMonth = (1670 - 1970) * 12;
+        std::int32_t days[BlockSize];
+        int years[BlockSize];
+        int months[BlockSize];
+        int dayOfMonths[BlockSize];
+        for (size_t first = 0; first < count; first += BlockSize) {
+            const size_t size = count - first < BlockSize ? count - first : BlockSize;
+            for (size_t i = 0; i < size; ++i)
+                days[i] = static_cast<std::int32_t>(internal::floorDivide(nanoseconds[first + i], internal::NanosecondsPerDay));
+            internal::daysToYmd(days, size, years, months, dayOfMonths);
+            for (size_t i = 0; i < size; ++i)
+                ids[first + i] = static_cast<std::int64_t>(static_cast<std::uint32_t>((years[i] - 1970) * 12 + months[i] - 1 - firstMonth) / MonthsPerBucket) + firstMonth / MonthsPerBucket;
+        }
+    }
+
+    std::int64_t m_width;
+    std::int64_t m_origin;
+    CalendarUnit m_unit;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_BATCH_HPP
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_CALENDAR_HPP
+#define XCLOX_CALENDAR_HPP
+
+#include "date.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <initializer_list>
+#include <vector>
+
+namespace xclox {
+
+namespace internal {
+
+    // Returns the position of the set bit of word that has rank set bits below it. The word must have more than rank set bits.
+    inline int selectBit(std::uint64_t word, int rank)
+    {
+        int position = 0;
+        for (int width = 32; width >= 8; width >>= 1) {
+            const int count = countSetBits(word & ((std::uint64_t(1) << width) - 1));
+            if (count <= rank) {
+                rank -= count;
+                word >>= width;
+                position += width;
+            }
+        }
+        for (; rank > 0; --rank)
+            word &= word - 1;
+        return position + countTrailingZeros(word);
+    }
+
+} // namespace internal
+
+/**
+ * @class BusinessCalendar
+ *
+ * BusinessCalendar is an immutable class for the business days of a market or an organization, i.e., the days that are neither weekend days nor holidays, and for counting and adding business days.
+ *
+ * A calendar covers a window of dates, from a first date up to, but not including, a last date, and keeps one bit per day of the window, set if the day is a business day, together with the number of business days before every 64 days.
+ * So, isBusinessDay() tests a bit, businessDaysBetween() subtracts two counts, each of which adds the set bits of one word to a stored count, and addBusinessDays() finds the target count by a binary search over the stored counts and then the bit within the word, instead of stepping one day at a time.
+ * Outside the window, there are no holidays, and every week has the same business days, which are counted by whole weeks.
+ * Holidays outside the window are ignored; the weekend is Saturday and Sunday by default.
+ *
+ * Calendars can be combined by operator|(), whose closed days are those of either calendar, e.g. the days on which a cross-border payment cannot settle, and by operator&(), whose closed days are those of both calendars.
+ *
+ * @code
+ *    const BusinessCalendar calendar(Date(2024, 1, 1), Date(2025, 1, 1), { Date(2024, 1, 1), Date(2024, 12, 25), Date(2024, 12, 26) });
+ *    calendar.addBusinessDays(Date(2024, 12, 24), 1); // 2024-12-27
+ *    calendar.businessDaysBetween(Date(2024, 12, 23), Date(2024, 12, 30)); // 3
+ * @endcode
+ *
+ * @see The unit tests in @ref calendar.h for further details.
+ */
+class BusinessCalendar {
+public:
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs a BusinessCalendar object without holidays, whose weekend is Saturday and Sunday.
+    BusinessCalendar()
+        : BusinessCalendar(0, 0, weekendMask({ Date::Weekday::Saturday, Date::Weekday::Sunday }))
+    {
+    }
+
+    /// Constructs a BusinessCalendar object of the window from \p first up to, but not including, \p last, whose closed days are \p holidays and the days of \p weekend. If \p first or \p last is invalid, or \p last is not later than \p first, the window is empty.
+    explicit BusinessCalendar(const Date& first, const Date& last, const std::vector<Date>& holidays, std::initializer_list<Date::Weekday> weekend = { Date::Weekday::Saturday, Date::Weekday::Sunday })
+        : BusinessCalendar(first.toDaysSinceEpoch(), first.isValid() && last.isValid() && first < last ? last.toDaysSinceEpoch() : first.toDaysSinceEpoch(), weekendMask(weekend))
+    {
+        for (long i = 0, weekday = internal::dayOfWeek(internal::Days(m_first)); i < m_last - m_first; ++i, weekday = weekday % 7 + 1) {
+            if (!(m_weekend >> weekday & 1))
+                m_bits[static_cast<size_t>(i >> 6)] |= std::uint64_t(1) << (i & 63);
+        }
+        for (const Date& holiday : holidays) {
+            const long i = holiday.toDaysSinceEpoch() - m_first;
+            if (holiday.isValid() && i >= 0 && i < m_last - m_first)
+                m_bits[static_cast<size_t>(i >> 6)] &= ~(std::uint64_t(1) << (i & 63));
+        }
+        countBusinessDays();
+    }
+
+    /// Copy-constructs a BusinessCalendar object from \p other.
+    BusinessCalendar(const BusinessCalendar& other) = default;
+
+    /// Move-constructs a BusinessCalendar object from \p other.
+    BusinessCalendar(BusinessCalendar&& other) = default;
+
+    /// Default destructor.
+    ~BusinessCalendar() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    BusinessCalendar& operator=(const BusinessCalendar& other) = default;
+
+    /// Move assignment operator.
+    BusinessCalendar& operator=(BusinessCalendar&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Set Operators
+     * @{
+     */
+
+    /// Returns the calendar whose closed days are those of this calendar or of \p other; its window spans both windows, and its weekend has the weekend days of either.
+    BusinessCalendar operator|(const BusinessCalendar& other) const
+    {
+        return combine(*this, other, static_cast<std::uint8_t>(m_weekend | other.m_weekend), true);
+    }
+
+    /// Returns the calendar whose closed days are those of both this calendar and \p other; its window spans both windows, and its weekend has the weekend days of both.
+    BusinessCalendar operator&(const BusinessCalendar& other) const
+    {
+        return combine(*this, other, static_cast<std::uint8_t>(m_weekend & other.m_weekend), false);
+    }
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns the first date of the window, or an invalid date if the window is empty.
+    Date first() const
+    {
+        return m_first < m_last ? Date(internal::Days(m_first)) : Date();
+    }
+
+    /// Returns the date after the window, or an invalid date if the window is empty.
+    Date last() const
+    {
+        return m_first < m_last ? Date(internal::Days(m_last)) : Date();
+    }
+
+    /// Returns whether \p weekday is a weekend day.
+    bool isWeekend(Date::Weekday weekday) const
+    {
+        return m_weekend >> static_cast<int>(weekday) & 1;
+    }
+
+    /// Returns whether \p date is a business day. An invalid date is not.
+    bool isBusinessDay(const Date& date) const
+    {
+        return date.isValid() && isBusinessDay(date.toDaysSinceEpoch());
+    }
+
+    /**
+     * Returns the number of business days from \p from up to, but not including, \p to, which is negative if \p to is earlier than \p from, or 0 if either is invalid. For example:
+     *
+     * @code
+     *    BusinessCalendar().businessDaysBetween(Date(2024, 5, 3), Date(2024, 5, 7)); // 2, Friday and Monday
+     * @endcode
+     */
+    long businessDaysBetween(const Date& from, const Date& to) const
+    {
+        if (!from.isValid() || !to.isValid())
+            return 0;
+        return count(to.toDaysSinceEpoch()) - count(from.toDaysSinceEpoch());
+    }
+
+    /// @}
+
+    /**
+     * @name Manipulation Methods
+     * @{
+     */
+
+    /**
+     * Returns the business day \p days business days after \p date, or before it if \p days is negative, whether \p date is a business day or not. For example:
+     *
+     * @code
+     *    BusinessCalendar().addBusinessDays(Date(2024, 5, 3), 1); // 2024-05-06, the Monday after
+     *    BusinessCalendar().addBusinessDays(Date(2024, 5, 4), -1); // 2024-05-03, the Friday before
+     * @endcode
+     *
+     * If \p days is 0, \p date is returned as is. If \p date is invalid, or the calendar has no business days to count, an invalid date is returned.
+     */
+    Date addBusinessDays(const Date& date, long days) const
+    {
+        if (!date.isValid())
+            return Date();
+        if (days == 0)
+            return date;
+        const long day = date.toDaysSinceEpoch();
+        return select(days > 0 ? count(day + 1) + days - 1 : count(day) + days, day);
+    }
+
+    /// Returns the business day \p days business days before \p date, or after it if \p days is negative. See addBusinessDays() for further details.
+    Date subtractBusinessDays(const Date& date, long days) const
+    {
+        return addBusinessDays(date, -days);
+    }
+
+    /// @}
+
+private:
+    static constexpr long Monday = 4; // 1970-01-05, the first Monday after the epoch.
+
+    // Constructs a calendar of the window [first, last) without business days, whose weekend is weekend.
+    BusinessCalendar(long first, long last, std::uint8_t weekend)
+        : m_first(first)
+        , m_last(last)
+        , m_weekend(weekend)
+        , m_bits(static_cast<size_t>((last - first + 63) >> 6))
+        , m_counts(m_bits.size() + 1)
+        , m_weekCounts()
+        , m_weekOffsets()
+        , m_before(0)
+        , m_after(0)
+    {
+        for (int weekday = 1, count = 0; weekday <= 7; ++weekday) {
+            if (!(weekend >> weekday & 1))
+                m_weekOffsets[static_cast<size_t>(count++)] = static_cast<std::uint8_t>(weekday - 1);
+            m_weekCounts[static_cast<size_t>(weekday)] = static_cast<std::uint8_t>(count);
+        }
+    }
+
+    static std::uint8_t weekendMask(std::initializer_list<Date::Weekday> weekend)
+    {
+        std::uint8_t mask = 0;
+        for (Date::Weekday weekday : weekend)
+            mask = static_cast<std::uint8_t>(mask | 1u << static_cast<int>(weekday));
+        return mask;
+    }
+
+    static BusinessCalendar combine(const BusinessCalendar& a, const BusinessCalendar& b, std::uint8_t weekend, bool closedInEither)
+    {
+        long first = a.m_first < a.m_last ? a.m_first : b.m_first;
+        long last = a.m_first < a.m_last ? a.m_last : b.m_first;
+        if (b.m_first < b.m_last) {
+            first = std::min(first, b.m_first);
+            last = std::max(last, b.m_last);
+        }
+        BusinessCalendar result(first, last, weekend);
+        for (size_t i = 0; i < result.m_bits.size(); ++i) {
+            const long day = first + static_cast<long>(i << 6);
+            const std::uint64_t x = a.businessDays(day);
+            const std::uint64_t y = b.businessDays(day);
+            result.m_bits[i] = closedInEither ? x & y : x | y;
+        }
+        if ((last - first) & 63)
+            result.m_bits.back() &= (std::uint64_t(1) << ((last - first) & 63)) - 1;
+        result.countBusinessDays();
+        return result;
+    }
+
+    void countBusinessDays()
+    {
+        for (size_t i = 0; i < m_bits.size(); ++i)
+            m_counts[i + 1] = m_counts[i] + internal::countSetBits(m_bits[i]);
+        m_before = weeklyCount(m_first);
+        m_after = m_before + m_counts.back() - weeklyCount(m_last);
+    }
+
+    bool isBusinessDay(long day) const
+    {
+        if (day < m_first || day >= m_last)
+            return !(m_weekend >> internal::dayOfWeek(internal::Days(day)) & 1);
+        return m_bits[static_cast<size_t>((day - m_first) >> 6)] >> ((day - m_first) & 63) & 1;
+    }
+
+    // Returns the bits of the business days among the 64 days from day on.
+    std::uint64_t businessDays(long day) const
+    {
+        const long offset = day - m_first;
+        if (offset >= 0 && day + 64 <= m_last) {
+            const size_t i = static_cast<size_t>(offset >> 6);
+            const int shift = static_cast<int>(offset & 63);
+            return shift ? m_bits[i] >> shift | m_bits[i + 1] << (64 - shift) : m_bits[i];
+        }
+        std::uint64_t bits = 0;
+        for (int i = 0; i < 64; ++i) {
+            if (isBusinessDay(day + i))
+                bits |= std::uint64_t(1) << i;
+        }
+        return bits;
+    }
+
+    // Returns the number of business days before day that would be if every week had the business days of the weekend pattern, counted from the Monday after the epoch.
+    long weeklyCount(long day) const
+    {
+        const long weeks = static_cast<long>(internal::floorDivide(day - Monday, 7));
+        return weeks * m_weekCounts[7] + m_weekCounts[static_cast<size_t>(day - Monday - weeks * 7)];
+    }
+
+    // Returns the number of business days before day, counted from the Monday after the epoch, which is negative for earlier days.
+    long count(long day) const
+    {
+        if (day <= m_first)
+            return weeklyCount(day);
+        if (day >= m_last)
+            return weeklyCount(day) + m_after;
+        const long offset = day - m_first;
+        const size_t i = static_cast<size_t>(offset >> 6);
+        return m_before + m_counts[i] + internal::countSetBits(m_bits[i] & ((std::uint64_t(1) << (offset & 63)) - 1));
+    }
+
+    // Returns the business day before which count() business days are index, i.e., the inverse of count(). The search for the word of the day starts at the word of the day near, as business days are mostly added a few at a time.
+    Date select(long index, long near) const
+    {
+        if (index >= m_before && index < m_before + m_counts.back()) {
+            const long rank = index - m_before;
+            const long words = static_cast<long>(m_bits.size());
+            size_t i = static_cast<size_t>(std::min(std::max((near - m_first) >> 6, 0L), words - 1));
+            if (m_counts[i] > rank)
+                i = m_counts[i - 1] <= rank ? i - 1 : static_cast<size_t>(std::upper_bound(m_counts.begin(), m_counts.begin() + static_cast<long>(i), rank) - m_counts.begin() - 1);
+            else if (m_counts[i + 1] <= rank)
+                i = m_counts[i + 2] > rank ? i + 1 : static_cast<size_t>(std::upper_bound(m_counts.begin() + static_cast<long>(i) + 2, m_counts.end(), rank) - m_counts.begin() - 1);
+            return Date(internal::Days(m_first + static_cast<long>(i << 6) + internal::selectBit(m_bits[i], static_cast<int>(rank - m_counts[i]))));
+        }
+        if (m_weekCounts[7] == 0)
+            return Date();
+        if (index >= m_before)
+            index -= m_after;
+        const long weeks = static_cast<long>(internal::floorDivide(index, m_weekCounts[7]));
+        return Date(internal::Days(Monday + weeks * 7 + m_weekOffsets[static_cast<size_t>(index - weeks * m_weekCounts[7])]));
+    }
+
+    long m_first;
+    long m_last;
+    std::uint8_t m_weekend;
+    std::vector<std::uint64_t> m_bits;
+    std::vector<long> m_counts;
+    std::array<std::uint8_t, 8> m_weekCounts; // the numbers of business days in the first 0 to 7 days of a week from Monday.
+    std::array<std::uint8_t, 7> m_weekOffsets; // the days after Monday of the business days of a week.
+    long m_before;
+    long m_after;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_CALENDAR_HPP
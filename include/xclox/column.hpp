@@ -0,0 +1,357 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_COLUMN_HPP
+#define XCLOX_COLUMN_HPP
+
+#include "compact.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace xclox {
+
+/**
+ * @class DateTimeColumn
+ *
+ * DateTimeColumn is an immutable column of nullable datetimes, stored as a contiguous array of 64-bit nanoseconds since the epoch "1970-01-01 00:00:00 UTC" and a validity bitmap, as Apache Arrow timestamp columns are.
+ * The values are those of CompactDateTime, so the column covers the years 1677 to 2262.
+ *
+ * The bitmap, if any, holds (size + 7) / 8 bytes, where bit i % 8 of byte i / 8 (least significant bit first) is set if value i is valid, as that of BatchParser; a column constructed without a bitmap has no nulls.
+ * So, the arrays BatchParser::parse() fills can be moved into a column as they are.
+ *
+ * The field accessors, such as getYears() and getHours(), fill a caller-provided array with one field of every value.
+ * They work through the column a block of values at a time: they first split every value of the block into its days since the epoch and its time of day,
+ * and then convert the whole block with a branch-free loop over 32-bit integers, which compilers vectorize. Null values yield zero.
+ *
+ * Copying and slicing a column never copies its values: slices share the arrays of the column they are taken from.
+ *
+ * @code
+ *    const DateTimeColumn column(std::move(nanoseconds), std::move(validity));
+ *    std::vector<int> years(column.size()), months(column.size());
+ *    column.slice(1000, 500).getYearMonthDay(years.data(), months.data(), nullptr);
+ * @endcode
+ *
+ * @see The unit tests in @ref column.h for further details.
+ */
+class DateTimeColumn {
+public:
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an empty DateTimeColumn object.
+    DateTimeColumn()
+        : m_offset(0)
+        , m_size(0)
+    {
+    }
+
+    /// Copy-constructs a DateTimeColumn object from \p other, sharing its arrays.
+    DateTimeColumn(const DateTimeColumn& other) = default;
+
+    /// Move-constructs a DateTimeColumn object from \p other.
+    DateTimeColumn(DateTimeColumn&& other) = default;
+
+    /**
+     * Constructs a DateTimeColumn object from the array of \p nanoseconds since the epoch and the \p validity bitmap, which must hold (nanoseconds.size() + 7) / 8 bytes.
+     * If \p validity is empty, the column has no nulls.
+     */
+    explicit DateTimeColumn(std::vector<std::int64_t> nanoseconds, std::vector<std::uint8_t> validity = std::vector<std::uint8_t>())
+        : m_values(std::make_shared<const std::vector<std::int64_t>>(std::move(nanoseconds)))
+        , m_validity(validity.empty() ? nullptr : std::make_shared<const std::vector<std::uint8_t>>(std::move(validity)))
+        , m_offset(0)
+        , m_size(m_values->size())
+    {
+    }
+
+    /// Constructs a DateTimeColumn object from \p datetimes. Invalid datetimes and those outside the range of CompactDateTime become nulls.
+    explicit DateTimeColumn(const std::vector<DateTime>& datetimes)
+        : m_offset(0)
+        , m_size(datetimes.size())
+    {
+        std::vector<std::int64_t> values(datetimes.size(), 0);
+        std::vector<std::uint8_t> validity((datetimes.size() + 7) / 8, 0);
+        bool hasNulls = false;
+        for (size_t i = 0; i < datetimes.size(); ++i) {
+            const CompactDateTime value(datetimes[i]);
+            if (value.isValid()) {
+                values[i] = value.toNanosecondsSinceEpoch();
+                validity[i / 8] = static_cast<std::uint8_t>(validity[i / 8] | (1u << (i % 8)));
+            } else {
+                hasNulls = true;
+            }
+        }
+        m_values = std::make_shared<const std::vector<std::int64_t>>(std::move(values));
+        if (hasNulls)
+            m_validity = std::make_shared<const std::vector<std::uint8_t>>(std::move(validity));
+    }
+
+    /// Default destructor.
+    ~DateTimeColumn() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    DateTimeColumn& operator=(const DateTimeColumn& other) = default;
+
+    /// Move assignment operator.
+    DateTimeColumn& operator=(DateTimeColumn&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns the number of values in this column, including the nulls.
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    /// Returns whether this column has no values.
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /// Returns a pointer to the contiguous array of size() nanoseconds since the epoch. The elements of the nulls are unspecified.
+    const std::int64_t* data() const
+    {
+        return m_values ? m_values->data() + m_offset : nullptr;
+    }
+
+    /// Returns the nanoseconds since the epoch of value \p i, which is unspecified if the value is null.
+    std::int64_t operator[](size_t i) const
+    {
+        return (*m_values)[m_offset + i];
+    }
+
+    /// Returns value \p i as a CompactDateTime object, which is invalid if the value is null.
+    CompactDateTime at(size_t i) const
+    {
+        return isNull(i) ? CompactDateTime() : CompactDateTime(CompactDateTime::Nanoseconds((*this)[i]));
+    }
+
+    /// Returns whether value \p i is null.
+    bool isNull(size_t i) const
+    {
+        return m_validity && ((*m_validity)[(m_offset + i) / 8] >> ((m_offset + i) % 8) & 1) == 0;
+    }
+
+    /// Returns the number of nulls in this column, counting them in the validity bitmap.
+    size_t nullCount() const
+    {
+        size_t count = 0;
+        if (m_validity) {
+            for (size_t i = 0; i < m_size; ++i)
+                count += isNull(i);
+        }
+        return count;
+    }
+
+    /// Returns the column of the \p length values starting at value \p offset of this column, or of as many as there are. The slice shares the arrays of this column.
+    DateTimeColumn slice(size_t offset, size_t length) const
+    {
+        DateTimeColumn column(*this);
+        column.m_offset = m_offset + std::min(offset, m_size);
+        column.m_size = std::min(length, m_size - std::min(offset, m_size));
+        return column;
+    }
+
+    /// @}
+
+    /**
+     * @name Field Extraction Methods
+     * Each method fills the caller-provided arrays, which must hold size() elements, with one field of every value of this column. Null values yield zero.
+     * @{
+     */
+
+    /// Fills \p years, \p months, and \p days with the date fields of the values with a single conversion. Null pointers are ignored.
+    void getYearMonthDay(int* years, int* months, int* days) const
+    {
+        forEachBlock([&](size_t first, size_t count, const std::int32_t* dys, const std::int64_t*) {
+            int scratch[3][BlockSize];
+            internal::daysToYmd(dys, count, years ? years + first : scratch[0], months ? months + first : scratch[1], days ? days + first : scratch[2]);
+        });
+        clearNulls(years);
+        clearNulls(months);
+        clearNulls(days);
+    }
+
+    /// Fills \p years with the years of the values.
+    void getYears(int* years) const
+    {
+        getYearMonthDay(years, nullptr, nullptr);
+    }
+
+    /// Fills \p months with the months of the values, from 1 to 12.
+    void getMonths(int* months) const
+    {
+        getYearMonthDay(nullptr, months, nullptr);
+    }
+
+    /// Fills \p days with the days of month of the values, from 1 to 31.
+    void getDays(int* days) const
+    {
+        getYearMonthDay(nullptr, nullptr, days);
+    }
+
+    /// Fills \p days with the days of week of the values, from 1 (Monday) to 7 (Sunday), which correspond to the enumeration Date::Weekday.
+    void getDaysOfWeek(int* days) const
+    {
+        forEachBlock([days](size_t first, size_t count, const std::int32_t* dys, const std::int64_t*) {
+            // The epoch was a Thursday, and the day "-0001-03-01" of the algorithm of internal::daysToYmd() a Wednesday.
+            for (size_t i = 0; i < count; ++i)
+                days[first + i] = static_cast<int>((static_cast<std::uint32_t>(dys[i] + 719468) + 2) % 7) + 1;
+        });
+        clearNulls(days);
+    }
+
+    /// Fills \p days with the days of year of the values, from 1 to 365 (366 on leap years).
+    void getDaysOfYear(int* days) const
+    {
+        forEachBlock([days](size_t first, size_t count, const std::int32_t* dys, const std::int64_t*) {
+            int years[BlockSize], scratch[BlockSize];
+            internal::daysToYmd(dys, count, years, scratch, scratch);
+            for (size_t i = 0; i < count; ++i) {
+                // The days from the epoch to the first of January of the year, whose preceding year is always positive.
+                const std::uint32_t y = static_cast<std::uint32_t>(years[i] - 1);
+                const std::int32_t firstDay = static_cast<std::int32_t>(y * 365 + y / 4 - y / 100 + y / 400) - 719162;
+                days[first + i] = dys[i] - firstDay + 1;
+            }
+        });
+        clearNulls(days);
+    }
+
+    /// Fills \p days with the numbers of days since the epoch of the values, rounded toward negative infinity.
+    void getDaysSinceEpoch(long* days) const
+    {
+        forEachBlock([days](size_t first, size_t count, const std::int32_t* dys, const std::int64_t*) {
+            for (size_t i = 0; i < count; ++i)
+                days[first + i] = dys[i];
+        });
+        clearNulls(days);
+    }
+
+    /// Fills \p hours with the hours of the values, from 0 to 23.
+    void getHours(int* hours) const
+    {
+        forEachSecondOfDay([hours](size_t i, std::int32_t second) { hours[i] = static_cast<int>(second / 3600); });
+        clearNulls(hours);
+    }
+
+    /// Fills \p minutes with the minutes of the values, from 0 to 59.
+    void getMinutes(int* minutes) const
+    {
+        forEachSecondOfDay([minutes](size_t i, std::int32_t second) { minutes[i] = static_cast<int>(second / 60 % 60); });
+        clearNulls(minutes);
+    }
+
+    /// Fills \p seconds with the seconds of the values, from 0 to 59.
+    void getSeconds(int* seconds) const
+    {
+        forEachSecondOfDay([seconds](size_t i, std::int32_t second) { seconds[i] = static_cast<int>(second % 60); });
+        clearNulls(seconds);
+    }
+
+    /// Fills \p milliseconds with the milliseconds of the values, from 0 to 999.
+    void getMilliseconds(int* milliseconds) const
+    {
+        forEachBlock([milliseconds](size_t first, size_t count, const std::int32_t*, const std::int64_t* timeOfDay) {
+            for (size_t i = 0; i < count; ++i)
+                milliseconds[first + i] = static_cast<int>(timeOfDay[i] % 1000000000 / 1000000);
+        });
+        clearNulls(milliseconds);
+    }
+
+    /// Fills \p microseconds with the microseconds of the values, from 0 to 999999.
+    void getMicroseconds(long* microseconds) const
+    {
+        forEachBlock([microseconds](size_t first, size_t count, const std::int32_t*, const std::int64_t* timeOfDay) {
+            for (size_t i = 0; i < count; ++i)
+                microseconds[first + i] = static_cast<long>(timeOfDay[i] % 1000000000 / 1000);
+        });
+        clearNulls(microseconds);
+    }
+
+    /// Fills \p nanoseconds with the nanoseconds of the values, from 0 to 999999999.
+    void getNanoseconds(long* nanoseconds) const
+    {
+        forEachBlock([nanoseconds](size_t first, size_t count, const std::int32_t*, const std::int64_t* timeOfDay) {
+            for (size_t i = 0; i < count; ++i)
+                nanoseconds[first + i] = static_cast<long>(timeOfDay[i] % 1000000000);
+        });
+        clearNulls(nanoseconds);
+    }
+
+    /// @}
+
+private:
+    // The number of values converted at a time, small enough for the scratch arrays of a block to stay in the L1 cache.
+    static constexpr size_t BlockSize = 256;
+
+    // Splits the values of this column, a block at a time, into their days since the epoch and their nanoseconds since midnight, and calls function(first, count, days, timeOfDay) for the count values starting at value first.
+    // Every 64-bit nanosecond count, null or not, falls within 106752 days of the epoch, so the days fit in 32 bits and suit internal::daysToYmd().
+    template <typename Function>
+    void forEachBlock(const Function& function) const
+    {
+        const std::int64_t* values = data();
+        std::int32_t days[BlockSize];
+        std::int64_t timeOfDay[BlockSize];
+        for (size_t first = 0; first < m_size; first += BlockSize) {
+            const size_t count = m_size - first < BlockSize ? m_size - first : BlockSize;
+            for (size_t i = 0; i < count; ++i) {
+                const std::int64_t value = values[first + i];
+                const std::int64_t day = value / internal::NanosecondsPerDay - (value % internal::NanosecondsPerDay < 0);
+                days[i] = static_cast<std::int32_t>(day);
+                timeOfDay[i] = value - day * internal::NanosecondsPerDay;
+            }
+            function(first, count, days, timeOfDay);
+        }
+    }
+
+    // Calls function(i, second) with the second since midnight of every value i.
+    template <typename Function>
+    void forEachSecondOfDay(const Function& function) const
+    {
+        forEachBlock([&function](size_t first, size_t count, const std::int32_t*, const std::int64_t* timeOfDay) {
+            for (size_t i = 0; i < count; ++i)
+                function(first + i, static_cast<std::int32_t>(timeOfDay[i] / 1000000000));
+        });
+    }
+
+    // Sets the elements of the nulls in output, if not null, to zero.
+    template <typename T>
+    void clearNulls(T* output) const
+    {
+        if (!output || !m_validity)
+            return;
+        for (size_t i = 0; i < m_size; ++i) {
+            if (isNull(i))
+                output[i] = 0;
+        }
+    }
+
+    std::shared_ptr<const std::vector<std::int64_t>> m_values;
+    std::shared_ptr<const std::vector<std::uint8_t>> m_validity;
+    size_t m_offset;
+    size_t m_size;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_COLUMN_HPP
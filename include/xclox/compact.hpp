@@ -0,0 +1,986 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_COMPACT_HPP
+#define XCLOX_COMPACT_HPP
+
+#include "datetime.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+
+namespace xclox {
+
+/**
+ * @class CompactDate
+ *
+ * CompactDate is an immutable class representing a date as a signed 32-bit serial number of days since the epoch "1970-01-01".
+ *
+ * It is the compact counterpart of Date: it takes four bytes instead of twelve, and comparing, hashing, adding or subtracting days, and counting the days between two dates are single integer operations.
+ * The day of week and the days since the epoch come straight from the serial number, while the civil fields year(), month(), and day() are derived from it with one conversion whenever they are requested.
+ * It covers the years from about -5877641 to 5881580, the range of the serial number.
+ *
+ * Default-constructed CompactDate objects are invalid, as are those constructed from an invalid Date or one outside the range.
+ * CompactDate converts to and from Date losslessly within the range, and formats and parses strings exactly as Date does. For example:
+ *
+ * @code
+ *    std::vector<CompactDate> dates(rows.size());
+ *    std::sort(dates.begin(), dates.end()); // integer comparisons
+ *    const long span = dates.back() - dates.front(); // integer subtraction
+ * @endcode
+ *
+ * @see The unit tests in @ref compact.h for further details.
+ */
+class CompactDate {
+public:
+    /**
+     * @name Durations
+     * @{
+     */
+
+    using Days = Date::Days; ///< Day duration.
+    using Weeks = Date::Weeks; ///< Week duration.
+
+    /// @}
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an invalid CompactDate object. @see isValid()
+    CompactDate()
+        : m_days(Invalid)
+    {
+    }
+
+    /// Copy-constructs a CompactDate object from \p other.
+    CompactDate(const CompactDate& other) = default;
+
+    /// Move-constructs a CompactDate object from \p other.
+    CompactDate(CompactDate&& other) = default;
+
+    /// Constructs a CompactDate object from the number of \p days since the epoch "1970-01-01". If it is out of range, the constructed object is invalid.
+    explicit CompactDate(const Days& days)
+        : m_days(days.count() > Invalid && days.count() <= std::numeric_limits<std::int32_t>::max() ? static_cast<std::int32_t>(days.count()) : Invalid)
+    {
+    }
+
+    /// Constructs a CompactDate object from \p date. If \p date is invalid or out of range, the constructed object is invalid.
+    explicit CompactDate(const Date& date)
+        : CompactDate(date.isValid() ? date.toStdDurationSinceEpoch() : Days(static_cast<long>(Invalid)))
+    {
+    }
+
+    /// Constructs a CompactDate object from the given \p year, \p month, and \p day. @see Date(int, int, int)
+    explicit CompactDate(int year, int month, int day)
+        : CompactDate(Date(year, month, day))
+    {
+    }
+
+    /// Default destructor.
+    ~CompactDate() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    CompactDate& operator=(const CompactDate& other) = default;
+
+    /// Move assignment operator.
+    CompactDate& operator=(CompactDate&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Comparison Operators
+     * @{
+     */
+
+    /// Returns whether this date is earlier than \p other.
+    bool operator<(const CompactDate& other) const
+    {
+        return m_days < other.m_days;
+    }
+
+    /// Returns whether this date is earlier than \p other or equal to it.
+    bool operator<=(const CompactDate& other) const
+    {
+        return m_days <= other.m_days;
+    }
+
+    /// Returns whether this date is later than \p other.
+    bool operator>(const CompactDate& other) const
+    {
+        return m_days > other.m_days;
+    }
+
+    /// Returns whether this date is later than \p other or equal to it.
+    bool operator>=(const CompactDate& other) const
+    {
+        return m_days >= other.m_days;
+    }
+
+    /// Returns whether this date is equal to \p other.
+    bool operator==(const CompactDate& other) const
+    {
+        return m_days == other.m_days;
+    }
+
+    /// Returns whether this date is different from \p other.
+    bool operator!=(const CompactDate& other) const
+    {
+        return m_days != other.m_days;
+    }
+
+    /// Returns the number of days from \p other to this date, which is negative if this date is earlier.
+    long operator-(const CompactDate& other) const
+    {
+        return static_cast<long>(m_days) - other.m_days;
+    }
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns whether this date object represents a valid date.
+    bool isValid() const
+    {
+        return m_days != Invalid;
+    }
+
+    /// Returns this date as a Date object. If this date is invalid, an invalid Date object is returned.
+    Date toDate() const
+    {
+        return isValid() ? Date(Days(m_days)) : Date();
+    }
+
+    /// Returns the day of month (1, 31).
+    int day() const
+    {
+        int d;
+        getYearMonthDay(nullptr, nullptr, &d);
+        return d;
+    }
+
+    /// Returns the month of year (1, 12), which corresponds to the enumeration Date::Month.
+    int month() const
+    {
+        int m;
+        getYearMonthDay(nullptr, &m, nullptr);
+        return m;
+    }
+
+    /// Returns the year as a number. There is no year 0.
+    int year() const
+    {
+        int y;
+        getYearMonthDay(&y, nullptr, nullptr);
+        return y;
+    }
+
+    /// Extracts the \p year, \p month, and \p day of this date with a single conversion. Null pointers are ignored.
+    void getYearMonthDay(int* year, int* month, int* day) const
+    {
+        internal::daysToYmd(internal::Days(m_days), year, month, day);
+    }
+
+    /// Returns the weekday of this date as a number between 1 and 7, which corresponds to the enumeration Date::Weekday.
+    int dayOfWeek() const
+    {
+        return internal::dayOfWeek(internal::Days(m_days));
+    }
+
+    /// Returns the day of year of this date as a number between 1 and 365 (1 to 366 on leap years).
+    int dayOfYear() const
+    {
+        return static_cast<int>(m_days - internal::ymdToDays(year(), 1, 1).count() + 1);
+    }
+
+    /// @}
+
+    /**
+     * @name Addition/Subtraction Methods
+     * Days and weeks are added or subtracted with a single integer operation, while months and years go through the civil calendar as Date does.
+     * The result is not checked for overflow; an invalid date stays invalid.
+     * @{
+     */
+
+    /// Returns the result of adding \p days to this date.
+    CompactDate addDays(int days) const
+    {
+        return isValid() ? CompactDate(Days(static_cast<long>(m_days) + days)) : CompactDate();
+    }
+
+    /// Returns the result of subtracting \p days from this date.
+    CompactDate subtractDays(int days) const
+    {
+        return isValid() ? CompactDate(Days(static_cast<long>(m_days) - days)) : CompactDate();
+    }
+
+    /// Returns the result of adding \p weeks to this date.
+    CompactDate addWeeks(int weeks) const
+    {
+        return addDays(weeks * 7);
+    }
+
+    /// Returns the result of subtracting \p weeks from this date.
+    CompactDate subtractWeeks(int weeks) const
+    {
+        return subtractDays(weeks * 7);
+    }
+
+    /// Returns the result of adding \p months to this date. @see Date::addMonths()
+    CompactDate addMonths(int months) const
+    {
+        return isValid() ? CompactDate(toDate().addMonths(months)) : CompactDate();
+    }
+
+    /// Returns the result of subtracting \p months from this date. @see Date::subtractMonths()
+    CompactDate subtractMonths(int months) const
+    {
+        return isValid() ? CompactDate(toDate().subtractMonths(months)) : CompactDate();
+    }
+
+    /// Returns the result of adding \p years to this date. @see Date::addYears()
+    CompactDate addYears(int years) const
+    {
+        return isValid() ? CompactDate(toDate().addYears(years)) : CompactDate();
+    }
+
+    /// Returns the result of subtracting \p years from this date. @see Date::subtractYears()
+    CompactDate subtractYears(int years) const
+    {
+        return isValid() ? CompactDate(toDate().subtractYears(years)) : CompactDate();
+    }
+
+    /// @}
+
+    /**
+     * @name Conversion Methods
+     * @{
+     */
+
+    /// Returns the number of elapsed days since the epoch "1970-01-01".
+    long toDaysSinceEpoch() const
+    {
+        return m_days;
+    }
+
+    /// Returns the elapsed time since the epoch "1970-01-01" as a #Days duration.
+    Days toStdDurationSinceEpoch() const
+    {
+        return Days(m_days);
+    }
+
+    /// Returns the date as a string formatted according to the format string \p format. @see Date::toString()
+    std::string toString(const std::string& format) const
+    {
+        return toDate().toString(format);
+    }
+
+    /// Returns the date as a string formatted according to the precompiled format \p format. @see Date::toString()
+    std::string toString(const Format& format) const
+    {
+        return toDate().toString(format);
+    }
+
+    /// Writes the date formatted according to the precompiled format \p format into the character range [\p first, \p last). @see Date::toChars()
+    size_t toChars(char* first, char* last, const Format& format) const
+    {
+        return toDate().toChars(first, last, format);
+    }
+
+    /// @}
+
+    /// Returns a CompactDate object set to the current date obtained from the system clock. @see Date::current()
+    static CompactDate current()
+    {
+        return CompactDate(std::chrono::duration_cast<Days>(std::chrono::system_clock::now().time_since_epoch()));
+    }
+
+    /// Returns a CompactDate object set to the epoch "1970-01-01".
+    static CompactDate epoch()
+    {
+        return CompactDate(Days(0));
+    }
+
+    /// Returns a CompactDate object from the date string \p date according to the format string \p format. @see Date::fromString()
+    static CompactDate fromString(const std::string& date, const std::string& format)
+    {
+        return CompactDate(Date::fromString(date, format));
+    }
+
+    /// Returns a CompactDate object from the date string \p date according to the precompiled format \p format. @see Date::fromString()
+    static CompactDate fromString(const std::string& date, const Format& format)
+    {
+        return CompactDate(Date::fromString(date, format));
+    }
+
+    /**
+     * Parses the characters in the range [\p first, \p last), formatted according to the precompiled format \p format, into \p date, as Date::fromChars() does.
+     * A date outside the range of CompactDate fails with ParseError::InvalidValue.
+     */
+    static ParseResult fromChars(const char* first, const char* last, const Format& format, CompactDate& date)
+    {
+        Date parsed;
+        ParseResult result = Date::fromChars(first, last, format, parsed);
+        date = CompactDate(parsed);
+        if (result && !date.isValid()) {
+            result.error = ParseError::InvalidValue;
+        }
+        return result;
+    }
+
+private:
+    // The serial number of an invalid date, which is the earliest serial number.
+    static constexpr std::int32_t Invalid = std::numeric_limits<std::int32_t>::min();
+
+    std::int32_t m_days;
+};
+
+/**
+ * @class BasicDateTime
+ *
+ * BasicDateTime is an immutable class template representing a datetime as a single signed count of ticks since the epoch "1970-01-01 00:00:00 UTC", not counting leap seconds.
+ * The count is stored as the signed integer type \p Rep, and a tick lasts \p Period seconds, which is a std::ratio from a nanosecond to a day that divides a day evenly.
+ *
+ * It is the compact counterpart of DateTime: it takes the size of \p Rep instead of the twenty-four bytes of DateTime, and comparing, hashing, and adding or subtracting fixed durations are single integer operations.
+ * The civil fields, such as year(), month(), and day(), are not stored but derived from the count whenever they are requested.
+ * In exchange, it only covers the datetimes within the range of the count, and the subseconds finer than a tick are truncated.
+ * For example, BasicDateTime<std::int32_t, std::ratio<1>> takes four bytes and covers "1901-12-13 20:45:53" to "2038-01-19 03:14:07" to the second,
+ * while BasicDateTime<std::int64_t, std::milli> takes eight bytes and covers about 292 million years to the millisecond.
+ * CompactDateTime, an alias of BasicDateTime<std::chrono::nanoseconds::rep, std::nano>, covers "1677-09-21 00:12:43.145224193" to "2262-04-11 23:47:16.854775807" to the nanosecond.
+ *
+ * Default-constructed BasicDateTime objects are invalid, as are those constructed from an invalid datetime or one outside the range.
+ * BasicDateTime converts to and from DateTime, and between its instantiations, only explicitly: the subseconds finer than the target tick are truncated toward the earlier tick, and a datetime outside the target range becomes invalid.
+ * It formats and parses strings exactly as DateTime does. For example:
+ *
+ * @code
+ *    using Timestamp = BasicDateTime<std::int32_t, std::ratio<1>>;
+ *    std::vector<Timestamp> facts; // four bytes per fact
+ *    facts.emplace_back(DateTime::current());
+ *    std::sort(facts.begin(), facts.end()); // integer comparisons
+ *    const CompactDateTime precise(facts.front()); // explicit widening conversion
+ *    facts.front().toString("yyyy-MM-dd hh:mm:ss");
+ * @endcode
+ *
+ * @see The unit tests in @ref compact.h for further details.
+ */
+template <typename Rep, typename Period>
+class BasicDateTime {
+    static_assert(std::is_integral<Rep>::value && std::is_signed<Rep>::value, "the count must be a signed integer type");
+    static_assert(1000000000LL * Period::num % Period::den == 0, "the tick must be a whole number of nanoseconds");
+    static_assert(86400LL * Period::den % Period::num == 0, "the tick must divide a day evenly");
+
+    template <typename OtherRep, typename OtherPeriod>
+    friend class BasicDateTime;
+
+public:
+    /**
+     * @name Durations
+     * @{
+     */
+
+    using Duration = std::chrono::duration<Rep, Period>; ///< Tick duration, in which the count is stored.
+    using Difference = std::chrono::duration<typename std::common_type<Rep, std::chrono::nanoseconds::rep>::type, Period>; ///< Duration between two datetimes, which is at least 64 bits wide.
+    using Nanoseconds = DateTime::Nanoseconds; ///< Nanosecond duration.
+    using Microseconds = DateTime::Microseconds; ///< Microsecond duration.
+    using Milliseconds = DateTime::Milliseconds; ///< Millisecond duration.
+    using Seconds = DateTime::Seconds; ///< Second duration.
+    using Minutes = DateTime::Minutes; ///< Minute duration.
+    using Hours = DateTime::Hours; ///< Hour duration.
+    using Days = DateTime::Days; ///< Day duration.
+    using Weeks = DateTime::Weeks; ///< Week duration.
+
+    /// @}
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an invalid BasicDateTime object. @see isValid()
+    BasicDateTime()
+        : m_count(Invalid)
+    {
+    }
+
+    /// Copy-constructs a BasicDateTime object from \p other.
+    BasicDateTime(const BasicDateTime& other) = default;
+
+    /// Move-constructs a BasicDateTime object from \p other.
+    BasicDateTime(BasicDateTime&& other) = default;
+
+    /// Constructs a BasicDateTime object from \p duration since the epoch "1970-01-01 00:00:00 UTC".
+    explicit BasicDateTime(const Duration& duration)
+        : m_count(duration.count())
+    {
+    }
+
+    /// Constructs a BasicDateTime object from the standard library's chrono time point, \p timePoint, truncated toward the earlier tick. If \p timePoint is out of range, the constructed object is invalid.
+    explicit BasicDateTime(const std::chrono::system_clock::time_point& timePoint)
+        : m_count(Invalid)
+    {
+        const auto duration = std::chrono::duration_cast<Nanoseconds>(timePoint.time_since_epoch());
+        const std::int64_t days = duration.count() / internal::NanosecondsPerDay - (duration.count() % internal::NanosecondsPerDay < 0 ? 1 : 0);
+        if (!internal::toTicksSinceEpoch(static_cast<long>(days), TicksPerDay, (duration.count() - days * internal::NanosecondsPerDay) / NanosecondsPerTick, m_count))
+            m_count = Invalid;
+    }
+
+    /// Constructs a BasicDateTime object from \p datetime, truncated toward the earlier tick. If \p datetime is invalid or out of range, the constructed object is invalid.
+    explicit BasicDateTime(const DateTime& datetime)
+        : m_count(Invalid)
+    {
+        if (datetime.isValid() && !internal::toTicksSinceEpoch(datetime.toDaysSinceEpoch(), TicksPerDay, datetime.time().toNanosecondsSinceMidnight() / NanosecondsPerTick, m_count))
+            m_count = Invalid;
+    }
+
+    /// Constructs a BasicDateTime object from \p date and \p time. @see BasicDateTime(const DateTime&)
+    explicit BasicDateTime(const Date& date, const Time& time)
+        : BasicDateTime(DateTime(date, time))
+    {
+    }
+
+    /// Constructs a BasicDateTime object from \p other of another precision or storage, truncated toward the earlier tick. If \p other is invalid or out of range, the constructed object is invalid.
+    template <typename OtherRep, typename OtherPeriod>
+    explicit BasicDateTime(const BasicDateTime<OtherRep, OtherPeriod>& other)
+        : m_count(Invalid)
+    {
+        if (other.isValid() && !internal::toTicksSinceEpoch(other.days(), TicksPerDay, other.nanosecondsOfDay() / NanosecondsPerTick, m_count))
+            m_count = Invalid;
+    }
+
+    /// Default destructor.
+    ~BasicDateTime() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    BasicDateTime& operator=(const BasicDateTime& other) = default;
+
+    /// Move assignment operator.
+    BasicDateTime& operator=(BasicDateTime&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Comparison Operators
+     * @{
+     */
+
+    /// Returns whether this datetime is earlier than \p other.
+    bool operator<(const BasicDateTime& other) const
+    {
+        return m_count < other.m_count;
+    }
+
+    /// Returns whether this datetime is earlier than \p other or equal to it.
+    bool operator<=(const BasicDateTime& other) const
+    {
+        return m_count <= other.m_count;
+    }
+
+    /// Returns whether this datetime is later than \p other.
+    bool operator>(const BasicDateTime& other) const
+    {
+        return m_count > other.m_count;
+    }
+
+    /// Returns whether this datetime is later than \p other or equal to it.
+    bool operator>=(const BasicDateTime& other) const
+    {
+        return m_count >= other.m_count;
+    }
+
+    /// Returns whether this datetime is equal to \p other.
+    bool operator==(const BasicDateTime& other) const
+    {
+        return m_count == other.m_count;
+    }
+
+    /// Returns whether this datetime is different from \p other.
+    bool operator!=(const BasicDateTime& other) const
+    {
+        return m_count != other.m_count;
+    }
+
+    /// @}
+
+    /**
+     * @name Arithmetic Operators
+     * @{
+     */
+
+    /// Returns the duration between this datetime and \p other.
+    Difference operator-(const BasicDateTime& other) const
+    {
+        return Difference(static_cast<typename Difference::rep>(m_count) - other.m_count);
+    }
+
+    /// Returns the result of subtracting \p duration from this datetime. @see subtractDuration()
+    template <typename DurationRep, typename DurationPeriod>
+    BasicDateTime operator-(const std::chrono::duration<DurationRep, DurationPeriod>& duration) const
+    {
+        return subtractDuration(duration);
+    }
+
+    /// Returns the result of adding \p duration to this datetime. @see addDuration()
+    template <typename DurationRep, typename DurationPeriod>
+    BasicDateTime operator+(const std::chrono::duration<DurationRep, DurationPeriod>& duration) const
+    {
+        return addDuration(duration);
+    }
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns whether this datetime object represents a valid datetime.
+    bool isValid() const
+    {
+        return m_count != Invalid;
+    }
+
+    /// Returns this datetime as a DateTime object. If this datetime is invalid, an invalid DateTime object is returned.
+    DateTime toDateTime() const
+    {
+        return isValid() ? DateTime(date(), time()) : DateTime();
+    }
+
+    /// Returns the date part of this datetime.
+    Date date() const
+    {
+        return Date(Days(days()));
+    }
+
+    /// Returns the time part of this datetime.
+    Time time() const
+    {
+        return Time(Nanoseconds(nanosecondsOfDay()));
+    }
+
+    /// Returns the nanosecond of second (0, 999999999).
+    long nanosecond() const
+    {
+        return static_cast<long>(nanosecondsOfDay() % 1000000000);
+    }
+
+    /// Returns the microsecond of second (0, 999999).
+    long microsecond() const
+    {
+        return static_cast<long>(nanosecondsOfDay() / 1000 % 1000000);
+    }
+
+    /// Returns the millisecond of second (0, 999).
+    int millisecond() const
+    {
+        return static_cast<int>(nanosecondsOfDay() / 1000000 % 1000);
+    }
+
+    /// Returns the second of minute (0, 59).
+    int second() const
+    {
+        return static_cast<int>(nanosecondsOfDay() / 1000000000 % 60);
+    }
+
+    /// Returns the minute of hour (0, 59).
+    int minute() const
+    {
+        return static_cast<int>(nanosecondsOfDay() / 60000000000 % 60);
+    }
+
+    /// Returns the hour of day (0, 23).
+    int hour() const
+    {
+        return static_cast<int>(nanosecondsOfDay() / 3600000000000);
+    }
+
+    /// Returns the day of month (1, 31).
+    int day() const
+    {
+        int d;
+        getYearMonthDay(nullptr, nullptr, &d);
+        return d;
+    }
+
+    /// Returns the month of year (1, 12), which corresponds to the enumeration DateTime::Month.
+    int month() const
+    {
+        int m;
+        getYearMonthDay(nullptr, &m, nullptr);
+        return m;
+    }
+
+    /// Returns the year as a number.
+    int year() const
+    {
+        int y;
+        getYearMonthDay(&y, nullptr, nullptr);
+        return y;
+    }
+
+    /// Extracts the \p year, \p month, and \p day of this datetime with a single conversion. Null pointers are ignored.
+    void getYearMonthDay(int* year, int* month, int* day) const
+    {
+        internal::daysToYmd(internal::Days(days()), year, month, day);
+    }
+
+    /// Returns the day of week (1, 7), which corresponds to the enumeration DateTime::Weekday.
+    int dayOfWeek() const
+    {
+        return internal::dayOfWeek(internal::Days(days()));
+    }
+
+    /// Returns the day of year (1, 366).
+    int dayOfYear() const
+    {
+        return date().dayOfYear();
+    }
+
+    /// @}
+
+    /**
+     * @name Addition/Subtraction Methods
+     * The fixed durations (nanoseconds through days) are added or subtracted with a single integer operation, while months and years go through the civil calendar as DateTime does.
+     * A duration finer than a tick is truncated toward zero before it is added or subtracted.
+     * A result outside the range of a count narrower than 64 bits is invalid, while a 64-bit count is not checked for overflow; an invalid datetime stays invalid.
+     * @{
+     */
+
+    /// Returns the result of adding \p nanoseconds to this datetime.
+    BasicDateTime addNanoseconds(int nanoseconds) const
+    {
+        return addDuration(Nanoseconds(nanoseconds));
+    }
+
+    /// Returns the result of subtracting \p nanoseconds from this datetime.
+    BasicDateTime subtractNanoseconds(int nanoseconds) const
+    {
+        return subtractDuration(Nanoseconds(nanoseconds));
+    }
+
+    /// Returns the result of adding \p microseconds to this datetime.
+    BasicDateTime addMicroseconds(int microseconds) const
+    {
+        return addDuration(Microseconds(microseconds));
+    }
+
+    /// Returns the result of subtracting \p microseconds from this datetime.
+    BasicDateTime subtractMicroseconds(int microseconds) const
+    {
+        return subtractDuration(Microseconds(microseconds));
+    }
+
+    /// Returns the result of adding \p milliseconds to this datetime.
+    BasicDateTime addMilliseconds(int milliseconds) const
+    {
+        return addDuration(Milliseconds(milliseconds));
+    }
+
+    /// Returns the result of subtracting \p milliseconds from this datetime.
+    BasicDateTime subtractMilliseconds(int milliseconds) const
+    {
+        return subtractDuration(Milliseconds(milliseconds));
+    }
+
+    /// Returns the result of adding \p seconds to this datetime.
+    BasicDateTime addSeconds(int seconds) const
+    {
+        return addDuration(Seconds(seconds));
+    }
+
+    /// Returns the result of subtracting \p seconds from this datetime.
+    BasicDateTime subtractSeconds(int seconds) const
+    {
+        return subtractDuration(Seconds(seconds));
+    }
+
+    /// Returns the result of adding \p minutes to this datetime.
+    BasicDateTime addMinutes(int minutes) const
+    {
+        return addDuration(Minutes(minutes));
+    }
+
+    /// Returns the result of subtracting \p minutes from this datetime.
+    BasicDateTime subtractMinutes(int minutes) const
+    {
+        return subtractDuration(Minutes(minutes));
+    }
+
+    /// Returns the result of adding \p hours to this datetime.
+    BasicDateTime addHours(int hours) const
+    {
+        return addDuration(Hours(hours));
+    }
+
+    /// Returns the result of subtracting \p hours from this datetime.
+    BasicDateTime subtractHours(int hours) const
+    {
+        return subtractDuration(Hours(hours));
+    }
+
+    /// Returns the result of adding \p days to this datetime.
+    BasicDateTime addDays(int days) const
+    {
+        return addDuration(Days(days));
+    }
+
+    /// Returns the result of subtracting \p days from this datetime.
+    BasicDateTime subtractDays(int days) const
+    {
+        return subtractDuration(Days(days));
+    }
+
+    /// Returns the result of adding \p months to this datetime. @see DateTime::addMonths()
+    BasicDateTime addMonths(int months) const
+    {
+        return BasicDateTime(toDateTime().addMonths(months));
+    }
+
+    /// Returns the result of subtracting \p months from this datetime. @see DateTime::subtractMonths()
+    BasicDateTime subtractMonths(int months) const
+    {
+        return BasicDateTime(toDateTime().subtractMonths(months));
+    }
+
+    /// Returns the result of adding \p years to this datetime. @see DateTime::addYears()
+    BasicDateTime addYears(int years) const
+    {
+        return BasicDateTime(toDateTime().addYears(years));
+    }
+
+    /// Returns the result of subtracting \p years from this datetime. @see DateTime::subtractYears()
+    BasicDateTime subtractYears(int years) const
+    {
+        return BasicDateTime(toDateTime().subtractYears(years));
+    }
+
+    /// Returns the result of adding \p duration to this datetime.
+    template <typename DurationRep, typename DurationPeriod>
+    BasicDateTime addDuration(const std::chrono::duration<DurationRep, DurationPeriod>& duration) const
+    {
+        return isValid() ? fromTicks(static_cast<std::int64_t>(m_count) + std::chrono::duration_cast<std::chrono::duration<std::int64_t, Period>>(duration).count()) : BasicDateTime();
+    }
+
+    /// Returns the result of subtracting \p duration from this datetime.
+    template <typename DurationRep, typename DurationPeriod>
+    BasicDateTime subtractDuration(const std::chrono::duration<DurationRep, DurationPeriod>& duration) const
+    {
+        return isValid() ? fromTicks(static_cast<std::int64_t>(m_count) - std::chrono::duration_cast<std::chrono::duration<std::int64_t, Period>>(duration).count()) : BasicDateTime();
+    }
+
+    /// @}
+
+    /**
+     * @name Conversion Methods
+     * @{
+     */
+
+    /// Returns the number of elapsed nanoseconds since "1970-01-01 00:00:00.000 UTC", not counting leap seconds. It is not checked for overflow.
+    long long toNanosecondsSinceEpoch() const
+    {
+        return static_cast<long long>(m_count) * NanosecondsPerTick;
+    }
+
+    /// Returns the number of elapsed days since "1970-01-01 00:00:00.000 UTC", not counting leap seconds.
+    long toDaysSinceEpoch() const
+    {
+        return days();
+    }
+
+    /// Returns the count of ticks since "1970-01-01 00:00:00.000 UTC" as a **std::chrono::duration**, not counting leap seconds.
+    Duration toStdDurationSinceEpoch() const
+    {
+        return Duration(m_count);
+    }
+
+    /// Returns a **std::chrono::system_clock::time_point** representation of this datetime.
+    std::chrono::system_clock::time_point toStdTimePoint() const
+    {
+        return std::chrono::system_clock::time_point(std::chrono::duration_cast<std::chrono::system_clock::duration>(Duration(m_count)));
+    }
+
+    /// Returns the datetime as a string formatted according to the format string \p format. @see DateTime::toString()
+    std::string toString(const std::string& format = "yyyy-MM-dd hh:mm:ss") const
+    {
+        return toString(Format(format));
+    }
+
+    /// Returns the datetime as a string formatted according to the precompiled format \p format. @see DateTime::toString()
+    std::string toString(const Format& format) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /// Writes the datetime formatted according to the precompiled format \p format into the character range [\p first, \p last). @see DateTime::toChars()
+    size_t toChars(char* first, char* last, const Format& format) const
+    {
+        if (!isValid())
+            return 0;
+
+        internal::DateTimeFields fields;
+        getYearMonthDay(&fields.year, &fields.month, &fields.day);
+        const std::int64_t nanoseconds = nanosecondsOfDay();
+        fields.hour = static_cast<int>(nanoseconds / 3600000000000);
+        fields.minute = static_cast<int>(nanoseconds / 60000000000 % 60);
+        fields.second = static_cast<int>(nanoseconds / 1000000000 % 60);
+        fields.nanosecond = static_cast<long>(nanoseconds % 1000000000);
+        const int weekday = dayOfWeek();
+        internal::CharWriter output(first, last);
+        for (const auto& token : format.tokens()) {
+            internal::writeDateTime(output, token, fields, weekday);
+        }
+        return output.size();
+    }
+
+    /// @}
+
+    /// Returns a BasicDateTime object set to the current datetime obtained from the system clock. @see DateTime::current()
+    static BasicDateTime current()
+    {
+        return BasicDateTime(std::chrono::system_clock::now());
+    }
+
+    /// Returns a BasicDateTime object set to the epoch "1970-1-1T00:00:00".
+    static BasicDateTime epoch()
+    {
+        return BasicDateTime(Duration::zero());
+    }
+
+    /// Returns a BasicDateTime object from the string \p datetime formatted according to the format string \p format. @see DateTime::fromString()
+    static BasicDateTime fromString(const std::string& datetime, const std::string& format = "yyyy-MM-dd hh:mm:ss")
+    {
+        return fromString(datetime, Format(format));
+    }
+
+    /// Returns a BasicDateTime object from the string \p datetime formatted according to the precompiled format \p format. @see DateTime::fromString()
+    static BasicDateTime fromString(const std::string& datetime, const Format& format)
+    {
+        BasicDateTime result;
+        fromChars(datetime.data(), datetime.data() + datetime.size(), format, result);
+        return result;
+    }
+
+    /**
+     * Parses the characters in the range [\p first, \p last), formatted according to the precompiled format \p format, into \p datetime, as DateTime::fromChars() does.
+     * The subseconds finer than a tick are truncated, and a datetime outside the range fails with ParseError::InvalidValue.
+     */
+    static ParseResult fromChars(const char* first, const char* last, const Format& format, BasicDateTime& datetime)
+    {
+        internal::DateTimeFields fields;
+        ParseResult result = internal::parseDateTime(first, static_cast<size_t>(last - first), format, fields);
+        datetime = BasicDateTime();
+        if (result && !internal::fieldsToTicksSinceEpoch(fields, NanosecondsPerTick, datetime.m_count)) {
+            datetime = BasicDateTime();
+            result.error = ParseError::InvalidValue;
+        }
+        return result;
+    }
+
+private:
+    // The count of an invalid datetime, which is the earliest count.
+    static constexpr Rep Invalid = std::numeric_limits<Rep>::min();
+
+    // The nanoseconds of a tick, and the ticks of a day.
+    static constexpr std::int64_t NanosecondsPerTick = 1000000000LL * Period::num / Period::den;
+    static constexpr std::int64_t TicksPerDay = 86400LL * Period::den / Period::num;
+
+    // Returns a BasicDateTime object from ticks, which is invalid if ticks is outside the range of Rep.
+    static BasicDateTime fromTicks(std::int64_t ticks)
+    {
+        if (ticks <= static_cast<std::int64_t>(std::numeric_limits<Rep>::min()) || ticks > static_cast<std::int64_t>(std::numeric_limits<Rep>::max()))
+            return BasicDateTime();
+        return BasicDateTime(Duration(static_cast<Rep>(ticks)));
+    }
+
+    // Returns the days since the epoch, rounded toward negative infinity.
+    long days() const
+    {
+        return static_cast<long>(m_count / TicksPerDay - (m_count % TicksPerDay < 0 ? 1 : 0));
+    }
+
+    // Returns the ticks since midnight.
+    std::int64_t timeOfDay() const
+    {
+        const std::int64_t remainder = m_count % TicksPerDay;
+        return remainder < 0 ? remainder + TicksPerDay : remainder;
+    }
+
+    // Returns the nanoseconds since midnight.
+    std::int64_t nanosecondsOfDay() const
+    {
+        return timeOfDay() * NanosecondsPerTick;
+    }
+
+    Rep m_count;
+};
+
+template <typename Rep, typename Period>
+constexpr Rep BasicDateTime<Rep, Period>::Invalid;
+
+template <typename Rep, typename Period>
+constexpr std::int64_t BasicDateTime<Rep, Period>::NanosecondsPerTick;
+
+template <typename Rep, typename Period>
+constexpr std::int64_t BasicDateTime<Rep, Period>::TicksPerDay;
+
+/**
+ * CompactDateTime is the BasicDateTime of a signed 64-bit count of nanoseconds.
+ * It takes eight bytes and covers the datetimes from "1677-09-21 00:12:43.145224193" to "2262-04-11 23:47:16.854775807" to the nanosecond. For example:
+ *
+ * @code
+ *    std::vector<CompactDateTime> events; // eight bytes per event
+ *    events.emplace_back(DateTime::current());
+ *    std::sort(events.begin(), events.end()); // integer comparisons
+ *    events.front().toString("yyyy-MM-dd hh:mm:ss.fff");
+ * @endcode
+ */
+using CompactDateTime = BasicDateTime<std::chrono::nanoseconds::rep, std::nano>;
+
+} // namespace xclox
+
+namespace std {
+
+/// Hashes a CompactDate object as its serial number of days since the epoch.
+template <>
+struct hash<xclox::CompactDate> {
+    size_t operator()(const xclox::CompactDate& date) const
+    {
+        return std::hash<long>()(date.toDaysSinceEpoch());
+    }
+};
+
+/// Hashes a BasicDateTime object as its count of ticks since the epoch.
+template <typename Rep, typename Period>
+struct hash<xclox::BasicDateTime<Rep, Period>> {
+    size_t operator()(const xclox::BasicDateTime<Rep, Period>& datetime) const
+    {
+        return std::hash<long long>()(datetime.toStdDurationSinceEpoch().count());
+    }
+};
+
+} // namespace std
+
+#endif // XCLOX_COMPACT_HPP
@@ -8,13 +8,14 @@
 #ifndef XCLOX_DATE_HPP
 #define XCLOX_DATE_HPP
 
-#include "internal.hpp"
+#include "format.hpp"
+#include "simd.hpp"
 
 namespace xclox {
 
 namespace internal {
 
-    inline Days ymdToDays(int year, int month, int day)
+    inline XCLOX_CONSTEXPR14 Days ymdToDaysByFormula(int year, int month, int day)
     {
         // Math from http://howardhinnant.github.io/date_algorithms.html
         auto const y = static_cast<int>(year) - (month <= 2) + (year < 1); // if the year is negative; i.e. before common era, add one year.
@@ -28,7 +29,7 @@ namespace internal {
         return Days { era * 146097 + static_cast<long>(doe) - 719468 };
     }
 
-    inline void daysToYmd(Days dys, int* year, int* month, int* day)
+    inline XCLOX_CONSTEXPR14 void daysToYmdByFormula(Days dys, int* year, int* month, int* day)
     {
         // Math from http://howardhinnant.github.io/date_algorithms.html
         auto const z = dys.count() + 719468;
@@ -50,6 +51,272 @@ namespace internal {
             *day = static_cast<int>(d);
     }
 
+#ifdef XCLOX_HAS_CONSTEXPR14
+    // Holds a constant instance of Type, constructed at compile time, so that constexpr functions can refer to it.
+    template <typename Type>
+    struct StaticInstance {
+        static constexpr Type value {};
+    };
+
+    template <typename Type>
+    constexpr Type StaticInstance<Type>::value;
+#endif
+
+    // A table of the first day of every year from FirstYear to LastYear, and of the month and day of every day of year, which converts the dates of those years with a few lookups instead of the divisions of the formulas above.
+    // It takes four bytes per year plus about 1.5 KiB, so the default window of 1900 to 2200 fits in 3 KiB.
+    template <int FirstYear, int LastYear>
+    class CivilTable {
+        static_assert(0 < FirstYear && FirstYear <= LastYear, "the window must be a non-empty range of positive years");
+
+    public:
+#ifdef XCLOX_HAS_CONSTEXPR14
+        // Returns the table, which is built at compile time.
+        static constexpr const CivilTable& get()
+        {
+            return StaticInstance<CivilTable>::value;
+        }
+#else
+        // Returns the table, which is built at the first call.
+        static const CivilTable& get()
+        {
+            static const CivilTable table;
+            return table;
+        }
+#endif
+
+        // Converts the day dys since the epoch to a civil date as daysToYmdByFormula() does, and returns true, if it falls within the window; otherwise, returns false.
+        XCLOX_CONSTEXPR14 bool daysToYmd(long dys, int* year, int* month, int* day) const
+        {
+            const long offset = dys - m_firstDay;
+            if (offset < 0 || offset >= m_length)
+                return false;
+            // Whatever the window, the estimate is either the year of the day or the year before it, so both candidates are loaded at once.
+            const long estimate = (offset - 2) * 400 / 146097;
+            const std::uint32_t current = m_years[estimate];
+            const std::uint32_t next = m_years[estimate + 1];
+            const bool isNext = offset >= static_cast<long>(next >> 1);
+            const std::uint32_t info = isNext ? next : current;
+            const std::uint16_t monthDay = m_monthDays[info & 1][offset - static_cast<long>(info >> 1)];
+            if (year)
+                *year = FirstYear + static_cast<int>(estimate + isNext);
+            if (month)
+                *month = monthDay >> 8;
+            if (day)
+                *day = monthDay & 0xFF;
+            return true;
+        }
+
+        // Converts the civil date year-month-day to days since the epoch as ymdToDaysByFormula() does, and returns true, if year falls within the window and month is valid; otherwise, returns false.
+        XCLOX_CONSTEXPR14 bool ymdToDays(int year, int month, int day, long& dys) const
+        {
+            if (year < FirstYear || year > LastYear || month < 1 || month > 12)
+                return false;
+            const std::uint32_t info = m_years[year - FirstYear];
+            dys = m_firstDay + static_cast<long>(info >> 1) + m_monthStarts[info & 1][month - 1] + day - 1;
+            return true;
+        }
+
+    private:
+#ifdef XCLOX_HAS_CONSTEXPR14
+        friend struct StaticInstance<CivilTable>;
+#endif
+
+        static constexpr int YearCount = LastYear - FirstYear + 1;
+
+        XCLOX_CONSTEXPR14 CivilTable()
+            : m_firstDay(ymdToDaysByFormula(FirstYear, 1, 1).count())
+            , m_length(ymdToDaysByFormula(LastYear + 1, 1, 1).count() - m_firstDay)
+            , m_years()
+            , m_monthStarts()
+            , m_monthDays()
+        {
+            for (int i = 0; i <= YearCount; ++i) {
+                const long start = ymdToDaysByFormula(FirstYear + i, 1, 1).count() - m_firstDay;
+                const bool isLeap = ymdToDaysByFormula(FirstYear + i + 1, 1, 1).count() - m_firstDay - start == 366;
+                m_years[i] = static_cast<std::uint32_t>(start) << 1 | isLeap;
+            }
+            for (int isLeap = 0; isLeap < 2; ++isLeap) {
+                int doy = 0;
+                for (int m = 1; m <= 12; ++m) {
+                    m_monthStarts[isLeap][m - 1] = static_cast<std::int16_t>(doy);
+                    const int length = m == 2 ? 28 + isLeap : 30 + ((m + m / 8) & 1);
+                    for (int d = 1; d <= length; ++d)
+                        m_monthDays[isLeap][doy++] = static_cast<std::uint16_t>(m << 8 | d);
+                }
+                if (!isLeap)
+                    m_monthDays[isLeap][365] = 0; // no common year has the day.
+            }
+        }
+
+        long m_firstDay; // the days since the epoch of the first day of FirstYear.
+        long m_length; // the number of days of the window.
+        std::uint32_t m_years[YearCount + 1]; // the days from the first day of the window to the first day of every year, shifted left by one, with the lowest bit set if the year is a leap year; and the same for the year after LastYear.
+        std::int16_t m_monthStarts[2][12]; // the day of year of the first day of every month in common and leap years.
+        std::uint16_t m_monthDays[2][366]; // the month, shifted left by eight, and the day of month of every day of year in common and leap years.
+    };
+
+#ifndef XCLOX_CIVIL_TABLE_FIRST_YEAR
+    /// The first year of the window CivilTable converts, unless XCLOX_NO_CIVIL_TABLE is defined. It can be overridden by defining it before including xclox.
+#define XCLOX_CIVIL_TABLE_FIRST_YEAR 1900
+#endif
+
+#ifndef XCLOX_CIVIL_TABLE_LAST_YEAR
+    /// The last year of the window CivilTable converts. @see XCLOX_CIVIL_TABLE_FIRST_YEAR
+#define XCLOX_CIVIL_TABLE_LAST_YEAR 2200
+#endif
+
+    // Returns the days since the epoch of the civil date year-month-day, looked up in the CivilTable if the year falls within its window, and computed by ymdToDaysByFormula() otherwise.
+    inline XCLOX_CONSTEXPR14 Days ymdToDays(int year, int month, int day)
+    {
+#ifndef XCLOX_NO_CIVIL_TABLE
+        long dys = 0;
+        if (CivilTable<XCLOX_CIVIL_TABLE_FIRST_YEAR, XCLOX_CIVIL_TABLE_LAST_YEAR>::get().ymdToDays(year, month, day, dys))
+            return Days(dys);
+#endif
+        return ymdToDaysByFormula(year, month, day);
+    }
+
+    // Converts the day dys since the epoch to a civil date, looked up in the CivilTable if it falls within its window, and computed by daysToYmdByFormula() otherwise. Null pointers are ignored.
+    inline XCLOX_CONSTEXPR14 void daysToYmd(Days dys, int* year, int* month, int* day)
+    {
+#ifndef XCLOX_NO_CIVIL_TABLE
+        if (CivilTable<XCLOX_CIVIL_TABLE_FIRST_YEAR, XCLOX_CIVIL_TABLE_LAST_YEAR>::get().daysToYmd(dys.count(), year, month, day))
+            return;
+#endif
+        daysToYmdByFormula(dys, year, month, day);
+    }
+
+    // Converts the count days since the epoch in dys to civil dates, stored in year, month, and day, none of which may be null.
+    // Every day must be later than -2147468787, which internal::CivilDaysOffset explains. The leading days are converted with vector instructions if the CPU supports them, and the rest with the same math on unsigned 32-bit integers.
+    inline void daysToYmd(const std::int32_t* dys, size_t count, int* year, int* month, int* day)
+    {
+        for (size_t i = daysToYmdSimd(dys, count, year, month, day); i < count; ++i) {
+            const std::uint32_t z = static_cast<std::uint32_t>(dys[i]) + CivilDaysOffset;
+            const std::uint32_t era = z / 146097;
+            const std::uint32_t doe = z - era * 146097; // [0, 146096]
+            const std::uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365; // [0, 399]
+            const std::uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100); // [0, 365]
+            const std::uint32_t mp = (5 * doy + 2) / 153; // [0, 11]
+            const std::uint32_t m = mp < 10 ? mp + 3 : mp - 9; // [1, 12]
+            const int y = static_cast<int>(yoe + era * 400 + (m <= 2) - CivilYearOffset);
+            year[i] = y - (y < 1); // there is no year 0.
+            month[i] = static_cast<int>(m);
+            day[i] = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+        }
+    }
+
+    // Converts the count civil dates in year, month, and day to days since the epoch, stored in dys, as daysToYmd() above does in reverse.
+    // Every date must be valid and lie within the range daysToYmd() supports.
+    inline void ymdToDays(const int* year, const int* month, const int* day, size_t count, std::int32_t* dys)
+    {
+        for (size_t i = ymdToDaysSimd(year, month, day, count, dys); i < count; ++i) {
+            const std::uint32_t y = static_cast<std::uint32_t>(year[i] - (month[i] <= 2) + (year[i] < 1)) + CivilYearOffset;
+            const std::uint32_t m = static_cast<std::uint32_t>(month[i]);
+            const std::uint32_t era = y / 400;
+            const std::uint32_t yoe = y - era * 400; // [0, 399]
+            const std::uint32_t doy = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + static_cast<std::uint32_t>(day[i]) - 1; // [0, 365]
+            const std::uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy; // [0, 146096]
+            dys[i] = static_cast<std::int32_t>(era * 146097 + doe - CivilDaysOffset);
+        }
+    }
+
+    // Returns the day of week of the day dys since the epoch, from 1 (Monday) to 7 (Sunday). The epoch was a Thursday.
+    inline XCLOX_CONSTEXPR14 int dayOfWeek(Days dys)
+    {
+        return static_cast<int>((dys.count() % 7 + 10) % 7) + 1;
+    }
+
+    // Reads a number from at most count characters at input[pos], and advances pos by count. Returns false if there is no digit.
+    inline bool readFixedDigits(const char* input, size_t size, size_t count, size_t& pos, int& value)
+    {
+        size_t end = pos;
+        value = readDigits(input, size, end, count);
+        if (end == pos)
+            return false;
+        pos += count;
+        return true;
+    }
+
+    // Reads the date fields from the size characters at input according to format, as Date::fromChars() does, except that the fields are not validated. It neither throws nor allocates memory.
+    inline ParseResult parseDate(const char* input, size_t size, const Format& format, DateTimeFields& fields)
+    {
+        fields = { 1, 1, 1, 0, 0, 0, 0 };
+        size_t pos = 0;
+        for (const auto& token : format.tokens()) {
+            if (pos >= size)
+                break;
+
+            const size_t count = static_cast<size_t>(token.count);
+            const size_t start = pos;
+            int value = 0;
+            if (token.flag == 'y') {
+                if (count == 1) {
+                    if (!std::isdigit(static_cast<unsigned char>(input[pos])))
+                        return { ParseError::MissingValue, start };
+                    fields.year *= readDigits(input, size, pos, 4);
+                } else if (count == 2 || count == 4) {
+                    if (!readFixedDigits(input, size, count, pos, value))
+                        return { ParseError::MissingValue, start };
+                    fields.year = fields.year * value + (count == 2 ? 2000 : 0);
+                }
+            } else if (token.flag == 'M') {
+                if (count == 1) {
+                    if (!std::isdigit(static_cast<unsigned char>(input[pos])))
+                        return { ParseError::MissingValue, start };
+                    fields.month = readDigits(input, size, pos, 4);
+                } else if (count == 2) {
+                    if (!readFixedDigits(input, size, count, pos, fields.month))
+                        return { ParseError::MissingValue, start };
+                } else if (count == 3 || count == 4) {
+                    size_t length = 3;
+                    if (count == 4) {
+                        for (length = 0; pos + length < size && std::isalpha(static_cast<unsigned char>(input[pos + length]));)
+                            ++length;
+                    }
+                    const size_t index = lookup(count == 3 ? getShortMonthNameArray() : getLongMonthNameArray(), input + pos, input + std::min(size, pos + length));
+                    if (index == 12 || (count == 4 && getLongMonthNameArray()[index].size() != length))
+                        return { ParseError::MissingValue, start };
+                    fields.month = static_cast<int>(index + 1);
+                    pos += length;
+                }
+            } else if (token.flag == 'd') {
+                if (count == 1) {
+                    if (!std::isdigit(static_cast<unsigned char>(input[pos])))
+                        return { ParseError::MissingValue, start };
+                    fields.day = readDigits(input, size, pos, 2);
+                } else if (count == 2) {
+                    if (!readFixedDigits(input, size, count, pos, fields.day))
+                        return { ParseError::MissingValue, start };
+                } else if (count == 3) {
+                    // lets the format string and the date string be in sync.
+                    pos += count;
+                } else if (count == 4) {
+                    while (pos < size && std::isalpha(static_cast<unsigned char>(input[pos])))
+                        ++pos;
+                }
+            } else if (token.flag == '#' || token.flag == 'E') {
+                // the era flags are read once per character.
+                for (size_t i = 0; i < count && pos < size; ++i) {
+                    if (token.flag == '#') {
+                        if (input[pos] == '+' || input[pos] == '-') {
+                            fields.year = input[pos++] == '-' ? -1 : 1;
+                        }
+                    } else if (hasTextAt(input, size, pos, "CE", 2)) {
+                        fields.year = std::abs(fields.year);
+                        pos += 2;
+                    } else if (hasTextAt(input, size, pos, "BCE", 3)) {
+                        fields.year = -std::abs(fields.year);
+                        pos += 3;
+                    }
+                }
+            } else {
+                // not a pattern, skip it in the date string.
+                pos += count;
+            }
+        }
+        return { ParseError::None, std::min(pos, size) };
+    }
+
 } // namespace internal
 
 /**
@@ -131,6 +398,17 @@ public:
         December = 12
     };
 
+    /**
+     * @enum CalendarUnit
+     * Type of calendar unit, by which dates and datetimes are rounded. A week starts on Monday, as in ISO-8601, and a quarter starts in January, April, July, or October.
+     */
+    enum class CalendarUnit {
+        Week,
+        Month,
+        Quarter,
+        Year
+    };
+
     /// @}
 
     /**
@@ -139,7 +417,7 @@ public:
      */
 
     /// Constructs an invalid Date object with every field is set to zero. @see isValid()
-    Date()
+    XCLOX_CONSTEXPR14 Date()
         : m_year(0)
         , m_month(0)
         , m_day(0)
@@ -153,13 +431,16 @@ public:
     Date(Date&& other) = default;
 
     /// Constructs a Date object from \p days elapsed since the epoch "1970-01-01".
-    explicit Date(const Days& days)
+    XCLOX_CONSTEXPR14 explicit Date(const Days& days)
+        : m_year(0)
+        , m_month(0)
+        , m_day(0)
     {
         internal::daysToYmd(days, &m_year, &m_month, &m_day);
     }
 
     /// Constructs a Date object from the given \p year, \p month and \p day.
-    explicit Date(int year, int month, int day)
+    XCLOX_CONSTEXPR14 explicit Date(int year, int month, int day)
         : m_year(year)
         , m_month(month)
         , m_day(day)
@@ -190,37 +471,37 @@ public:
      */
 
     /// Returns whether this date is earlier than \p other.
-    bool operator<(const Date& other) const
+    XCLOX_CONSTEXPR14 bool operator<(const Date& other) const
     {
         return this->year() < other.year() || (this->year() == other.year() && this->month() < other.month()) || (this->year() == other.year() && this->month() == other.month() && this->day() < other.day());
     }
 
     /// Returns whether this date is earlier than \p other or equal to it.
-    bool operator<=(const Date& other) const
+    XCLOX_CONSTEXPR14 bool operator<=(const Date& other) const
     {
         return this->operator<(other) || this->operator==(other);
     }
 
     /// Returns whether this date is later than \p other.
-    bool operator>(const Date& other) const
+    XCLOX_CONSTEXPR14 bool operator>(const Date& other) const
     {
         return this->year() > other.year() || (this->year() == other.year() && this->month() > other.month()) || (this->year() == other.year() && this->month() == other.month() && this->day() > other.day());
     }
 
     /// Returns whether this date is later than \p other or equal to it.
-    bool operator>=(const Date& other) const
+    XCLOX_CONSTEXPR14 bool operator>=(const Date& other) const
     {
         return this->operator>(other) || this->operator==(other);
     }
 
     /// Returns whether this date is equal to \p other.
-    bool operator==(const Date& other) const
+    XCLOX_CONSTEXPR14 bool operator==(const Date& other) const
     {
         return this->year() == other.year() && this->month() == other.month() && this->day() == other.day();
     }
 
     /// Returns whether this date is different from \p other.
-    bool operator!=(const Date& other) const
+    XCLOX_CONSTEXPR14 bool operator!=(const Date& other) const
     {
         return this->year() != other.year() || this->month() != other.month() || this->day() != other.day();
     }
@@ -245,13 +526,13 @@ public:
      *    bool state4 = d.isValid(); // returns true
      * @endcode
      */
-    bool isValid() const
+    XCLOX_CONSTEXPR14 bool isValid() const
     {
         return m_year != 0 && (m_month > 0 && m_month < 13) && (m_day > 0 && m_day < (daysInMonthOfYear(m_year, m_month) + 1));
     }
 
     /// Set the year, month, and day of this date in the parameters \p year, \p month, and \p day, respectively.
-    void getYearMonthDay(int* year, int* month, int* day) const
+    XCLOX_CONSTEXPR14 void getYearMonthDay(int* year, int* month, int* day) const
     {
         if (year)
             *year = m_year;
@@ -262,13 +543,13 @@ public:
     }
 
     /// Returns the day of the month of this date as a number between 1 and 31.
-    int day() const
+    XCLOX_CONSTEXPR14 int day() const
     {
         return m_day;
     }
 
     /// Returns the month of the year of this date as a number between 1 and 12, which corresponds to the enumeration #Month.
-    int month() const
+    XCLOX_CONSTEXPR14 int month() const
     {
         return m_month;
     }
@@ -277,37 +558,37 @@ public:
      * Returns the year of this date as a number.
      * There is no year 0. Negative numbers indicate years before 1 BCE; for example, year -1 is year 1 BCE, and so on.
      */
-    int year() const
+    XCLOX_CONSTEXPR14 int year() const
     {
         return m_year;
     }
 
     /// Returns the weekday of this date as a number between 1 and 7, which corresponds to the enumeration #Weekday.
-    int dayOfWeek() const
+    XCLOX_CONSTEXPR14 int dayOfWeek() const
     {
-        return (toDaysSinceEpoch() % 7 + 3) % 7 + 1;
+        return internal::dayOfWeek(internal::Days(toDaysSinceEpoch()));
     }
 
     /// Returns the day of year of this date as a number between 1 and 365 (1 to 366 on leap years).
-    int dayOfYear() const
+    XCLOX_CONSTEXPR14 int dayOfYear() const
     {
         return toDaysSinceEpoch() - internal::ymdToDays(year(), 1, 1).count() + 1;
     }
 
     /// Returns the number of days in the month of this date. It ranges between 28 and 31.
-    int daysInMonth() const
+    XCLOX_CONSTEXPR14 int daysInMonth() const
     {
         return daysInMonthOfYear(year(), month());
     }
 
     /// Returns the number of days in the year of this date. It is either 365 or 366.
-    int daysInYear() const
+    XCLOX_CONSTEXPR14 int daysInYear() const
     {
         return (isLeapYear() ? 366 : 365);
     }
 
     /// Returns whether the year of this date is a leap year. @see isLeapYear(int)
-    bool isLeapYear() const
+    XCLOX_CONSTEXPR14 bool isLeapYear() const
     {
         return isLeapYear(year());
     }
@@ -403,17 +684,17 @@ public:
      */
 
     /// Returns the result of adding \p days to this date as a new Date object.
-    Date addDays(int days) const
+    XCLOX_CONSTEXPR14 Date addDays(int days) const
     {
-        int y, m, d;
+        int y = 0, m = 0, d = 0;
         internal::daysToYmd(Days(internal::ymdToDays(m_year, m_month, m_day) + Days(days)), &y, &m, &d);
         return Date(y, m, d);
     }
 
     /// Returns the result of subtracting \p days from this date as a new Date object.
-    Date subtractDays(int days) const
+    XCLOX_CONSTEXPR14 Date subtractDays(int days) const
     {
-        int y, m, d;
+        int y = 0, m = 0, d = 0;
         internal::daysToYmd(Days(internal::ymdToDays(m_year, m_month, m_day) - Days(days)), &y, &m, &d);
         return Date(y, m, d);
     }
@@ -426,7 +707,7 @@ public:
      *    Date d = Date(2013, 1, 31).addMonths(1); //d = Date(2013, 2, 28)
      * @endcode
      */
-    Date addMonths(int months) const
+    XCLOX_CONSTEXPR14 Date addMonths(int months) const
     {
         if (months < 0)
             return subtractMonths(-months);
@@ -448,12 +729,13 @@ public:
      *    Date d = Date(2012, 3, 31).subtractMonths(1); //d = Date(2012, 2, 29)
      * @endcode
      */
-    Date subtractMonths(int months) const
+    XCLOX_CONSTEXPR14 Date subtractMonths(int months) const
     {
         if (months < 0)
             return addMonths(-months);
 
-        const int newYear = m_year - (std::abs(m_month - months - 12) / 12);
+        const int span = m_month - months - 12;
+        const int newYear = m_year - ((span < 0 ? -span : span) / 12);
         const int newMonth = ((11 + m_month - (months % 12)) % 12) + 1;
         const int newDaysInMonth = daysInMonthOfYear(newYear, newMonth);
         const int newDays = newDaysInMonth < m_day ? newDaysInMonth : m_day;
@@ -462,14 +744,14 @@ public:
     }
 
     /// Returns the result of adding \p years to this date as a new Date object.
-    Date addYears(int years) const
+    XCLOX_CONSTEXPR14 Date addYears(int years) const
     {
         const int newYear = m_year + years;
         return Date(newYear > 0 ? newYear : newYear - 1, m_month, m_day);
     }
 
     /// Returns the result of subtracting \p years from this date as a new Date object.
-    Date subtractYears(int years) const
+    XCLOX_CONSTEXPR14 Date subtractYears(int years) const
     {
         const int newYear = m_year - years;
         return Date(newYear > 0 ? newYear : newYear - 1, m_month, m_day);
@@ -477,19 +759,103 @@ public:
 
     /// @}
 
+    /**
+     * @name Rounding Methods
+     * A date is rounded either to a calendar unit, or to a fixed number of days counted from the epoch "1970-01-01".
+     * round() returns the nearer of floor() and ceil(), and the later one if they are equally near.
+     * An invalid date, or a unit of less than one day, yields an invalid date.
+     * @{
+     */
+
+    /// Returns the first day of the calendar \p unit containing this date; e.g. the Monday of its week, or the first day of its month.
+    XCLOX_CONSTEXPR14 Date floor(CalendarUnit unit) const
+    {
+        if (!isValid())
+            return Date();
+        switch (unit) {
+        case CalendarUnit::Week:
+            return addDays(1 - dayOfWeek());
+        case CalendarUnit::Month:
+            return Date(m_year, m_month, 1);
+        case CalendarUnit::Quarter:
+            return Date(m_year, (m_month - 1) / 3 * 3 + 1, 1);
+        case CalendarUnit::Year:
+            return Date(m_year, 1, 1);
+        }
+        return Date();
+    }
+
+    /// Returns this date if it is the first day of a calendar \p unit, or the first day of the next one otherwise.
+    XCLOX_CONSTEXPR14 Date ceil(CalendarUnit unit) const
+    {
+        const Date first = floor(unit);
+        if (first == *this || !first.isValid())
+            return first;
+        const int nextYear = m_year == -1 ? 1 : m_year + 1; // there is no year 0.
+        switch (unit) {
+        case CalendarUnit::Week:
+            return first.addDays(7);
+        case CalendarUnit::Month:
+            return m_month == 12 ? Date(nextYear, 1, 1) : Date(m_year, m_month + 1, 1);
+        case CalendarUnit::Quarter:
+            return first.m_month == 10 ? Date(nextYear, 1, 1) : Date(m_year, first.m_month + 3, 1);
+        case CalendarUnit::Year:
+            return Date(nextYear, 1, 1);
+        }
+        return Date();
+    }
+
+    /// Returns the nearer of floor() and ceil() for the calendar \p unit.
+    XCLOX_CONSTEXPR14 Date round(CalendarUnit unit) const
+    {
+        const Date first = floor(unit);
+        if (first == *this || !first.isValid())
+            return first;
+        const Date next = ceil(unit);
+        return daysBetween(first, *this) < daysBetween(*this, next) ? first : next;
+    }
+
+    /// Returns the latest date not later than this date whose days since the epoch are a multiple of \p unit. Weeks counted this way start on Thursday, as the epoch did; see floor(CalendarUnit) for weeks starting on Monday.
+    XCLOX_CONSTEXPR14 Date floor(const Days& unit) const
+    {
+        if (!isValid() || unit.count() < 1)
+            return Date();
+        return Date(Days(toDaysSinceEpoch() - remainderSinceEpoch(unit.count())));
+    }
+
+    /// Returns the earliest date not earlier than this date whose days since the epoch are a multiple of \p unit.
+    XCLOX_CONSTEXPR14 Date ceil(const Days& unit) const
+    {
+        if (!isValid() || unit.count() < 1)
+            return Date();
+        const long remainder = remainderSinceEpoch(unit.count());
+        return remainder == 0 ? *this : Date(Days(toDaysSinceEpoch() - remainder + unit.count()));
+    }
+
+    /// Returns the nearer of floor() and ceil() for the fixed \p unit.
+    XCLOX_CONSTEXPR14 Date round(const Days& unit) const
+    {
+        if (!isValid() || unit.count() < 1)
+            return Date();
+        const long remainder = remainderSinceEpoch(unit.count());
+        return Date(Days(toDaysSinceEpoch() - remainder + (remainder < unit.count() - remainder ? 0 : unit.count())));
+    }
+
+    /// @}
+
     /**
      * @name Conversion Methods
      * @{
      */
 
     /// Returns the number of elapsed days since the epoch "1970-01-01".
-    long toDaysSinceEpoch() const
+    XCLOX_CONSTEXPR14 long toDaysSinceEpoch() const
     {
         return internal::ymdToDays(year(), month(), day()).count();
     }
 
     /// Returns the elapsed time since the epoch "1970-01-01" as a #Days duration.
-    Days toStdDurationSinceEpoch() const
+    XCLOX_CONSTEXPR14 Days toStdDurationSinceEpoch() const
     {
         return Days(toDaysSinceEpoch());
     }
@@ -500,7 +866,7 @@ public:
      * Note that the date to be converted is considered Gregorian. Also, the current Gregorian rules are extended backwards and forwards.
      * There is no year 0. The first year before the common era (i.e., year 1 BCE) is year -1, year -2 is year 2 BCE, and so on.
      */
-    long toJulianDay() const
+    XCLOX_CONSTEXPR14 long toJulianDay() const
     {
         return toDaysSinceEpoch() + 2440588;
     }
@@ -530,62 +896,51 @@ public:
      * @see dayOfWeekName(), monthName()
      */
     std::string toString(const std::string& format) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /// Returns this date as a string, formatted according to the precompiled format \p format. See toString(const std::string&) for information about the format patterns.
+    std::string toString(const Format& format) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /**
+     * Writes this date formatted according to the format string \p format into the character range [\p first, \p last), and returns the length of the formatted date.
+     * The format patterns are the same patterns used in the method toString(). @see toString()
+     *
+     * This method never allocates memory. If the range is too small, only the characters that fit are written, but the full length is still returned, as std::snprintf() does. For example:
+     *
+     * @code
+     *    char buffer[16];
+     *    size_t length = Date(2017, 12, 15).toChars(buffer, buffer + sizeof(buffer), "yyyy-MM-dd"); // length = 10, buffer = "2017-12-15"
+     * @endcode
+     *
+     * If this date is invalid, nothing is written and zero is returned.
+     */
+    size_t toChars(char* first, char* last, const char* format) const
+    {
+        return toChars(first, last, format, std::strlen(format));
+    }
+
+    /// Writes this date formatted according to the format string \p format into the character range [\p first, \p last). @see toChars(char*, char*, const char*)
+    size_t toChars(char* first, char* last, const std::string& format) const
+    {
+        return toChars(first, last, format.data(), format.size());
+    }
+
+    /// Writes this date formatted according to the precompiled format \p format into the character range [\p first, \p last). @see toChars(char*, char*, const char*)
+    size_t toChars(char* first, char* last, const Format& format) const
     {
         if (!isValid())
-            return std::string();
-
-        std::stringstream output;
-
-        for (size_t pos = 0; pos < format.size(); ++pos) {
-            int y, m, d;
-            getYearMonthDay(&y, &m, &d);
-            y = std::abs(y);
-
-            char currChar = format[pos];
-            const int charCount = internal::countIdenticalCharsFrom(pos, format);
-
-            if (currChar == '#') {
-                output << (year() < 0 ? "-" : "+");
-            } else if (currChar == 'y') {
-                if (charCount == 1) {
-                    output << y;
-                } else if (charCount == 2) {
-                    y = y - ((y / 100) * 100);
-                    output << std::setfill('0') << std::setw(2) << y;
-                } else if (charCount == 4) {
-                    output << std::setfill('0') << std::setw(4) << y;
-                }
-                pos += charCount - 1; // skip all identical characters except the last.
-            } else if (currChar == 'M') {
-                if (charCount == 1) {
-                    output << m;
-                } else if (charCount == 2) {
-                    output << std::setfill('0') << std::setw(2) << m;
-                } else if (charCount == 3) {
-                    output << monthName(true);
-                } else if (charCount == 4) {
-                    output << monthName(false);
-                }
-                pos += charCount - 1; // skip all identical characters except the last.
-            } else if (currChar == 'd') {
-                if (charCount == 1) {
-                    output << d;
-                } else if (charCount == 2) {
-                    output << std::setfill('0') << std::setw(2) << d;
-                } else if (charCount == 3) {
-                    output << dayOfWeekName(true);
-                } else if (charCount == 4) {
-                    output << dayOfWeekName(false);
-                }
-                pos += charCount - 1; // skip all identical characters except the last.
-            } else if (currChar == 'E') {
-                output << (year() < 0 ? "BCE" : "CE");
-            } else {
-                output << currChar;
-            }
-        }
+            return 0;
 
-        return output.str();
+        internal::CharWriter output(first, last);
+        for (const auto& token : format.tokens()) {
+            write(output, token);
+        }
+        return output.size();
     }
 
     /// @}
@@ -600,7 +955,7 @@ public:
     }
 
     /// Returns a Date object set to the epoch "1970-01-01".
-    static Date epoch()
+    static XCLOX_CONSTEXPR14 Date epoch()
     {
         return Date(Days(0));
     }
@@ -611,81 +966,42 @@ public:
      */
     static Date fromString(const std::string& date, const std::string& format)
     {
-        int _year = 1, _month = 1, _day = 1;
+        return fromString(date, Format(format));
+    }
 
-        for (size_t fmtPos = 0, datPos = 0; fmtPos < format.size() && datPos < date.size(); ++fmtPos) {
-            const size_t charCount = static_cast<size_t>(internal::countIdenticalCharsFrom(fmtPos, format));
+    /// Returns a Date object from the date string \p date according to the precompiled format \p format. @see fromString(const std::string&, const std::string&)
+    static Date fromString(const std::string& date, const Format& format)
+    {
+        Date result;
+        fromChars(date.data(), date.data() + date.size(), format, result);
+        return result;
+    }
 
-            if (format[fmtPos] == '#') {
-                if (date[datPos] == '+') {
-                    _year = 1;
-                    ++datPos;
-                } else if (date[datPos] == '-') {
-                    _year = -1;
-                    ++datPos;
-                }
-            } else if (format[fmtPos] == 'y') {
-                if (charCount == 1) {
-                    _year = _year * internal::readIntAndAdvancePos(date, datPos, 4);
-                } else if (charCount == 2) {
-                    _year = _year * std::stoi(date.substr(datPos, charCount));
-                    _year += 2000;
-                    datPos += charCount;
-                } else if (charCount == 4) {
-                    _year = _year * std::stoi(date.substr(datPos, charCount));
-                    datPos += charCount;
-                }
-                fmtPos += charCount - 1; // skip all identical characters except the last.
-            } else if (format[fmtPos] == 'E') {
-                if (date.substr(datPos, 2) == "CE") {
-                    _year = std::abs(_year);
-                    datPos += 2;
-                } else if (date.substr(datPos, 3) == "BCE") {
-                    _year = -std::abs(_year);
-                    datPos += 3;
-                }
-            } else if (format[fmtPos] == 'M') {
-                if (charCount == 1) {
-                    _month = internal::readIntAndAdvancePos(date, datPos, 4);
-                } else if (charCount == 2) {
-                    _month = std::stoi(date.substr(datPos, charCount));
-                    datPos += charCount;
-                } else if (charCount == 3) {
-                    _month = internal::getShortMonthNumber(date.substr(datPos, charCount));
-                    datPos += charCount;
-                } else if (charCount == 4) {
-                    size_t newPos = datPos;
-                    while (newPos < date.size() && std::isalpha(date[newPos]))
-                        ++newPos;
-                    _month = internal::getLongMonthNumber(date.substr(datPos, newPos - datPos));
-                    datPos = newPos;
-                }
-                fmtPos += charCount - 1; // skip all identical characters except the last.
-            } else if (format[fmtPos] == 'd') {
-                if (charCount == 1) {
-                    _day = internal::readIntAndAdvancePos(date, datPos, 2);
-                } else if (charCount == 2) {
-                    _day = std::stoi(date.substr(datPos, charCount));
-                    datPos += charCount;
-                } else if (charCount == 3) {
-                    // lets the format string and the date string be in sync.
-                    datPos += charCount;
-                } else if (charCount == 4) {
-                    while (datPos < date.size() && std::isalpha(date[datPos]))
-                        ++datPos;
-                }
-                fmtPos += charCount - 1; // skip all identical characters except the last.
-            } else {
-                // not a pattern, skip it in the date string.
-                ++datPos;
-            }
+    /**
+     * Parses the characters in the range [\p first, \p last), formatted according to the precompiled format \p format, into \p date as fromString() does, but without throwing exceptions or allocating memory.
+     * If parsing fails, \p date is set to an invalid Date object, and the returned ParseResult tells why and at which offset into the characters.
+     */
+    static ParseResult fromChars(const char* first, const char* last, const Format& format, Date& date)
+    {
+        internal::DateTimeFields fields;
+        ParseResult result = internal::parseDate(first, static_cast<size_t>(last - first), format, fields);
+        date = result ? Date(fields.year, fields.month, fields.day) : Date();
+        if (result && !date.isValid()) {
+            result.error = ParseError::InvalidValue;
         }
+        return result;
+    }
 
-        return Date(_year, _month, _day);
+#ifdef XCLOX_HAS_STRING_VIEW
+    /// Parses the string view \p input into \p date. Available since C++17. @see fromChars(const char*, const char*, const Format&, Date&)
+    static ParseResult fromChars(std::string_view input, const Format& format, Date& date)
+    {
+        return fromChars(input.data(), input.data() + input.size(), format, date);
     }
+#endif
 
     /// Returns a Date object corresponding to the Julian day \p julianDay. @see toJulianDay()
-    static Date fromJulianDay(long julianDay)
+    static XCLOX_CONSTEXPR14 Date fromJulianDay(long julianDay)
     {
         return Date(Days(julianDay - 2440588));
     }
@@ -704,7 +1020,7 @@ public:
      *    int num = Date::daysBetween(Date(1999, 1, 1), Date(1999, 1, 3));  // num = 2
      * @endcode
      */
-    static long daysBetween(const Date& from, const Date& to)
+    static XCLOX_CONSTEXPR14 long daysBetween(const Date& from, const Date& to)
     {
         return to.toDaysSinceEpoch() - from.toDaysSinceEpoch();
     }
@@ -716,7 +1032,7 @@ public:
      *    int num = Date::weeksBetween(Date(1970, 1, 1), Date(1970, 1, 8));  // num = 1
      * @endcode
      */
-    static long weeksBetween(const Date& from, const Date& to)
+    static XCLOX_CONSTEXPR14 long weeksBetween(const Date& from, const Date& to)
     {
         return daysBetween(from, to) / 7;
     }
@@ -731,7 +1047,7 @@ public:
      * 1900 was not a leap year, as it is divisible by 100.
      * However, 2000 was a leap year, as it is divisible by 400.
      */
-    static bool isLeapYear(int year)
+    static XCLOX_CONSTEXPR14 bool isLeapYear(int year)
     {
         // no year 0 in the Gregorian calendar, the first year before the common era is -1 (year 1 BCE). So, -1, -5, -9 etc are leap years.
         if (year < 1)
@@ -741,7 +1057,7 @@ public:
     }
 
     /// Returns the number of days in \p month of \p year. It ranges between 28 and 31.
-    static int daysInMonthOfYear(int year, int month)
+    static XCLOX_CONSTEXPR14 int daysInMonthOfYear(int year, int month)
     {
         switch (month) {
 
@@ -775,6 +1091,69 @@ public:
     }
 
 private:
+    // Returns the days since the epoch modulo unit, from 0 to unit - 1.
+    XCLOX_CONSTEXPR14 long remainderSinceEpoch(long unit) const
+    {
+        const long remainder = toDaysSinceEpoch() % unit;
+        return remainder < 0 ? remainder + unit : remainder;
+    }
+
+    size_t toChars(char* first, char* last, const char* format, size_t size) const
+    {
+        if (!isValid())
+            return 0;
+
+        internal::CharWriter output(first, last);
+        for (size_t pos = 0; pos < size;) {
+            const auto& token = Format::tokenAt(format, size, pos);
+            write(output, token);
+            pos += static_cast<size_t>(token.count);
+        }
+        return output.size();
+    }
+
+    void write(internal::CharWriter& output, const Format::Token& token) const
+    {
+        const unsigned y = static_cast<unsigned>(std::abs(m_year));
+
+        if (token.flag == 'y') {
+            if (token.count == 1) {
+                output.writeInt(y, 1);
+            } else if (token.count == 2) {
+                output.writeInt(y % 100, 2);
+            } else if (token.count == 4) {
+                output.writeInt(y, 4);
+            }
+        } else if (token.flag == 'M') {
+            if (token.count == 1 || token.count == 2) {
+                output.writeInt(static_cast<unsigned>(m_month), token.count);
+            } else if (token.count == 3) {
+                output.write(internal::getShortMonthNameArray()[m_month - 1]);
+            } else if (token.count == 4) {
+                output.write(internal::getLongMonthNameArray()[m_month - 1]);
+            }
+        } else if (token.flag == 'd') {
+            if (token.count == 1 || token.count == 2) {
+                output.writeInt(static_cast<unsigned>(m_day), token.count);
+            } else if (token.count == 3) {
+                output.write(internal::getShortWeekdayNameArray()[dayOfWeek() - 1]);
+            } else if (token.count == 4) {
+                output.write(internal::getLongWeekdayNameArray()[dayOfWeek() - 1]);
+            }
+        } else {
+            // the era flags and unrecognized characters are written once per character.
+            for (int i = 0; i < token.count; ++i) {
+                if (token.flag == '#') {
+                    output.write(m_year < 0 ? '-' : '+');
+                } else if (token.flag == 'E') {
+                    output.write(m_year < 0 ? "BCE" : "CE", m_year < 0 ? 3 : 2);
+                } else {
+                    output.write(token.flag);
+                }
+            }
+        }
+    }
+
     int m_year;
     int m_month;
     int m_day;
@@ -812,6 +1191,55 @@ std::istream& operator>>(std::istream& is, Date& d)
 
 /// @}
 
+namespace internal {
+
+    // The year of a date literal, such as 2024_y, waiting for its month.
+    struct LiteralYear {
+        int year;
+    };
+
+    // The year and month of a date literal, such as 2024_y/3, waiting for its day.
+    struct LiteralYearMonth {
+        int year;
+        int month;
+    };
+
+} // namespace internal
+
+/**
+ * @brief The user-defined literals of dates, which are brought into scope by `using namespace xclox::literals;`.
+ *
+ * A date literal is written as a year literal followed by the month and the day, separated by slashes; e.g. `2024_y/3/1` or `2024_y/Date::Month::March/1`.
+ * Under C++14 and later, it is a constant expression.
+ */
+namespace literals {
+
+    /// Returns the year \p year of a date literal.
+    constexpr internal::LiteralYear operator"" _y(unsigned long long year)
+    {
+        return internal::LiteralYear { static_cast<int>(year) };
+    }
+
+    /// Returns year \p y followed by month \p month of a date literal.
+    constexpr internal::LiteralYearMonth operator/(internal::LiteralYear y, int month)
+    {
+        return internal::LiteralYearMonth { y.year, month };
+    }
+
+    /// Returns year \p y followed by month \p month of a date literal.
+    constexpr internal::LiteralYearMonth operator/(internal::LiteralYear y, Date::Month month)
+    {
+        return internal::LiteralYearMonth { y.year, static_cast<int>(month) };
+    }
+
+    /// Returns the date of year-month \p ym and day \p day. The date is not checked; see Date::isValid().
+    inline XCLOX_CONSTEXPR14 Date operator/(internal::LiteralYearMonth ym, int day)
+    {
+        return Date(ym.year, ym.month, day);
+    }
+
+} // namespace literals
+
 } // namespace xclox
 
 #endif // XCLOX_DATE_HPP
@@ -9,12 +9,250 @@
 #define XCLOX_DATE_TIME_HPP
 
 #include "date.hpp"
+#include "simd.hpp"
 #include "time.hpp"
 
 #include <cmath>
+#include <cstdint>
+#include <limits>
 
 namespace xclox {
 
+namespace internal {
+
+    // Reads the first keyword found in [first, last), ignoring case, and advances pos by its length. The value is the keyword's one-based index.
+    template <size_t S>
+    inline bool readKeyword(const std::array<std::string, S>& keywordArray, const char* first, const char* last, size_t& pos, int& value)
+    {
+        const size_t index = search(keywordArray, first, last);
+        if (index == S)
+            return false;
+        pos += keywordArray[index].size();
+        value = static_cast<int>(index + 1);
+        return true;
+    }
+
+    // Reads the value of the pattern flag repeated count times at input[pos], and advances pos past it. Returns false if the value is missing.
+    inline bool readDateTimeToken(const char* input, size_t size, char flag, size_t count, size_t& pos, int& value)
+    {
+        if (flag == 'y' || ((flag == 'M' || flag == 'd' || flag == 'h' || flag == 'H' || flag == 'm' || flag == 's') && count <= 2) || flag == 'f') {
+            if (pos < size && std::isdigit(static_cast<unsigned char>(input[pos]))) {
+                value = readDigits(input, size, pos, flag == 'f' ? count : ((flag == 'y' && count == 1) || count == 4 ? 4 : 2));
+                return true;
+            }
+        } else if (flag == '#') {
+            if (pos < size && (input[pos] == '-' || input[pos] == '+')) {
+                value = input[pos++] == '-' ? -1 : 1;
+                return true;
+            }
+        } else if (flag == 'E') {
+            if (pos + 2 < size && std::equal(input + pos, input + pos + 3, "BCE")) {
+                pos += 3;
+                value = -1;
+                return true;
+            } else if (pos + 1 < size && std::equal(input + pos, input + pos + 2, "CE")) {
+                pos += 2;
+                value = 1;
+                return true;
+            }
+        } else if ((flag == 'M' || flag == 'd') && count <= 4 && pos + 2 < size) {
+            const char* first = input + pos;
+            const char* last = count == 3 ? first + 3 : input + size;
+            if (flag == 'M') {
+                return count == 3 ? readKeyword(getShortMonthNameArray(), first, last, pos, value) : readKeyword(getLongMonthNameArray(), first, last, pos, value);
+            } else {
+                return count == 3 ? readKeyword(getShortWeekdayNameArray(), first, last, pos, value) : readKeyword(getLongWeekdayNameArray(), first, last, pos, value);
+            }
+        } else if ((flag == 'a' || flag == 'A') && pos + 1 < size) {
+            if ((flag == 'a' && std::equal(input + pos, input + pos + 2, "am")) || std::equal(input + pos, input + pos + 2, "AM")) {
+                pos += 2;
+                value = -12;
+                return true;
+            } else if ((flag == 'a' && std::equal(input + pos, input + pos + 2, "pm")) || std::equal(input + pos, input + pos + 2, "PM")) {
+                pos += 2;
+                value = 12;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reads the datetime fields from the size characters at input according to format, as DateTime::fromChars() does, except that the fields are not validated. It neither throws nor allocates memory.
+    inline ParseResult parseDateTime(const char* input, size_t size, const Format& format, DateTimeFields& fields)
+    {
+        int sign = 1;
+        fields = { 0, 1, 1, 0, 0, 0, 0 };
+        size_t pos = 0;
+        for (const auto& token : format.tokens()) {
+            const auto count = static_cast<size_t>(token.count);
+            if (!token.isFlag) {
+                pos += count;
+                continue;
+            }
+            int value = 0;
+            if (!token.isPattern) {
+                return { ParseError::InvalidPattern, std::min(pos, size) };
+            }
+            if (!readDateTimeToken(input, size, token.flag, count, pos, value)) {
+                return { ParseError::MissingValue, std::min(pos, size) };
+            }
+            switch (token.flag) {
+            case 'y':
+                fields.year = value;
+                break;
+            case '#':
+            case 'E':
+                sign = value;
+                break;
+            case 'M':
+                fields.month = value;
+                break;
+            case 'd':
+                if (count != 3) {
+                    fields.day = value;
+                }
+                break;
+            case 'h':
+            case 'H':
+                fields.hour = value;
+                break;
+            case 'a':
+            case 'A':
+                fields.hour += (value == -12 && fields.hour >= 12) || (value == 12 && fields.hour < 12) ? value : 0;
+                break;
+            case 'm':
+                fields.minute = value;
+                break;
+            case 's':
+                fields.second = value;
+                break;
+            case 'f':
+                fields.nanosecond = value * getPowerOfTen(9 - static_cast<int>(count));
+                break;
+            }
+        }
+        fields.year *= sign;
+        return { ParseError::None, std::min(pos, size) };
+    }
+
+    // Writes the token of a format for the datetime of fields, whose day of week is dayOfWeek, as DateTime::toString() does.
+    inline void writeDateTime(CharWriter& output, const Format::Token& token, const DateTimeFields& fields, int dayOfWeek)
+    {
+        const char flag = token.flag;
+        const int count = token.count;
+        if (!token.isPattern) {
+            output.write(flag, static_cast<size_t>(count));
+        } else if (flag == '#') {
+            output.write(fields.year < 0 ? '-' : '+');
+        } else if (flag == 'E') {
+            output.write(fields.year < 0 ? "BCE" : "CE", fields.year < 0 ? 3 : 2);
+        } else if (flag == 'y') {
+            const unsigned y = static_cast<unsigned>(std::abs(fields.year));
+            output.writeInt(count == 1 ? y : count == 2 ? y % 100 : y % 10000, count);
+        } else if (flag == 'M') {
+            if (count == 1 || count == 2) {
+                output.writeInt(static_cast<unsigned>(fields.month), count);
+            } else {
+                output.write(count == 3 ? getShortMonthNameArray()[fields.month - 1] : getLongMonthNameArray()[fields.month - 1]);
+            }
+        } else if (flag == 'd') {
+            if (count == 1 || count == 2) {
+                output.writeInt(static_cast<unsigned>(fields.day), count);
+            } else {
+                output.write(count == 3 ? getShortWeekdayNameArray()[dayOfWeek - 1] : getLongWeekdayNameArray()[dayOfWeek - 1]);
+            }
+        } else if (flag == 'h') {
+            output.writeInt(static_cast<unsigned>(fields.hour), count);
+        } else if (flag == 'H') {
+            const int h = fields.hour;
+            output.writeInt(static_cast<unsigned>(h == 0 ? 12 : h > 12 ? h - 12 : h), count);
+        } else if (flag == 'm') {
+            output.writeInt(static_cast<unsigned>(fields.minute), count);
+        } else if (flag == 's') {
+            output.writeInt(static_cast<unsigned>(fields.second), count);
+        } else if (flag == 'f') {
+            output.writeInt(static_cast<unsigned long long>(fields.nanosecond / getPowerOfTen(9 - count)), count);
+        } else if (flag == 'a') {
+            output.write(fields.hour < 12 ? "am" : "pm", 2);
+        } else if (flag == 'A') {
+            output.write(fields.hour < 12 ? "AM" : "PM", 2);
+        }
+    }
+
+    constexpr std::int64_t NanosecondsPerDay = 86400000000000LL;
+
+    // Stores the ticks since the epoch of timeOfDay ticks into the day days since the epoch, where a day has ticksPerDay ticks. Returns false if they do not fit in Rep.
+    template <typename Rep>
+    inline bool toTicksSinceEpoch(long days, std::int64_t ticksPerDay, std::int64_t timeOfDay, Rep& ticks)
+    {
+        const std::int64_t max = std::numeric_limits<Rep>::max();
+        const std::int64_t min = std::numeric_limits<Rep>::min();
+        if (days >= 0) {
+            if (days > max / ticksPerDay || timeOfDay > max - days * ticksPerDay)
+                return false;
+            ticks = static_cast<Rep>(days * ticksPerDay + timeOfDay);
+        } else {
+            // The start of the earliest representable day is out of range, so count from the end of the day instead.
+            if (days + 1 < min / ticksPerDay || timeOfDay - ticksPerDay < min - (days + 1) * ticksPerDay)
+                return false;
+            ticks = static_cast<Rep>((days + 1) * ticksPerDay + (timeOfDay - ticksPerDay));
+        }
+        return true;
+    }
+
+    // Stores the nanoseconds since the epoch of timeOfDay nanoseconds into the day days since the epoch. Returns false if they do not fit in a signed 64-bit integer.
+    inline bool toNanosecondsSinceEpoch(long days, std::int64_t timeOfDay, std::int64_t& nanoseconds)
+    {
+        return toTicksSinceEpoch(days, NanosecondsPerDay, timeOfDay, nanoseconds);
+    }
+
+    // Returns a * b modulo m, for a and b less than m, without overflow.
+    inline XCLOX_CONSTEXPR14 std::uint64_t multiplyModulo(std::uint64_t a, std::uint64_t b, std::uint64_t m)
+    {
+        std::uint64_t result = 0;
+        for (; b != 0; b >>= 1) {
+            if (b & 1)
+                result = result >= m - a ? result - (m - a) : result + a;
+            a = a >= m - a ? a - (m - a) : a + a;
+        }
+        return result;
+    }
+
+    // Returns the nanoseconds since the epoch of timeOfDay nanoseconds into the day days since the epoch, modulo unit, from 0 to unit - 1, without computing the nanoseconds themselves, which may not fit in 64 bits.
+    inline XCLOX_CONSTEXPR14 std::int64_t remainderSinceEpoch(long days, std::int64_t timeOfDay, std::int64_t unit)
+    {
+        if (NanosecondsPerDay % unit == 0)
+            return timeOfDay % unit;
+        if (unit % NanosecondsPerDay == 0) {
+            const std::int64_t dayCount = unit / NanosecondsPerDay;
+            const std::int64_t remainder = days % dayCount;
+            return (remainder < 0 ? remainder + dayCount : remainder) * NanosecondsPerDay + timeOfDay;
+        }
+        const std::int64_t remainder = days % unit;
+        const std::uint64_t dayRemainder = multiplyModulo(static_cast<std::uint64_t>(remainder < 0 ? remainder + unit : remainder), static_cast<std::uint64_t>(NanosecondsPerDay % unit), static_cast<std::uint64_t>(unit));
+        return static_cast<std::int64_t>((dayRemainder + static_cast<std::uint64_t>(timeOfDay % unit)) % static_cast<std::uint64_t>(unit));
+    }
+
+    // Converts fields to ticks since the epoch, where a tick is nanosecondsPerTick nanoseconds, with the validation rules of Date::isValid() and Time::isValid(). The subseconds finer than a tick are truncated. Returns false if the fields are invalid or out of the range of Rep.
+    template <typename Rep>
+    inline bool fieldsToTicksSinceEpoch(const DateTimeFields& fields, std::int64_t nanosecondsPerTick, Rep& ticks)
+    {
+        if (!Date(fields.year, fields.month, fields.day).isValid())
+            return false;
+        const std::int64_t timeOfDay = ((fields.hour * 60LL + fields.minute) * 60LL + fields.second) * 1000000000LL + fields.nanosecond;
+        if (timeOfDay < 0 || timeOfDay >= NanosecondsPerDay)
+            return false;
+        return toTicksSinceEpoch(ymdToDays(fields.year, fields.month, fields.day).count(), NanosecondsPerDay / nanosecondsPerTick, timeOfDay / nanosecondsPerTick, ticks);
+    }
+
+    // Converts fields to nanoseconds since the epoch with the validation rules of Date::isValid() and Time::isValid(). Returns false if they are invalid or out of the 64-bit range.
+    inline bool fieldsToNanosecondsSinceEpoch(const DateTimeFields& fields, std::int64_t& nanoseconds)
+    {
+        return fieldsToTicksSinceEpoch(fields, 1, nanoseconds);
+    }
+
+} // namespace internal
+
 /**
  * @class DateTime
  *
@@ -71,6 +309,7 @@ public:
 
     using Weekday = Date::Weekday; ///< Weekday enumeration.
     using Month = Date::Month; ///< Month enumeration.
+    using CalendarUnit = Date::CalendarUnit; ///< Calendar unit enumeration.
 
     /// @}
 
@@ -92,11 +331,11 @@ public:
      * Constructs a DateTime object from \p duration since the epoch "1970-01-01 00:00:00 UTC".
      * The constructed datetime has whatever precision it is given, down to nanoseconds.
      */
-    explicit DateTime(const Duration& duration)
+    XCLOX_CONSTEXPR14 explicit DateTime(const Duration& duration)
     {
         const auto& subDay = duration % Days(1);
         const auto& floatingDay = Days(duration.count() < 0 && subDay.count() != 0 ? 1 : 0);
-        m_date = Date(std::chrono::duration_cast<Days>(duration - floatingDay));
+        m_date = Date(std::chrono::duration_cast<Days>(duration) - floatingDay);
         m_time = Time(subDay + floatingDay);
     }
 
@@ -107,14 +346,14 @@ public:
     }
 
     /// Constructs a DateTime object from \p date, leaving the time part at midnight ("00:00:00").
-    explicit DateTime(const Date& date)
+    XCLOX_CONSTEXPR14 explicit DateTime(const Date& date)
         : m_date(date)
         , m_time(Nanoseconds::zero())
     {
     }
 
     /// Constructs a DateTime object from \p date and \p time.
-    explicit DateTime(const Date& date, const Time& time)
+    XCLOX_CONSTEXPR14 explicit DateTime(const Date& date, const Time& time)
         : m_date(date)
         , m_time(time)
     {
@@ -144,37 +383,37 @@ public:
      */
 
     /// Returns whether this datetime is earlier than \p other.
-    bool operator<(const DateTime& other) const
+    XCLOX_CONSTEXPR14 bool operator<(const DateTime& other) const
     {
         return (this->m_date < other.m_date) || (this->m_date == other.m_date && this->m_time < other.m_time);
     }
 
     /// Returns whether this datetime is earlier than \p other or equal to it.
-    bool operator<=(const DateTime& other) const
+    XCLOX_CONSTEXPR14 bool operator<=(const DateTime& other) const
     {
-        return (this->m_date <= other.m_date) || (this->m_date == other.m_date && this->m_time <= other.m_time);
+        return (this->m_date < other.m_date) || (this->m_date == other.m_date && this->m_time <= other.m_time);
     }
 
     /// Returns whether this datetime is later than \p other.
-    bool operator>(const DateTime& other) const
+    XCLOX_CONSTEXPR14 bool operator>(const DateTime& other) const
     {
         return (this->m_date > other.m_date) || (this->m_date == other.m_date && this->m_time > other.m_time);
     }
 
     /// Returns whether this datetime is later than \p other or equal to it.
-    bool operator>=(const DateTime& other) const
+    XCLOX_CONSTEXPR14 bool operator>=(const DateTime& other) const
     {
-        return (this->m_date >= other.m_date) || (this->m_date == other.m_date && this->m_time >= other.m_time);
+        return (this->m_date > other.m_date) || (this->m_date == other.m_date && this->m_time >= other.m_time);
     }
 
     /// Returns whether this datetime is equal to \p other.
-    bool operator==(const DateTime& other) const
+    XCLOX_CONSTEXPR14 bool operator==(const DateTime& other) const
     {
         return this->m_date == other.m_date && this->m_time == other.m_time;
     }
 
     /// Returns whether this datetime is different from \p other.
-    bool operator!=(const DateTime& other) const
+    XCLOX_CONSTEXPR14 bool operator!=(const DateTime& other) const
     {
         return this->m_date != other.m_date || this->m_time != other.m_time;
     }
@@ -187,19 +426,19 @@ public:
      */
 
     /// Returns the result of subtracting \p other from this datetime as #Nanoseconds duration.
-    Nanoseconds operator-(const DateTime& other) const
+    XCLOX_CONSTEXPR14 Nanoseconds operator-(const DateTime& other) const
     {
         return this->toStdDurationSinceEpoch() - other.toStdDurationSinceEpoch();
     }
 
     /// Returns the result of subtracting \p duration from this datetime as a new DateTime object.
-    DateTime operator-(const Duration& duration) const
+    XCLOX_CONSTEXPR14 DateTime operator-(const Duration& duration) const
     {
         return subtractDuration(duration);
     }
 
     /// Returns the result of adding \p duration to this datetime as a new DateTime object.
-    DateTime operator+(const Duration& duration) const
+    XCLOX_CONSTEXPR14 DateTime operator+(const Duration& duration) const
     {
         return addDuration(duration);
     }
@@ -211,109 +450,109 @@ public:
      */
 
     /// Returns whether this datetime object represents a valid datetime. A DateTime object is valid if both the date and time parts are valid. For more information, see Date#isValid() and Time#isValid().
-    bool isValid() const
+    XCLOX_CONSTEXPR14 bool isValid() const
     {
         return m_date.isValid() && m_time.isValid();
     }
 
     /// Returns the date part of this datetime.
-    Date date() const
+    XCLOX_CONSTEXPR14 Date date() const
     {
         return m_date;
     }
 
     /// Returns the time part of this datetime.
-    Time time() const
+    XCLOX_CONSTEXPR14 Time time() const
     {
         return m_time;
     }
 
     /// Returns the nanosecond of second (0, 999999999).
-    long nanosecond() const
+    XCLOX_CONSTEXPR14 long nanosecond() const
     {
         return m_time.nanosecond();
     }
 
     /// Returns the microsecond of second (0, 999999).
-    long microsecond() const
+    XCLOX_CONSTEXPR14 long microsecond() const
     {
         return m_time.microsecond();
     }
 
     /// Returns the millisecond of second (0, 999).
-    int millisecond() const
+    XCLOX_CONSTEXPR14 int millisecond() const
     {
         return m_time.millisecond();
     }
 
     /// Returns the second of minute (0, 59).
-    int second() const
+    XCLOX_CONSTEXPR14 int second() const
     {
         return m_time.second();
     }
 
     /// Returns the minute of hour (0, 59).
-    int minute() const
+    XCLOX_CONSTEXPR14 int minute() const
     {
         return m_time.minute();
     }
 
     /// Returns the hour of day (0, 23).
-    int hour() const
+    XCLOX_CONSTEXPR14 int hour() const
     {
         return m_time.hour();
     }
 
     /// Returns the day of month (1, 31).
-    int day() const
+    XCLOX_CONSTEXPR14 int day() const
     {
         return m_date.day();
     }
 
     /// Returns the month of year (1, 12), which corresponds to the enumeration #Month.
-    int month() const
+    XCLOX_CONSTEXPR14 int month() const
     {
         return m_date.month();
     }
 
     /// Returns the year as a number. There is no year 0. Negative numbers indicate years before 1 CE; that is, year -1 is year 1 BCE, year -2 is year 2 BCE, and so on.
-    int year() const
+    XCLOX_CONSTEXPR14 int year() const
     {
         return m_date.year();
     }
 
     /// Set the year, month, and day in the parameters \p year, \p month, and \p day, respectively.
-    void getYearMonthDay(int* year, int* month, int* day) const
+    XCLOX_CONSTEXPR14 void getYearMonthDay(int* year, int* month, int* day) const
     {
         return m_date.getYearMonthDay(year, month, day);
     }
 
     /// Returns the weekday as a number between 1 and 7, which corresponds to the enumeration #Weekday.
-    int dayOfWeek() const
+    XCLOX_CONSTEXPR14 int dayOfWeek() const
     {
         return m_date.dayOfWeek();
     }
 
     /// Returns the day of the year as a number between 1 and 365 (1 to 366 on leap years).
-    int dayOfYear() const
+    XCLOX_CONSTEXPR14 int dayOfYear() const
     {
         return m_date.dayOfYear();
     }
 
     /// Returns the number of days in the current month. It ranges between 28 and 31.
-    int daysInMonth() const
+    XCLOX_CONSTEXPR14 int daysInMonth() const
     {
         return m_date.daysInMonth();
     }
 
     /// Returns the number of days in the current year. It is either 365 or 366.
-    int daysInYear() const
+    XCLOX_CONSTEXPR14 int daysInYear() const
     {
         return m_date.daysInYear();
     }
 
     /// Returns whether the year of this datetime is a leap year. For more information, see Date#isLeapYear(int).
-    bool isLeapYear() const
+    XCLOX_CONSTEXPR14 bool isLeapYear() const
     {
         return m_date.isLeapYear();
     }
@@ -387,115 +626,115 @@ public:
      */
 
     /// Returns a new DateTime object representing this datetime with \p nanoseconds added to it.
-    DateTime addNanoseconds(int nanoseconds) const
+    XCLOX_CONSTEXPR14 DateTime addNanoseconds(int nanoseconds) const
     {
         return addDuration(Nanoseconds(nanoseconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p nanoseconds subtracted from it.
-    DateTime subtractNanoseconds(int nanoseconds) const
+    XCLOX_CONSTEXPR14 DateTime subtractNanoseconds(int nanoseconds) const
     {
         return subtractDuration(Nanoseconds(nanoseconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p microseconds added to it.
-    DateTime addMicroseconds(int microseconds) const
+    XCLOX_CONSTEXPR14 DateTime addMicroseconds(int microseconds) const
     {
         return addDuration(Microseconds(microseconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p microseconds subtracted from it.
-    DateTime subtractMicroseconds(int microseconds) const
+    XCLOX_CONSTEXPR14 DateTime subtractMicroseconds(int microseconds) const
     {
         return subtractDuration(Microseconds(microseconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p milliseconds added to it.
-    DateTime addMilliseconds(int milliseconds) const
+    XCLOX_CONSTEXPR14 DateTime addMilliseconds(int milliseconds) const
     {
         return addDuration(Milliseconds(milliseconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p milliseconds subtracted from it.
-    DateTime subtractMilliseconds(int milliseconds) const
+    XCLOX_CONSTEXPR14 DateTime subtractMilliseconds(int milliseconds) const
     {
         return subtractDuration(Milliseconds(milliseconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p seconds added to it.
-    DateTime addSeconds(int seconds) const
+    XCLOX_CONSTEXPR14 DateTime addSeconds(int seconds) const
     {
         return addDuration(Seconds(seconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p seconds subtracted from it.
-    DateTime subtractSeconds(int seconds) const
+    XCLOX_CONSTEXPR14 DateTime subtractSeconds(int seconds) const
     {
         return subtractDuration(Seconds(seconds));
     }
 
     /// Returns a new DateTime object representing this datetime with \p minutes added to it.
-    DateTime addMinutes(int minutes) const
+    XCLOX_CONSTEXPR14 DateTime addMinutes(int minutes) const
     {
         return addDuration(Minutes(minutes));
     }
 
     /// Returns a new DateTime object representing this datetime with \p minutes subtracted from it.
-    DateTime subtractMinutes(int minutes) const
+    XCLOX_CONSTEXPR14 DateTime subtractMinutes(int minutes) const
     {
         return subtractDuration(Minutes(minutes));
     }
 
     /// Returns a new DateTime object representing this datetime with \p hours added to it.
-    DateTime addHours(int hours) const
+    XCLOX_CONSTEXPR14 DateTime addHours(int hours) const
     {
         return addDuration(Hours(hours));
     }
 
     /// Returns a new DateTime object representing this datetime with \p hours subtracted from it.
-    DateTime subtractHours(int hours) const
+    XCLOX_CONSTEXPR14 DateTime subtractHours(int hours) const
     {
         return subtractDuration(Hours(hours));
     }
 
     /// Returns a new DateTime object representing this datetime with \p days added to it.
-    DateTime addDays(int days) const
+    XCLOX_CONSTEXPR14 DateTime addDays(int days) const
     {
         return DateTime(m_date.addDays(days), m_time);
     }
 
     /// Returns a new DateTime object representing this datetime with \p days subtracted from it.
-    DateTime subtractDays(int days) const
+    XCLOX_CONSTEXPR14 DateTime subtractDays(int days) const
     {
         return DateTime(m_date.subtractDays(days), m_time);
     }
 
     /// Returns a new DateTime object representing this datetime with \p months added to it. See Date#addMonths() for more information about how the operation is done.
-    DateTime addMonths(int months) const
+    XCLOX_CONSTEXPR14 DateTime addMonths(int months) const
     {
         return DateTime(m_date.subtractMonths(months), m_time);
     }
 
     /// Returns a new DateTime object representing this datetime with \p months subtracted from it. See Date#subtractMonths() for more information about how the operation is done.
-    DateTime subtractMonths(int months) const
+    XCLOX_CONSTEXPR14 DateTime subtractMonths(int months) const
     {
         return DateTime(m_date.subtractMonths(months), m_time);
     }
 
     /// Returns a new DateTime object representing this datetime with \p years added to it.
-    DateTime addYears(int years) const
+    XCLOX_CONSTEXPR14 DateTime addYears(int years) const
     {
         return DateTime(m_date.addYears(years), m_time);
     }
 
     /// Returns a new DateTime object representing this datetime with \p years subtracted from it.
-    DateTime subtractYears(int years) const
+    XCLOX_CONSTEXPR14 DateTime subtractYears(int years) const
     {
         return DateTime(m_date.subtractYears(years), m_time);
     }
 
     /// Returns a new DateTime object representing this datetime with \p duration added to it.
-    DateTime addDuration(const Duration& duration) const
+    XCLOX_CONSTEXPR14 DateTime addDuration(const Duration& duration) const
     {
         if (duration.count() < 0)
             return subtractDuration(-duration);
@@ -505,12 +744,86 @@ public:
     }
 
     /// Returns a new DateTime object representing this datetime with \p duration subtracted from it.
-    DateTime subtractDuration(const Duration& duration) const
+    XCLOX_CONSTEXPR14 DateTime subtractDuration(const Duration& duration) const
     {
         if (duration.count() < 0)
             return addDuration(-duration);
 
-        return DateTime(m_date.subtractDays(std::abs(std::chrono::duration_cast<Days>(Nanoseconds(m_time.toNanosecondsSinceMidnight()) - duration - Days(1)).count())), Time((Days(1) + Nanoseconds(m_time.toNanosecondsSinceMidnight()) - (duration % Days(1))) % Days(1)));
+        const Duration totalDuration = Nanoseconds(m_time.toNanosecondsSinceMidnight()) - duration;
+        const auto& subDay = totalDuration % Days(1);
+        const auto& floatingDay = Days(subDay.count() < 0 ? 1 : 0);
+        return DateTime(m_date.addDays(static_cast<int>((std::chrono::duration_cast<Days>(totalDuration) - floatingDay).count())), Time(subDay + floatingDay));
+    }
+
+    /// @}
+
+    /**
+     * @name Rounding Methods
+     * A datetime is rounded either to the midnight starting a calendar unit, or to a fixed unit counted from the epoch "1970-01-01 00:00:00.000 UTC", such as 5 minutes or an hour.
+     * round() returns the nearer of floor() and ceil(), and the later one if they are equally near.
+     * An invalid datetime, or a unit of less than one nanosecond, yields an invalid datetime. A fixed unit may be as long as about 292 years, the range of 64-bit nanoseconds.
+     * To round many datetimes at once, see BatchBucketer.
+     * @{
+     */
+
+    /// Returns the midnight starting the calendar \p unit containing this datetime. @see Date::floor(CalendarUnit)
+    XCLOX_CONSTEXPR14 DateTime floor(CalendarUnit unit) const
+    {
+        return isValid() ? DateTime(m_date.floor(unit)) : DateTime();
+    }
+
+    /// Returns this datetime if it is the midnight starting a calendar \p unit, or the midnight starting the next one otherwise.
+    XCLOX_CONSTEXPR14 DateTime ceil(CalendarUnit unit) const
+    {
+        if (!isValid())
+            return DateTime();
+        return DateTime(m_time == Time::midnight() ? m_date.ceil(unit) : m_date.addDays(1).ceil(unit));
+    }
+
+    /// Returns the nearer of floor() and ceil() for the calendar \p unit.
+    XCLOX_CONSTEXPR14 DateTime round(CalendarUnit unit) const
+    {
+        const DateTime first = floor(unit);
+        const DateTime next = ceil(unit);
+        if (!first.isValid() || !next.isValid())
+            return DateTime();
+        // A calendar unit is shorter than 64-bit nanoseconds can count.
+        const std::int64_t timeOfDay = m_time.toNanosecondsSinceMidnight();
+        const std::int64_t sinceFirst = Date::daysBetween(first.m_date, m_date) * internal::NanosecondsPerDay + timeOfDay;
+        const std::int64_t untilNext = Date::daysBetween(m_date, next.m_date) * internal::NanosecondsPerDay - timeOfDay;
+        return sinceFirst < untilNext ? first : next;
+    }
+
+    /// Returns the latest datetime not later than this datetime whose duration since the epoch is a multiple of \p unit.
+    template <typename Rep, typename Period>
+    XCLOX_CONSTEXPR14 DateTime floor(const std::chrono::duration<Rep, Period>& unit) const
+    {
+        const std::int64_t length = std::chrono::duration_cast<Nanoseconds>(unit).count();
+        if (!isValid() || length < 1)
+            return DateTime();
+        return subtractDuration(Nanoseconds(remainderSinceEpoch(length)));
+    }
+
+    /// Returns the earliest datetime not earlier than this datetime whose duration since the epoch is a multiple of \p unit.
+    template <typename Rep, typename Period>
+    XCLOX_CONSTEXPR14 DateTime ceil(const std::chrono::duration<Rep, Period>& unit) const
+    {
+        const std::int64_t length = std::chrono::duration_cast<Nanoseconds>(unit).count();
+        if (!isValid() || length < 1)
+            return DateTime();
+        const std::int64_t remainder = remainderSinceEpoch(length);
+        return remainder == 0 ? *this : addDuration(Nanoseconds(length - remainder));
+    }
+
+    /// Returns the nearer of floor() and ceil() for the fixed \p unit.
+    template <typename Rep, typename Period>
+    XCLOX_CONSTEXPR14 DateTime round(const std::chrono::duration<Rep, Period>& unit) const
+    {
+        const std::int64_t length = std::chrono::duration_cast<Nanoseconds>(unit).count();
+        if (!isValid() || length < 1)
+            return DateTime();
+        const std::int64_t remainder = remainderSinceEpoch(length);
+        return remainder < length - remainder ? subtractDuration(Nanoseconds(remainder)) : addDuration(Nanoseconds(length - remainder));
     }
 
     /// @}
@@ -521,49 +834,49 @@ public:
      */
 
     /// Returns the number of elapsed nanoseconds since "1970-01-01 00:00:00.000 UTC", not counting leap seconds.
-    long long toNanosecondsSinceEpoch() const
+    XCLOX_CONSTEXPR14 long long toNanosecondsSinceEpoch() const
     {
         return (std::chrono::duration_cast<Nanoseconds>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight())).count();
     }
 
     /// Returns the number of elapsed microseconds since "1970-01-01 00:00:00.000 UTC", not counting leap seconds.
-    long long toMicrosecondsSinceEpoch() const
+    XCLOX_CONSTEXPR14 long long toMicrosecondsSinceEpoch() const
     {
         return (std::chrono::duration_cast<Microseconds>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight())).count();
     }
 
     /// Returns the number of elapsed milliseconds since "1970-01-01 00:00:00.000 UTC", not counting leap seconds.
-    long long toMillisecondsSinceEpoch() const
+    XCLOX_CONSTEXPR14 long long toMillisecondsSinceEpoch() const
     {
         return (std::chrono::duration_cast<Milliseconds>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight())).count();
     }
 
     /// Returns the number of elapsed seconds since "1970-01-01 00:00:00.000 UTC, not counting leap seconds.
-    long long toSecondsSinceEpoch() const
+    XCLOX_CONSTEXPR14 long long toSecondsSinceEpoch() const
     {
         return (std::chrono::duration_cast<Seconds>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight())).count();
     }
 
     /// Returns the number of elapsed minutes since "1970-01-01 00:00:00.000 UTC, not counting leap seconds.
-    long toMinutesSinceEpoch() const
+    XCLOX_CONSTEXPR14 long toMinutesSinceEpoch() const
     {
         return (std::chrono::duration_cast<Minutes>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight())).count();
     }
 
     /// Returns the number of elapsed hours since "1970-01-01 00:00:00.000 UTC, not counting leap seconds.
-    long toHoursSinceEpoch() const
+    XCLOX_CONSTEXPR14 long toHoursSinceEpoch() const
     {
         return (std::chrono::duration_cast<Hours>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight())).count();
     }
 
     /// Returns the number of elapsed days since "1970-01-01 00:00:00.000 UTC", not counting leap seconds.
-    long toDaysSinceEpoch() const
+    XCLOX_CONSTEXPR14 long toDaysSinceEpoch() const
     {
         return m_date.toDaysSinceEpoch();
     }
 
     /// Returns a **std::chrono::microseconds** duration since "1970-01-01 00:00:00.000 UTC", not counting leap seconds.
-    Microseconds toStdDurationSinceEpoch() const
+    XCLOX_CONSTEXPR14 Microseconds toStdDurationSinceEpoch() const
     {
         return std::chrono::duration_cast<Microseconds>(m_date.toStdDurationSinceEpoch() + m_time.toStdDurationSinceMidnight());
     }
@@ -654,15 +967,53 @@ public:
      */
     std::string toString(const std::string& format = "yyyy-MM-dd hh:mm:ss") const
     {
-        if (!isValid() || format.empty())
-            return std::string();
-        std::stringstream output;
-        for (size_t pos = 0; pos < format.size(); ++pos) {
-            const auto count = internal::countIdenticalCharsFrom(pos, format);
-            output << (internal::isPattern(format.at(pos), count) ? stringify(format.at(pos), count) : format.substr(pos, count));
-            pos += count - 1;
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /// Returns the datetime as a string formatted according to the precompiled format \p format. See toString(const std::string&) for information about the format patterns.
+    std::string toString(const Format& format) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /**
+     * Writes the datetime formatted according to the format string \p format into the character range [\p first, \p last), and returns the length of the formatted datetime.
+     * The format patterns are the same patterns used in the method toString(). @see toString()
+     *
+     * This method never allocates memory. If the range is too small, only the characters that fit are written, but the full length is still returned, as std::snprintf() does. For example:
+     *
+     * @code
+     *    char buffer[32];
+     *    size_t length = DateTime::epoch().toChars(buffer, buffer + sizeof(buffer), "yyyy-MM-dd hh:mm:ss"); // length = 19
+     *    if (length > sizeof(buffer))
+     *        // the buffer was too small; retry with a buffer of at least length characters.
+     * @endcode
+     *
+     * If the datetime is invalid, nothing is written and zero is returned.
+     */
+    size_t toChars(char* first, char* last, const char* format) const
+    {
+        return toChars(first, last, format, std::strlen(format));
+    }
+
+    /// Writes the datetime formatted according to the format string \p format into the character range [\p first, \p last). @see toChars(char*, char*, const char*)
+    size_t toChars(char* first, char* last, const std::string& format) const
+    {
+        return toChars(first, last, format.data(), format.size());
+    }
+
+    /// Writes the datetime formatted according to the precompiled format \p format into the character range [\p first, \p last). @see toChars(char*, char*, const char*)
+    size_t toChars(char* first, char* last, const Format& format) const
+    {
+        if (!isValid())
+            return 0;
+        const auto& fields = toFields();
+        const int weekday = dayOfWeek();
+        internal::CharWriter output(first, last);
+        for (const auto& token : format.tokens()) {
+            internal::writeDateTime(output, token, fields, weekday);
         }
-        return output.str();
+        return output.size();
     }
 
     /// @}
@@ -677,7 +1028,7 @@ public:
     }
 
     /// Returns a DateTime object set to the epoch "1970-1-1T00:00:00".
-    static DateTime epoch()
+    static XCLOX_CONSTEXPR14 DateTime epoch()
     {
         return DateTime(Date::epoch(), Time::midnight());
     }
@@ -688,56 +1039,47 @@ public:
      */
     static DateTime fromString(const std::string& datetime, const std::string& format = "yyyy-MM-dd hh:mm:ss")
     {
-        int sign = 1;
-        int y = 0;
-        int M = 1;
-        int d = 1;
-        int h = 0;
-        int m = 0;
-        int s = 0;
-        int f = 0;
-        size_t dtPos = 0;
-        for (size_t fmtPos = 0; fmtPos < format.size(); ++fmtPos) {
-            const auto count = internal::countIdenticalCharsFrom(fmtPos, format);
-            if (internal::isPattern(format[fmtPos])) {
-                if (!internal::isPattern(format[fmtPos], count)) {
-                    return DateTime();
-                }
-            }
-            if (format[fmtPos] == 'y') {
-                y = parse(format[fmtPos], count, datetime, dtPos);
-            } else if (format[fmtPos] == '#' || format[fmtPos] == 'E') {
-                sign = parse(format[fmtPos], count, datetime, dtPos);
-            } else if (format[fmtPos] == 'M') {
-                M = parse(format[fmtPos], count, datetime, dtPos);
-            } else if (format[fmtPos] == 'd') {
-                if (count == 3) {
-                    parse(format[fmtPos], count, datetime, dtPos);
-                } else {
-                    d = parse(format[fmtPos], count, datetime, dtPos);
-                }
-            } else if (format[fmtPos] == 'h' || format[fmtPos] == 'H') {
-                h = parse(format[fmtPos], count, datetime, dtPos);
-            } else if (format[fmtPos] == 'a' || format[fmtPos] == 'A') {
-                int clock = parse(format[fmtPos], count, datetime, dtPos);
-                h += clock == -12 && h >= 12 || clock == 12 && h < 12 ? clock : 0;
-            } else if (format[fmtPos] == 'm') {
-                m = parse(format[fmtPos], count, datetime, dtPos);
-            } else if (format[fmtPos] == 's') {
-                s = parse(format[fmtPos], count, datetime, dtPos);
-            } else if (format[fmtPos] == 'f') {
-                f = parse(format[fmtPos], count, datetime, dtPos) * std::pow(10, 9 - count);
-            } else {
-                dtPos += count;
-            }
-            if (dtPos == std::string::npos) {
-                return DateTime();
-            }
-            fmtPos += count - 1;
+        return fromString(datetime, Format(format));
+    }
+
+    /// Returns a DateTime object from the string \p datetime formatted according to the precompiled format \p format. @see fromString(const std::string&, const std::string&)
+    static DateTime fromString(const std::string& datetime, const Format& format)
+    {
+        DateTime result;
+        fromChars(datetime.data(), datetime.data() + datetime.size(), format, result);
+        return result;
+    }
+
+    /**
+     * Parses the characters in the range [\p first, \p last), formatted according to the precompiled format \p format, into \p datetime as fromString() does, but without throwing exceptions or allocating memory.
+     * If parsing fails, \p datetime is set to an invalid DateTime object, and the returned ParseResult tells why and at which offset into the characters. For example:
+     *
+     * @code
+     *    DateTime dt;
+     *    const ParseResult result = DateTime::fromChars(first, last, format, dt);
+     *    if (!result)
+     *        log << "bad datetime at column " << result.position;
+     * @endcode
+     */
+    static ParseResult fromChars(const char* first, const char* last, const Format& format, DateTime& datetime)
+    {
+        internal::DateTimeFields fields;
+        ParseResult result = internal::parseDateTime(first, static_cast<size_t>(last - first), format, fields);
+        datetime = result ? DateTime(Date(fields.year, fields.month, fields.day), Time(fields.hour, fields.minute, fields.second, Nanoseconds(fields.nanosecond))) : DateTime();
+        if (result && !datetime.isValid()) {
+            result.error = ParseError::InvalidValue;
         }
-        return DateTime(Date(sign * y, M, d), Time(h, m, s, Nanoseconds(f)));
+        return result;
     }
 
+#ifdef XCLOX_HAS_STRING_VIEW
+    /// Parses the string view \p input into \p datetime. Available since C++17. @see fromChars(const char*, const char*, const Format&, DateTime&)
+    static ParseResult fromChars(std::string_view input, const Format& format, DateTime& datetime)
+    {
+        return fromChars(input.data(), input.data() + input.size(), format, datetime);
+    }
+#endif
+
     /// Returns a DateTime object corresponding to the Julian day \p julianDay. See toJulianDay() for information about Julian Days.
     static DateTime fromJulianDay(double julianDay)
     {
@@ -804,109 +1146,156 @@ public:
     /// @}
 
 private:
-    std::string stringify(char flag, size_t count) const
+    // Returns the nanoseconds since the epoch modulo unit nanoseconds, from 0 to unit - 1.
+    XCLOX_CONSTEXPR14 std::int64_t remainderSinceEpoch(std::int64_t unit) const
     {
-        std::stringstream output;
-        output << std::setfill('0') << std::setw(count);
-        if (flag == '#') {
-            output << (year() < 0 ? "-" : "+");
-        } else if (flag == 'E') {
-            output << (year() < 0 ? "BCE" : "CE");
-        } else if (flag == 'y') {
-            const int y = std::abs(year());
-            if (count == 1) {
-                output << y;
-            } else if (count == 2) {
-                output << y - (y / 100 * 100);
-            } else if (count == 4) {
-                output << y - (y / 10000 * 10000);
-            }
-        } else if (flag == 'M') {
-            if (count == 1 || count == 2) {
-                output << month();
-            } else if (count == 3) {
-                output << internal::getShortMonthName(month());
-            } else if (count == 4) {
-                output << internal::getLongMonthName(month());
-            }
-        } else if (flag == 'd') {
-            if (count == 1 || count == 2) {
-                output << day();
-            } else if (count == 3) {
-                output << internal::getShortWeekdayName(dayOfWeek());
-            } else if (count == 4) {
-                output << internal::getLongWeekdayName(dayOfWeek());
-            }
-        } else if (flag == 'h') {
-            output << hour();
-        } else if (flag == 'H') {
-            int h = hour();
-            output << (h == 0 ? 12 : h > 12 ? h - 12
-                                            : h);
-        } else if (flag == 'm') {
-            output << minute();
-        } else if (flag == 's') {
-            output << second();
-        } else if (flag == 'f') {
-            output << nanosecond() / static_cast<long>(std::pow(10, 9 - count));
-        } else if (flag == 'a') {
-            output << (hour() < 12 ? "am" : "pm");
-        } else if (flag == 'A') {
-            output << (hour() < 12 ? "AM" : "PM");
-        }
-        return output.str();
+        return internal::remainderSinceEpoch(m_date.toDaysSinceEpoch(), m_time.toNanosecondsSinceMidnight(), unit);
     }
 
-    static int parse(char flag, size_t count, std::string input, size_t& pos)
+    size_t toChars(char* first, char* last, const char* format, size_t size) const
     {
-        if (flag == 'y' || (flag == 'M' || flag == 'd' || flag == 'h' || flag == 'H' || flag == 'm' || flag == 's') && count <= 2 || flag == 'f') {
-            if (pos < input.size() && std::isdigit(input[pos])) {
-                return internal::readIntAndAdvancePos(input, pos, flag == 'f' ? count : (flag == 'y' && count == 1 || count == 4 ? 4 : 2));
-            }
-        } else if (flag == '#') {
-            if (pos < input.size() && (input[pos] == '-' || input[pos] == '+')) {
-                return (input[pos++] == '-' ? -1 : 1);
-            }
-        } else if (flag == 'E') {
-            if (pos + 2 < input.size() && input.substr(pos, 3) == "BCE") {
-                pos += 3;
-                return -1;
-            } else if (pos + 1 < input.size() && input.substr(pos, 2) == "CE") {
-                pos += 2;
-                return 1;
-            }
-        } else if ((flag == 'M' || flag == 'd') && count <= 4 && pos + 2 < input.size()) {
-            const auto& line = count == 3 ? input.substr(pos, 3) : input.substr(pos);
-            if (flag == 'M') {
-                const auto& monthNameArray = count == 3 ? internal::getShortMonthNameArray() : internal::getLongMonthNameArray();
-                size_t index = internal::search(monthNameArray, line);
-                if (index < monthNameArray.size()) {
-                    pos += monthNameArray[index].size();
-                    return index + 1;
-                }
-            } else {
-                const auto& weekdayNameArray = count == 3 ? internal::getShortWeekdayNameArray() : internal::getLongWeekdayNameArray();
-                size_t index = internal::search(weekdayNameArray, line);
-                if (index < weekdayNameArray.size()) {
-                    pos += weekdayNameArray[index].size();
-                    return index + 1;
-                }
-            }
-        } else if ((flag == 'a' || flag == 'A') && pos + 1 < input.size()) {
-            if (flag == 'a' && input.substr(pos, 2) == "am" || input.substr(pos, 2) == "AM") {
-                return -12;
-            } else if (flag == 'a' && input.substr(pos, 2) == "pm" || input.substr(pos, 2) == "PM") {
-                return 12;
-            }
+        if (!isValid())
+            return 0;
+        const auto& fields = toFields();
+        const int weekday = dayOfWeek();
+        internal::CharWriter output(first, last);
+        for (size_t pos = 0; pos < size;) {
+            const auto& token = Format::tokenAt(format, size, pos);
+            internal::writeDateTime(output, token, fields, weekday);
+            pos += static_cast<size_t>(token.count);
         }
-        pos = std::string::npos;
-        return std::numeric_limits<int>::min();
+        return output.size();
+    }
+
+    internal::DateTimeFields toFields() const
+    {
+        internal::DateTimeFields fields;
+        m_date.getYearMonthDay(&fields.year, &fields.month, &fields.day);
+        fields.hour = hour();
+        fields.minute = minute();
+        fields.second = second();
+        fields.nanosecond = nanosecond();
+        return fields;
     }
 
     Date m_date;
     Time m_time;
 };
 
+/**
+ * @class IsoFormat
+ *
+ * IsoFormat is a compile-time specialization of the ISO-8601 datetime format "yyyy-MM-ddThh:mm:ss", optionally followed by a subsecond fraction and the UTC designator "Z" of RFC 3339.
+ *
+ * The format is fixed by the template parameters, so formatting a datetime compiles to straight-line digit stores without interpreting a format string at runtime.
+ * The output is identical to that of DateTime::toString() given the equivalent format string.
+ * Likewise, parsing a datetime through fromChars() or fromString() checks and converts all fields at once with SSE2 vector instructions, falling back to scalar code on other targets. For example:
+ *
+ * @code
+ *    DateTime dt(Date(2024, 2, 18), Time(21, 46, 7, DateTime::Nanoseconds(987654321)));
+ *    IsoFormat<3>::toString(dt); // "2024-02-18T21:46:07.987", same as dt.toString("yyyy-MM-ddThh:mm:ss.fff")
+ *    IsoFormat<9, true>::toString(dt); // "2024-02-18T21:46:07.987654321Z"
+ *    IsoFormat<0>::toString(dt); // "2024-02-18T21:46:07"
+ *    IsoFormat<3>::fromString("2024-02-18T21:46:07.987"); // same as DateTime::fromString("2024-02-18T21:46:07.987", "yyyy-MM-ddThh:mm:ss.fff")
+ * @endcode
+ *
+ * @tparam SubsecondDigits The number of subsecond digits, between 0 and 9. If zero, the fraction and its dot are omitted.
+ * @tparam UtcDesignator Whether the datetime is followed by the UTC designator "Z".
+ *
+ * @see The unit tests in @ref datetime.h for further details.
+ */
+template <int SubsecondDigits = 3, bool UtcDesignator = false>
+class IsoFormat {
+    static_assert(SubsecondDigits >= 0 && SubsecondDigits <= 9, "the number of subsecond digits must be between 0 and 9");
+
+public:
+    /// The length of every formatted datetime.
+    static constexpr size_t Size = 19 + (SubsecondDigits > 0 ? SubsecondDigits + 1 : 0) + (UtcDesignator ? 1 : 0);
+
+    /**
+     * Writes \p datetime into the character range [\p first, \p last), and returns the length of the formatted datetime, that is, #Size.
+     * Like DateTime::toChars(), it never allocates memory; if the range is too small, only the characters that fit are written.
+     * If \p datetime is invalid, nothing is written and zero is returned.
+     */
+    static size_t toChars(char* first, char* last, const DateTime& datetime)
+    {
+        if (!datetime.isValid())
+            return 0;
+        if (last - first >= static_cast<std::ptrdiff_t>(Size)) {
+            write(first, datetime);
+        } else {
+            char buffer[Size];
+            write(buffer, datetime);
+            std::copy(buffer, buffer + (last > first ? last - first : 0), first);
+        }
+        return Size;
+    }
+
+    /// Returns \p datetime as a string. If \p datetime is invalid, an empty string is returned.
+    static std::string toString(const DateTime& datetime)
+    {
+        char buffer[Size];
+        return std::string(buffer, toChars(buffer, buffer + Size, datetime));
+    }
+
+    /**
+     * Returns a DateTime object from the character range [\p first, \p last), which must be exactly #Size characters formatted as this format.
+     * Unlike DateTime::fromString(), it accepts only the fixed-width layout, with every field zero-padded and in range, and is several times faster.
+     * If the range is malformed, an invalid datetime is returned. It never throws or allocates memory.
+     */
+    static DateTime fromChars(const char* first, const char* last)
+    {
+        if (last - first != static_cast<std::ptrdiff_t>(Size) || (UtcDesignator && last[-1] != 'Z'))
+            return DateTime();
+
+        internal::DateTimeFields fields;
+        if (!internal::parseIso<Size - (UtcDesignator ? 1 : 0)>(first, 'T', fields))
+            return DateTime();
+        return DateTime(Date(fields.year, fields.month, fields.day), Time(fields.hour, fields.minute, fields.second, DateTime::Nanoseconds(fields.nanosecond)));
+    }
+
+    /// Returns a DateTime object from the string \p datetime. @see fromChars()
+    static DateTime fromString(const std::string& datetime)
+    {
+        return fromChars(datetime.data(), datetime.data() + datetime.size());
+    }
+
+private:
+    static void write(char* dst, const DateTime& datetime)
+    {
+        int y, M, d;
+        datetime.getYearMonthDay(&y, &M, &d);
+        const long long nanoseconds = datetime.time().toNanosecondsSinceMidnight();
+        const long long seconds = nanoseconds / internal::getPowerOfTen(9);
+
+        internal::FixedDigits<4>::write(dst, static_cast<unsigned>(std::abs(y)) % 10000);
+        dst[4] = '-';
+        internal::FixedDigits<2>::write(dst + 5, static_cast<unsigned>(M));
+        dst[7] = '-';
+        internal::FixedDigits<2>::write(dst + 8, static_cast<unsigned>(d));
+        dst[10] = 'T';
+        internal::FixedDigits<2>::write(dst + 11, static_cast<unsigned long long>(seconds / 3600));
+        dst[13] = ':';
+        internal::FixedDigits<2>::write(dst + 14, static_cast<unsigned long long>(seconds / 60 % 60));
+        dst[16] = ':';
+        internal::FixedDigits<2>::write(dst + 17, static_cast<unsigned long long>(seconds % 60));
+        if (SubsecondDigits > 0) {
+            dst[19] = '.';
+            internal::FixedDigits<SubsecondDigits>::write(dst + 20, static_cast<unsigned long long>(nanoseconds % internal::getPowerOfTen(9) / internal::getPowerOfTen(9 - SubsecondDigits)));
+        }
+        if (UtcDesignator)
+            dst[Size - 1] = 'Z';
+    }
+};
+
+template <int SubsecondDigits, bool UtcDesignator>
+constexpr size_t IsoFormat<SubsecondDigits, UtcDesignator>::Size;
+
+using IsoSecondFormat = IsoFormat<0>; ///< ISO-8601 format "yyyy-MM-ddThh:mm:ss".
+using IsoMillisecondFormat = IsoFormat<3>; ///< ISO-8601 format "yyyy-MM-ddThh:mm:ss.fff".
+using IsoMicrosecondFormat = IsoFormat<6>; ///< ISO-8601 format "yyyy-MM-ddThh:mm:ss.ffffff".
+using IsoNanosecondFormat = IsoFormat<9>; ///< ISO-8601 format "yyyy-MM-ddThh:mm:ss.fffffffff".
+
 /**
  * @relates DateTime
  * @name Input/Output Operators
@@ -916,7 +1305,8 @@ private:
 /// Writes \p dt to stream \p os in ISO-8601 date and time format "yyyy-MM-ddThh:mm:ss.fff". See toString() for information about the format patterns.
 std::ostream& operator<<(std::ostream& os, const DateTime& dt)
 {
-    os << dt.toString("yyyy-MM-ddThh:mm:ss.fff");
+    char buffer[IsoMillisecondFormat::Size];
+    os.write(buffer, static_cast<std::streamsize>(IsoMillisecondFormat::toChars(buffer, buffer + sizeof(buffer), dt)));
 
     return os;
 }
@@ -924,10 +1314,9 @@ std::ostream& operator<<(std::ostream& os, const DateTime& dt)
 /// Reads a datetime in ISO-8601 date and time format "yyyy-MM-ddThh:mm:ss.fff" from stream \p is and stores it in \p dt. See toString() for information about the format patterns.
 std::istream& operator>>(std::istream& is, DateTime& dt)
 {
-    const int DateTimeFormatWidth = 23;
-    char result[DateTimeFormatWidth];
-    is.read(result, DateTimeFormatWidth);
-    dt = DateTime::fromString(std::string(result, DateTimeFormatWidth), "yyyy-MM-ddThh:mm:ss.fff");
+    char result[IsoMillisecondFormat::Size];
+    is.read(result, sizeof(result));
+    dt = IsoMillisecondFormat::fromChars(result, result + is.gcount());
 
     return is;
 }
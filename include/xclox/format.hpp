@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_FORMAT_HPP
+#define XCLOX_FORMAT_HPP
+
+#include "internal.hpp"
+
+#include <vector>
+
+#if __cplusplus >= 201703L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201703L)
+#define XCLOX_HAS_STRING_VIEW
+#include <string_view>
+#endif
+
+namespace xclox {
+
+/**
+ * @enum ParseError
+ * ParseError describes why parsing a string through the fromChars() methods of Time, Date, and DateTime failed.
+ */
+enum class ParseError {
+    None, ///< The string was parsed successfully.
+    InvalidPattern, ///< The format has a pattern flag repeated a number of times that is not a recognized pattern, e.g. "fffffffffff".
+    MissingValue, ///< The string has no value of the expected kind where a pattern expects one, e.g. a letter where a digit is expected.
+    InvalidValue, ///< Every value was read, but together they do not make a valid time, date, or datetime, e.g. "2023-02-29".
+};
+
+/**
+ * @struct ParseResult
+ * ParseResult is the outcome of parsing a string through the fromChars() methods of Time, Date, and DateTime.
+ */
+struct ParseResult {
+    ParseError error; ///< The reason parsing failed, or ParseError::None if it succeeded.
+    size_t position; ///< The offset into the string where parsing stopped; on failure, the offset of the offending value, or the end of the parsed characters if the error is ParseError::InvalidValue.
+
+    /// Returns whether parsing succeeded.
+    explicit operator bool() const
+    {
+        return error == ParseError::None;
+    }
+};
+
+/**
+ * @class Format
+ *
+ * Format is an immutable class representing a precompiled format string, such as "yyyy-MM-dd hh:mm:ss".
+ *
+ * A format string is a sequence of runs of identical characters, where each run is either a pattern (e.g., "yyyy" or "MM") or a literal text (e.g., "-" or ", ").
+ * Format splits the format string into these runs, called tokens, once at construction time, and classifies every token as a pattern or a literal.
+ * So, formatting or parsing many values with the same Format object does not rescan the format string for each value.
+ *
+ * Format objects can be passed to the toString() and fromString() methods of Time, Date, and DateTime wherever a format string is accepted. For example:
+ *
+ * @code
+ *    const Format format("yyyy-MM-dd hh:mm:ss.fff");
+ *    for (const auto& dt : dateTimes)
+ *        log << dt.toString(format);
+ * @endcode
+ *
+ * The meaning of the patterns is documented in Time::toString(), Date::toString(), and DateTime::toString().
+ *
+ * @see The unit tests in @ref format.h for further details.
+ */
+class Format {
+public:
+    /**
+     * @struct Token
+     * Token is a run of identical characters in a format string.
+     */
+    struct Token {
+        char flag; ///< The character repeated along the run.
+        int count; ///< The number of repetitions of #flag.
+        bool isFlag; ///< Whether #flag is a pattern flag regardless of #count, e.g. 'y' in "yyy".
+        bool isPattern; ///< Whether #flag repeated #count times is a recognized pattern, e.g. "yyyy" but not "yyy".
+    };
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an empty Format object.
+    Format() = default;
+
+    /// Copy-constructs a Format object from \p other.
+    Format(const Format& other) = default;
+
+    /// Move-constructs a Format object from \p other.
+    Format(Format&& other) = default;
+
+    /// Constructs a Format object by compiling the format string \p format.
+    explicit Format(const std::string& format)
+        : m_format(format)
+    {
+        for (size_t pos = 0; pos < format.size();) {
+            m_tokens.push_back(tokenAt(format.data(), format.size(), pos));
+            pos += static_cast<size_t>(m_tokens.back().count);
+        }
+    }
+
+    /// Default destructor.
+    ~Format() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    Format& operator=(const Format& other) = default;
+
+    /// Move assignment operator.
+    Format& operator=(Format&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns whether the format string is empty.
+    bool isEmpty() const
+    {
+        return m_format.empty();
+    }
+
+    /// Returns the format string this object was compiled from.
+    const std::string& toString() const
+    {
+        return m_format;
+    }
+
+    /// Returns the tokens of the format string in order.
+    const std::vector<Token>& tokens() const
+    {
+        return m_tokens;
+    }
+
+    /// @}
+
+    /**
+     * Returns the token starting at position \p pos of the format string \p format of \p size characters.
+     * This lets a format string be walked token by token without compiling it, for example:
+     *
+     * @code
+     *    for (size_t pos = 0; pos < size; pos += Format::tokenAt(format, size, pos).count)
+     * @endcode
+     */
+    static Token tokenAt(const char* format, size_t size, size_t pos)
+    {
+        size_t end = pos + 1;
+        while (end < size && format[end] == format[pos])
+            ++end;
+        const size_t count = end - pos;
+        return { format[pos], static_cast<int>(count), internal::isPattern(format[pos]), internal::isPattern(format[pos], count) };
+    }
+
+private:
+    std::string m_format;
+    std::vector<Token> m_tokens;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_FORMAT_HPP
@@ -0,0 +1,209 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_FORMATTER_HPP
+#define XCLOX_FORMATTER_HPP
+
+#include "datetime.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace xclox {
+
+namespace internal {
+
+    // The rendering of the last second formatted by a CachedFormatter on the current thread.
+    struct SecondCache {
+        std::uint64_t owner; // the identifier of the CachedFormatter that rendered the second, or zero if none did.
+        long days;
+        int secondOfDay;
+        int weekday;
+        DateTimeFields fields;
+        std::string text; // the rendering of the second, with zeros in place of the subsecond digits.
+        std::vector<std::pair<size_t, size_t>> subseconds; // the offset and the number of digits of every subsecond field in text.
+    };
+
+    // Returns the SecondCache of the current thread, which is zero-initialized, so owned by no CachedFormatter, before its first use.
+    inline SecondCache& getSecondCache()
+    {
+        thread_local SecondCache cache;
+        return cache;
+    }
+
+    // Returns a new identifier for a CachedFormatter, starting at one.
+    inline std::uint64_t nextFormatterId()
+    {
+        static std::atomic<std::uint64_t> id(0);
+        return ++id;
+    }
+
+} // namespace internal
+
+/**
+ * @class CachedFormatter
+ *
+ * CachedFormatter is an immutable class for formatting datetimes that mostly fall in the same second as the previous one, such as the timestamps of consecutive log lines.
+ *
+ * It remembers the rendering of the last second it formatted, and the year, month, day, and day of week of the last day.
+ * So, formatting a datetime in the same second as the previous one only copies the cached rendering and writes the subsecond ("f") digits into it,
+ * and formatting a datetime in a new second of the same day skips the day-to-civil conversion.
+ * The result is always identical to the one DateTime::toString() returns for the same datetime and format.
+ *
+ * The cache is kept per thread, so a CachedFormatter object can be shared by any number of threads without locking, and every thread gets its own cache hits.
+ * However, each thread caches the rendering of a single formatter at a time; a thread alternating between two formatters renders every second anew.
+ *
+ * @code
+ *    static const CachedFormatter formatter("yyyy-MM-dd hh:mm:ss.fff");
+ *    char buffer[32];
+ *    const size_t size = formatter.toChars(buffer, buffer + sizeof(buffer), DateTime::current());
+ *    std::fwrite(buffer, 1, size, log);
+ * @endcode
+ *
+ * @see The unit tests in @ref formatter.h for further details.
+ */
+class CachedFormatter {
+public:
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs a CachedFormatter object for the format string \p format. See DateTime::toString() for information about the format patterns.
+    explicit CachedFormatter(const std::string& format = "yyyy-MM-dd hh:mm:ss.fff")
+        : CachedFormatter(Format(format))
+    {
+    }
+
+    /// Constructs a CachedFormatter object for the precompiled format \p format.
+    explicit CachedFormatter(const Format& format)
+        : m_format(format)
+        , m_id(internal::nextFormatterId())
+    {
+    }
+
+    /// Copy-constructs a CachedFormatter object from \p other.
+    CachedFormatter(const CachedFormatter& other) = default;
+
+    /// Move-constructs a CachedFormatter object from \p other.
+    CachedFormatter(CachedFormatter&& other) = default;
+
+    /// Default destructor.
+    ~CachedFormatter() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    CachedFormatter& operator=(const CachedFormatter& other) = default;
+
+    /// Move assignment operator.
+    CachedFormatter& operator=(CachedFormatter&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns the format of this formatter.
+    const Format& format() const
+    {
+        return m_format;
+    }
+
+    /// @}
+
+    /**
+     * @name Formatting Methods
+     * @{
+     */
+
+    /**
+     * Writes \p datetime formatted according to the format of this formatter into the character range [\p first, \p last), and returns the length of the formatted datetime.
+     * Like DateTime::toChars(), it never allocates memory once the cache of the thread has grown to the length of the format; if the range is too small, only the characters that fit are written.
+     * If \p datetime is invalid, nothing is written and zero is returned.
+     */
+    size_t toChars(char* first, char* last, const DateTime& datetime) const
+    {
+        if (!datetime.isValid())
+            return 0;
+
+        const long long timeOfDay = datetime.time().toNanosecondsSinceMidnight();
+        const internal::SecondCache& cache = render(datetime.date().toDaysSinceEpoch(), static_cast<int>(timeOfDay / 1000000000));
+        const size_t size = cache.text.size();
+        const size_t available = std::min(size, static_cast<size_t>(last - first));
+        if (available)
+            std::memcpy(first, cache.text.data(), available);
+        if (!cache.subseconds.empty()) {
+            char digits[9];
+            internal::FixedDigits<9>::write(digits, static_cast<unsigned long long>(timeOfDay % 1000000000));
+            for (const auto& subsecond : cache.subseconds) {
+                if (subsecond.first < available)
+                    std::memcpy(first + subsecond.first, digits, std::min(subsecond.second, available - subsecond.first));
+            }
+        }
+        return size;
+    }
+
+    /// Returns \p datetime formatted according to the format of this formatter. @see toChars()
+    std::string toString(const DateTime& datetime) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, datetime); });
+    }
+
+    /// @}
+
+private:
+    // Returns the cache of the current thread holding the rendering of the second secondOfDay of the day days since the epoch, rendering it if it does not.
+    const internal::SecondCache& render(long days, int secondOfDay) const
+    {
+        internal::SecondCache& cache = internal::getSecondCache();
+        if (cache.owner == m_id && cache.days == days && cache.secondOfDay == secondOfDay)
+            return cache;
+
+        if (cache.owner != m_id || cache.days != days) {
+            internal::daysToYmd(internal::Days(days), &cache.fields.year, &cache.fields.month, &cache.fields.day);
+            cache.weekday = internal::dayOfWeek(internal::Days(days));
+            cache.days = days;
+        }
+        cache.owner = m_id;
+        cache.secondOfDay = secondOfDay;
+        cache.fields.hour = secondOfDay / 3600;
+        cache.fields.minute = secondOfDay / 60 % 60;
+        cache.fields.second = secondOfDay % 60;
+        cache.fields.nanosecond = 0;
+
+        // The first pass measures the rendering and locates the subsecond fields, and the second pass writes it.
+        internal::CharWriter counter(nullptr, nullptr);
+        cache.subseconds.clear();
+        for (const auto& token : m_format.tokens()) {
+            if (token.isPattern && token.flag == 'f')
+                cache.subseconds.emplace_back(counter.size(), static_cast<size_t>(token.count));
+            internal::writeDateTime(counter, token, cache.fields, cache.weekday);
+        }
+        cache.text.resize(counter.size());
+        internal::CharWriter output(&cache.text[0], &cache.text[0] + cache.text.size());
+        for (const auto& token : m_format.tokens())
+            internal::writeDateTime(output, token, cache.fields, cache.weekday);
+        return cache;
+    }
+
+    Format m_format;
+    std::uint64_t m_id;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_FORMATTER_HPP
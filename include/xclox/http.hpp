@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_HTTP_HPP
+#define XCLOX_HTTP_HPP
+
+#include "datetime.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+
+namespace xclox {
+
+namespace internal {
+
+    // Reads the count digits at input into value. Returns false if any of them is not a digit.
+    inline bool readHttpDigits(const char* input, size_t count, int& value)
+    {
+        value = 0;
+        for (size_t i = 0; i < count; ++i) {
+            if (!std::isdigit(static_cast<unsigned char>(input[i])))
+                return false;
+            value = value * 10 + (input[i] - '0');
+        }
+        return true;
+    }
+
+    // Reads the time of day "hh:mm:ss" at input into fields. Returns false if it is malformed.
+    inline bool readHttpTime(const char* input, DateTimeFields& fields)
+    {
+        return readHttpDigits(input, 2, fields.hour) && input[2] == ':' && readHttpDigits(input + 3, 2, fields.minute) && input[5] == ':' && readHttpDigits(input + 6, 2, fields.second);
+    }
+
+    // Returns the year of the two-digit year of an RFC 850 date received in currentYear: the year with the same last two digits that is at most 50 years in the future, as RFC 7231 requires.
+    inline int expandHttpYear(int twoDigitYear, int currentYear)
+    {
+        const int year = currentYear - currentYear % 100 + twoDigitYear;
+        return year > currentYear + 50 ? year - 100 : year < currentYear - 49 ? year + 100 : year;
+    }
+
+    /**
+     * HttpDateCache holds the IMF-fixdate of one second since the epoch, shared by all threads.
+     * It is a sequence lock whose text is kept in atomic words: a reader discards a copy taken while a writer was active, and renders the second itself instead.
+     * So, readers never block or take a lock, and a writer that finds another writer active simply leaves the cache to it.
+     */
+    class HttpDateCache {
+    public:
+        static constexpr size_t Size = 29;
+
+        HttpDateCache()
+            : m_sequence(0)
+            , m_second(std::numeric_limits<std::int64_t>::min())
+        {
+            for (auto& word : m_words)
+                word.store(0, std::memory_order_relaxed);
+        }
+
+        // Copies the Size characters cached for second into dst. Returns false if the cache holds another second or is being written.
+        bool read(std::int64_t second, char* dst) const
+        {
+            const std::uint64_t sequence = m_sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) != 0 || m_second.load(std::memory_order_relaxed) != second)
+                return false;
+            std::uint64_t words[4];
+            for (size_t i = 0; i < 4; ++i)
+                words[i] = m_words[i].load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_sequence.load(std::memory_order_relaxed) != sequence)
+                return false;
+            std::memcpy(dst, words, Size);
+            return true;
+        }
+
+        // Caches the Size characters at src for second, unless the cache already holds a later second or another thread is writing it.
+        void write(std::int64_t second, const char* src)
+        {
+            std::uint64_t sequence = m_sequence.load(std::memory_order_relaxed);
+            if ((sequence & 1) != 0 || !m_sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_acquire, std::memory_order_relaxed))
+                return;
+            std::atomic_thread_fence(std::memory_order_release);
+            if (m_second.load(std::memory_order_relaxed) < second) {
+                std::uint64_t words[4] = { 0, 0, 0, 0 };
+                std::memcpy(words, src, Size);
+                m_second.store(second, std::memory_order_relaxed);
+                for (size_t i = 0; i < 4; ++i)
+                    m_words[i].store(words[i], std::memory_order_relaxed);
+            }
+            m_sequence.store(sequence + 2, std::memory_order_release);
+        }
+
+    private:
+        std::atomic<std::uint64_t> m_sequence; // odd while a writer is active.
+        std::atomic<std::int64_t> m_second;
+        std::atomic<std::uint64_t> m_words[4];
+    };
+
+    // Returns the process-wide cache of HttpFormat::current().
+    inline HttpDateCache& getHttpDateCache()
+    {
+        static HttpDateCache cache;
+        return cache;
+    }
+
+} // namespace internal
+
+/**
+ * @class HttpFormat
+ *
+ * HttpFormat formats and parses the HTTP-date of RFC 7231, as used by the "Date", "Last-Modified", and "If-Modified-Since" headers.
+ *
+ * Datetimes are always formatted as the preferred IMF-fixdate, such as "Sun, 06 Nov 1994 08:49:37 GMT", which is what senders must generate.
+ * Parsing accepts the IMF-fixdate and both obsolete formats recipients must accept: RFC 850 dates, such as "Sunday, 06-Nov-94 08:49:37 GMT", and ANSI C asctime() dates, such as "Sun Nov  6 08:49:37 1994".
+ * Month and weekday names are matched ignoring case. The weekday must be a valid name, but is not checked against the date, as it is redundant.
+ *
+ * The current datetime, as sent in every "Date" header, is formatted through current(), which renders it at most once per second for the whole process.
+ * The rendering is shared by all threads through a cache that readers access without taking a lock.
+ *
+ * @code
+ *    char header[64] = "Date: ";
+ *    const size_t size = 6 + HttpFormat::current(header + 6, header + sizeof(header));
+ *    const DateTime since = HttpFormat::fromString("Sunday, 06-Nov-94 08:49:37 GMT"); // DateTime(Date(1994, 11, 6), Time(8, 49, 37))
+ * @endcode
+ *
+ * @see The unit tests in @ref http.h for further details.
+ */
+class HttpFormat {
+public:
+    /// The length of every formatted datetime.
+    static constexpr size_t Size = internal::HttpDateCache::Size;
+
+    /**
+     * Writes \p datetime, in UTC, as an IMF-fixdate into the character range [\p first, \p last), and returns the length of the formatted datetime, that is, #Size.
+     * Like DateTime::toChars(), it never allocates memory; if the range is too small, only the characters that fit are written.
+     * If \p datetime is invalid, nothing is written and zero is returned. The subsecond is dropped, and the year is written modulo 10000, as "yyyy" is.
+     */
+    static size_t toChars(char* first, char* last, const DateTime& datetime)
+    {
+        if (!datetime.isValid())
+            return 0;
+        char buffer[Size];
+        write(buffer, datetime.date().toDaysSinceEpoch(), static_cast<int>(datetime.time().toNanosecondsSinceMidnight() / 1000000000));
+        copy(buffer, first, last);
+        return Size;
+    }
+
+    /// Returns \p datetime as an IMF-fixdate string. If \p datetime is invalid, an empty string is returned. @see toChars()
+    static std::string toString(const DateTime& datetime)
+    {
+        char buffer[Size];
+        return std::string(buffer, toChars(buffer, buffer + Size, datetime));
+    }
+
+    /**
+     * Writes the current datetime obtained from the system clock as an IMF-fixdate into the character range [\p first, \p last), and returns #Size.
+     * The datetime is rendered once per second for the whole process, and every other call within that second copies the shared rendering without taking a lock.
+     */
+    static size_t current(char* first, char* last)
+    {
+        const std::int64_t second = std::chrono::duration_cast<std::chrono::seconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+        char buffer[Size];
+        internal::HttpDateCache& cache = internal::getHttpDateCache();
+        if (!cache.read(second, buffer)) {
+            const std::int64_t days = second / 86400 - (second % 86400 < 0 ? 1 : 0);
+            write(buffer, static_cast<long>(days), static_cast<int>(second - days * 86400));
+            cache.write(second, buffer);
+        }
+        copy(buffer, first, last);
+        return Size;
+    }
+
+    /// Returns the current datetime obtained from the system clock as an IMF-fixdate string. @see current(char*, char*)
+    static std::string current()
+    {
+        char buffer[Size];
+        return std::string(buffer, current(buffer, buffer + Size));
+    }
+
+    /**
+     * Returns a DateTime object from the HTTP-date in the character range [\p first, \p last), which is an IMF-fixdate, an RFC 850 date, or an asctime() date.
+     * The two-digit year of an RFC 850 date is taken as the year with the same last two digits that is at most 50 years after the current year.
+     * If the range is malformed, an invalid datetime is returned. It never throws or allocates memory.
+     */
+    static DateTime fromChars(const char* first, const char* last)
+    {
+        const size_t size = static_cast<size_t>(last - first);
+        internal::DateTimeFields fields = { 0, 0, 0, 0, 0, 0, 0 };
+        bool isParsed = false;
+        if (size == Size && first[3] == ',') {
+            // IMF-fixdate: "Sun, 06 Nov 1994 08:49:37 GMT"
+            isParsed = internal::lookup(internal::getShortWeekdayNameArray(), first, first + 3) != 7
+                && first[4] == ' ' && internal::readHttpDigits(first + 5, 2, fields.day) && first[7] == ' '
+                && readMonth(first + 8, fields.month) && first[11] == ' ' && internal::readHttpDigits(first + 12, 4, fields.year) && first[16] == ' '
+                && internal::readHttpTime(first + 17, fields) && std::equal(first + 25, last, " GMT");
+        } else if (size == 24 && first[3] == ' ') {
+            // asctime(): "Sun Nov  6 08:49:37 1994"
+            isParsed = internal::lookup(internal::getShortWeekdayNameArray(), first, first + 3) != 7
+                && readMonth(first + 4, fields.month) && first[7] == ' '
+                && (first[8] == ' ' ? internal::readHttpDigits(first + 9, 1, fields.day) : internal::readHttpDigits(first + 8, 2, fields.day)) && first[10] == ' '
+                && internal::readHttpTime(first + 11, fields) && first[19] == ' ' && internal::readHttpDigits(first + 20, 4, fields.year);
+        } else if (size > 24) {
+            // RFC 850: "Sunday, 06-Nov-94 08:49:37 GMT"
+            const char* const p = last - 24;
+            const size_t weekday = internal::lookup(internal::getLongWeekdayNameArray(), first, p);
+            isParsed = weekday != 7 && internal::getLongWeekdayNameArray()[weekday].size() == size - 24
+                && p[0] == ',' && p[1] == ' ' && internal::readHttpDigits(p + 2, 2, fields.day) && p[4] == '-'
+                && readMonth(p + 5, fields.month) && p[8] == '-' && internal::readHttpDigits(p + 9, 2, fields.year) && p[11] == ' '
+                && internal::readHttpTime(p + 12, fields) && std::equal(p + 20, last, " GMT");
+            fields.year = internal::expandHttpYear(fields.year, DateTime::current().year());
+        }
+        if (!isParsed || !internal::isIsoTimeInRange(fields))
+            return DateTime();
+        return DateTime(Date(fields.year, fields.month, fields.day), Time(fields.hour, fields.minute, fields.second));
+    }
+
+    /// Returns a DateTime object from the HTTP-date string \p datetime. @see fromChars()
+    static DateTime fromString(const std::string& datetime)
+    {
+        return fromChars(datetime.data(), datetime.data() + datetime.size());
+    }
+
+private:
+    // Copies the #Size characters at buffer into the character range [first, last), as many as fit.
+    static void copy(const char* buffer, char* first, char* last)
+    {
+        const std::ptrdiff_t count = last - first;
+        std::copy(buffer, buffer + (count < 0 ? 0 : count < static_cast<std::ptrdiff_t>(Size) ? count : static_cast<std::ptrdiff_t>(Size)), first);
+    }
+
+    // Reads the short month name at input, whose three characters are readable, into month.
+    static bool readMonth(const char* input, int& month)
+    {
+        month = static_cast<int>(internal::lookup(internal::getShortMonthNameArray(), input, input + 3) + 1);
+        return month != 13;
+    }
+
+    // Writes the IMF-fixdate of the second secondOfDay of the day days since the epoch into the #Size characters at dst.
+    static void write(char* dst, long days, int secondOfDay)
+    {
+        int y, M, d;
+        internal::daysToYmd(internal::Days(days), &y, &M, &d);
+        std::memcpy(dst, internal::getShortWeekdayNameArray()[internal::dayOfWeek(internal::Days(days)) - 1].data(), 3);
+        dst[3] = ',';
+        dst[4] = ' ';
+        internal::FixedDigits<2>::write(dst + 5, static_cast<unsigned>(d));
+        dst[7] = ' ';
+        std::memcpy(dst + 8, internal::getShortMonthNameArray()[M - 1].data(), 3);
+        dst[11] = ' ';
+        internal::FixedDigits<4>::write(dst + 12, static_cast<unsigned>(std::abs(y)) % 10000);
+        dst[16] = ' ';
+        internal::FixedDigits<2>::write(dst + 17, static_cast<unsigned>(secondOfDay / 3600));
+        dst[19] = ':';
+        internal::FixedDigits<2>::write(dst + 20, static_cast<unsigned>(secondOfDay / 60 % 60));
+        dst[22] = ':';
+        internal::FixedDigits<2>::write(dst + 23, static_cast<unsigned>(secondOfDay % 60));
+        std::memcpy(dst + 25, " GMT", 4);
+    }
+};
+
+} // namespace xclox
+
+#endif // XCLOX_HTTP_HPP
@@ -10,11 +10,21 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <functional>
 #include <iomanip>
 #include <sstream>
-#include <unordered_map>
+
+// The value types are literal types, whose constructors, queries, comparisons, and arithmetic are constexpr, if the language allows loops and assignments in constexpr functions (C++14 and later).
+#if __cplusplus >= 201402L || (defined(_MSVC_LANG) && _MSVC_LANG >= 201402L)
+#define XCLOX_HAS_CONSTEXPR14
+#define XCLOX_CONSTEXPR14 constexpr
+#else
+#define XCLOX_CONSTEXPR14
+#endif
 
 namespace xclox {
 
@@ -31,13 +41,64 @@ namespace internal {
         return static_cast<int>(idx - pos);
     }
 
-    inline int readIntAndAdvancePos(const std::string& str, size_t& pos, size_t maxDigitCount)
+    // Reads up to maxDigitCount digits starting at input[pos], and advances pos past them.
+    inline int readDigits(const char* input, size_t size, size_t& pos, size_t maxDigitCount)
     {
-        std::string intStr;
-        while (intStr.size() < maxDigitCount && pos < str.size() && std::isdigit(str[pos])) {
-            intStr += str[pos++];
+        int value = 0;
+        for (const size_t end = std::min(size, pos + maxDigitCount); pos < end && std::isdigit(static_cast<unsigned char>(input[pos])); ++pos) {
+            value = value * 10 + (input[pos] - '0');
         }
-        return std::stoi(intStr);
+        return value;
+    }
+
+    // Returns whether the size characters at input continue at pos with the length characters of text.
+    inline bool hasTextAt(const char* input, size_t size, size_t pos, const char* text, size_t length)
+    {
+        return pos <= size && size - pos >= length && std::equal(text, text + length, input + pos);
+    }
+
+    // Returns the first three characters at input folded to lowercase and packed into one integer, the first character in the lowest byte.
+    // Setting bit 5 of every byte folds the letters in one operation, and turns no other character into a letter.
+    inline std::uint32_t foldNamePrefix(const char* input)
+    {
+        const std::uint32_t c0 = static_cast<unsigned char>(input[0]);
+        const std::uint32_t c1 = static_cast<unsigned char>(input[1]);
+        const std::uint32_t c2 = static_cast<unsigned char>(input[2]);
+        return (c0 | c1 << 8 | c2 << 16) | 0x202020;
+    }
+
+    // Returns the zero-based index of the only month name (if S is 12) or weekday name (if S is 7) that can start with the folded prefix, or S if none can.
+    // It is a perfect hash: the multiplier sends the twelve month prefixes to distinct slots out of sixteen, and the seven weekday prefixes to distinct slots out of eight.
+    template <size_t S>
+    inline size_t hashNamePrefix(std::uint32_t prefix)
+    {
+        static_assert(S == 12 || S == 7, "only month and weekday names are hashed");
+        static constexpr unsigned char monthSlots[16] = { 2, 11, 9, 0, 0, 8, 3, 4, 0, 7, 12, 10, 0, 1, 6, 5 };
+        static constexpr unsigned char weekdaySlots[8] = { 2, 0, 3, 4, 5, 6, 1, 7 };
+        const std::uint32_t hash = prefix * 0xA695u;
+        const size_t number = S == 12 ? monthSlots[hash >> 28] : weekdaySlots[hash >> 29];
+        return number == 0 ? S : number - 1;
+    }
+
+    // Returns the zero-based index of the keyword that [first, last) starts with, ignoring case, or S if there is none.
+    template <size_t S>
+    inline size_t lookup(const std::array<std::string, S>& keywordArray, const char* first, const char* last)
+    {
+        if (last - first < 3)
+            return S;
+        const std::uint32_t prefix = foldNamePrefix(first);
+        const size_t index = hashNamePrefix<S>(prefix);
+        if (index == S)
+            return S;
+        const std::string& keyword = keywordArray[index];
+        if (foldNamePrefix(keyword.data()) != prefix || static_cast<size_t>(last - first) < keyword.size())
+            return S;
+        // the rest of every name is in lowercase.
+        for (size_t i = 3; i < keyword.size(); ++i) {
+            if ((first[i] | 0x20) != keyword[i])
+                return S;
+        }
+        return index;
     }
 
     inline const std::array<std::string, 7>& getShortWeekdayNameArray()
@@ -102,9 +163,10 @@ namespace internal {
         return getShortMonthNameArray()[month - 1];
     }
 
+    // Returns the one-based number of the month whose short name is month, ignoring case, or 13 if there is none.
     inline int getShortMonthNumber(const std::string& month)
     {
-        return static_cast<int>(std::distance(getShortMonthNameArray().cbegin(), std::find(getShortMonthNameArray().cbegin(), getShortMonthNameArray().cend(), month)) + 1);
+        return static_cast<int>((month.size() == 3 ? lookup(getShortMonthNameArray(), month.data(), month.data() + 3) : 12) + 1);
     }
 
     inline const std::array<std::string, 12>& getLongMonthNameArray()
@@ -131,45 +193,266 @@ namespace internal {
         return getLongMonthNameArray()[month - 1];
     }
 
+    // Returns the one-based number of the month whose long name is month, ignoring case, or 13 if there is none.
     inline int getLongMonthNumber(const std::string& month)
     {
-        return static_cast<int>(std::distance(getLongMonthNameArray().cbegin(), std::find(getLongMonthNameArray().cbegin(), getLongMonthNameArray().cend(), month)) + 1);
+        const size_t index = lookup(getLongMonthNameArray(), month.data(), month.data() + month.size());
+        return static_cast<int>((index != 12 && getLongMonthNameArray()[index].size() == month.size() ? index : 12) + 1);
+    }
+
+    // Returns the zero-based index of the first keyword found in [first, last), ignoring case, or S if there is none.
+    template <size_t S>
+    inline size_t search(const std::array<std::string, S>& keywordArray, const char* first, const char* last)
+    {
+        for (; last - first >= 3; ++first) {
+            const size_t index = lookup(keywordArray, first, last);
+            if (index != S)
+                return index;
+        }
+        return S;
     }
 
     template <size_t S>
     inline const size_t search(const std::array<std::string, S>& keywordArray, const std::string& input)
     {
-        return std::distance(keywordArray.cbegin(), std::find_if(keywordArray.cbegin(), keywordArray.cend(), [&](const std::string& keyword) {
-            return std::search(
-                       input.cbegin(), input.cend(),
-                       keyword.cbegin(), keyword.cend(),
-                       [](char c1, char c2) {
-                           return std::tolower(c1) == std::tolower(c2);
-                       })
-                != input.cend();
-        }));
+        return search(keywordArray, input.data(), input.data() + input.size());
     }
 
     inline bool isPattern(char flag, size_t count = 0)
     {
-        static const std::unordered_map<char, size_t> patternMap {
-            { '#', 1 },
-            { 'E', 1 },
-            { 'y', (1 | 1 << 1 | 1 << 3) },
-            { 'M', (1 | 1 << 1 | 1 << 2 | 1 << 3) },
-            { 'd', (1 | 1 << 1 | 1 << 2 | 1 << 3) },
-            { 'h', (1 | 1 << 1) },
-            { 'H', (1 | 1 << 1) },
-            { 'm', (1 | 1 << 1) },
-            { 's', (1 | 1 << 1) },
-            { 'f', (1 | 1 << 1 | 1 << 2 | 1 << 3 | 1 << 4 | 1 << 5 | 1 << 6 | 1 << 7 | 1 << 8) },
-            { 'a', 1 },
-            { 'A', 1 }
-        };
-        const auto iter = patternMap.find(flag);
-        return iter != patternMap.cend() && (count == 0 || iter->second & (1 << count - 1));
+        size_t countMask = 0;
+        switch (flag) {
+        case '#':
+        case 'E':
+        case 'a':
+        case 'A':
+            countMask = 1;
+            break;
+        case 'y':
+            countMask = (1 | 1 << 1 | 1 << 3);
+            break;
+        case 'M':
+        case 'd':
+            countMask = (1 | 1 << 1 | 1 << 2 | 1 << 3);
+            break;
+        case 'h':
+        case 'H':
+        case 'm':
+        case 's':
+            countMask = (1 | 1 << 1);
+            break;
+        case 'f':
+            countMask = (1 | 1 << 1 | 1 << 2 | 1 << 3 | 1 << 4 | 1 << 5 | 1 << 6 | 1 << 7 | 1 << 8);
+            break;
+        default:
+            return false;
+        }
+        return count == 0 || (count <= 9 && countMask & (1 << (count - 1)));
+    }
+
+    inline const char* getDigitPairs()
+    {
+        static const char digitPairs[] = "00010203040506070809"
+                                         "10111213141516171819"
+                                         "20212223242526272829"
+                                         "30313233343536373839"
+                                         "40414243444546474849"
+                                         "50515253545556575859"
+                                         "60616263646566676869"
+                                         "70717273747576777879"
+                                         "80818283848586878889"
+                                         "90919293949596979899";
+        return digitPairs;
     }
 
+    constexpr long long PowersOfTen[] = { 1, 10, 100, 1000, 10000, 100000, 1000000, 10000000, 100000000, 1000000000 };
+
+    constexpr long long getPowerOfTen(int exponent)
+    {
+        return PowersOfTen[exponent];
+    }
+
+    // Returns a / b rounded toward negative infinity, for b greater than zero.
+    constexpr std::int64_t floorDivide(std::int64_t a, std::int64_t b)
+    {
+        return a / b - (a % b < 0 ? 1 : 0);
+    }
+
+    // Writes exactly N decimal digits of value to dst, two digits at a time; the recursion is resolved at compile time, so the digit stores are straight-line code.
+    template <int N>
+    struct FixedDigits {
+        static void write(char* dst, unsigned long long value)
+        {
+            FixedDigits<N - 2>::write(dst, value / 100);
+            std::memcpy(dst + N - 2, getDigitPairs() + (value % 100) * 2, 2);
+        }
+    };
+
+    template <>
+    struct FixedDigits<1> {
+        static void write(char* dst, unsigned long long value)
+        {
+            dst[0] = static_cast<char>('0' + value);
+        }
+    };
+
+    template <>
+    struct FixedDigits<0> {
+        static void write(char*, unsigned long long)
+        {
+        }
+    };
+
+    // Writes characters into the range [first, last) without allocating, and keeps counting them after the range is full, like std::snprintf() does.
+    class CharWriter {
+    public:
+        CharWriter(char* first, char* last)
+            : m_pos(first)
+            , m_last(last)
+            , m_size(0)
+        {
+        }
+
+        void write(char c)
+        {
+            if (m_pos < m_last)
+                *m_pos++ = c;
+            ++m_size;
+        }
+
+        void write(char c, size_t count)
+        {
+            for (size_t i = 0; i < count; ++i)
+                write(c);
+        }
+
+        void write(const char* str, size_t size)
+        {
+            for (size_t i = 0; i < size; ++i)
+                write(str[i]);
+        }
+
+        void write(const std::string& str)
+        {
+            write(str.data(), str.size());
+        }
+
+        // Writes the decimal digits of value, zero-padded to at least width digits.
+        void writeInt(unsigned long long value, int width)
+        {
+            char digits[20];
+            char* const end = digits + sizeof(digits);
+            char* begin = end;
+            while (value >= 100) {
+                const char* pair = getDigitPairs() + (value % 100) * 2;
+                value /= 100;
+                *--begin = pair[1];
+                *--begin = pair[0];
+            }
+            if (value >= 10) {
+                const char* pair = getDigitPairs() + value * 2;
+                *--begin = pair[1];
+                *--begin = pair[0];
+            } else {
+                *--begin = static_cast<char>('0' + value);
+            }
+            if (end - begin < width)
+                write('0', static_cast<size_t>(width - (end - begin)));
+            write(begin, static_cast<size_t>(end - begin));
+        }
+
+        // Returns the number of characters written so far, including those that did not fit in the range.
+        size_t size() const
+        {
+            return m_size;
+        }
+
+    private:
+        char* m_pos;
+        char* m_last;
+        size_t m_size;
+    };
+
+    // The fields of a datetime as read from a string, before they are validated.
+    struct DateTimeFields {
+        int year;
+        int month;
+        int day;
+        int hour;
+        int minute;
+        int second;
+        long nanosecond;
+    };
+
+    // Returns the characters produced by toChars(first, last) as a string, using a stack buffer unless the output is larger.
+    template <typename Function>
+    inline std::string charsToString(const Function& toChars)
+    {
+        char buffer[64];
+        const size_t size = toChars(buffer, buffer + sizeof(buffer));
+        if (size <= sizeof(buffer))
+            return std::string(buffer, size);
+        std::string output(size, '\0');
+        toChars(&output[0], &output[0] + size);
+        return output;
+    }
+
+    // Returns the number of bits set in value.
+    inline int countSetBits(std::uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_popcountll(value);
+#else
+        value -= (value >> 1) & 0x5555555555555555ULL;
+        value = (value & 0x3333333333333333ULL) + ((value >> 2) & 0x3333333333333333ULL);
+        value = (value + (value >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+        return static_cast<int>((value * 0x0101010101010101ULL) >> 56);
+#endif
+    }
+
+    // Returns the number of zero bits below the lowest bit set in value, which must not be zero.
+    inline int countTrailingZeros(std::uint64_t value)
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_ctzll(value);
+#else
+        return countSetBits((value & (0 - value)) - 1);
+#endif
+    }
+
+    // An index that the threads using an object read and write without locking, such as the position of the last lookup, so that any value it holds must be a valid index. Copies start from the index of the original.
+    class SharedHint {
+    public:
+        SharedHint()
+            : m_value(0)
+        {
+        }
+
+        SharedHint(const SharedHint& other)
+            : m_value(other.load())
+        {
+        }
+
+        SharedHint& operator=(const SharedHint& other)
+        {
+            store(other.load());
+            return *this;
+        }
+
+        size_t load() const
+        {
+            return m_value.load(std::memory_order_relaxed);
+        }
+
+        void store(size_t value)
+        {
+            m_value.store(value, std::memory_order_relaxed);
+        }
+
+    private:
+        std::atomic<size_t> m_value;
+    };
+
 } // namespace internal
 
 } // namespace xclox
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_LEAPSECONDS_HPP
+#define XCLOX_LEAPSECONDS_HPP
+
+#include "datetime.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace xclox {
+
+/**
+ * @class LeapSeconds
+ *
+ * LeapSeconds is a class for the table of leap seconds, and for converting datetimes between UTC, TAI (International Atomic Time), and GPS time, which differ by the leap seconds inserted into UTC since 1972.
+ *
+ * A table is loaded from the file "leap-seconds.list" of the IANA time zone database or of the IERS, as found in "/usr/share/zoneinfo" on most Unix-like systems, by fromFile(), or from its contents by fromList().
+ * builtIn() returns the table compiled into the library, which holds every leap second up to its expiration(), after which a table loaded from a newer file should be used.
+ *
+ * The table is kept in three small sorted arrays: the UTC and TAI seconds at which the offsets of TAI from UTC change, and the offsets, so that a conversion is a binary search of one array, whose result is also kept as a hint for the next conversion, as in TimeZone.
+ * As leap seconds are a few years apart, most conversions, and almost all of the batch conversions of arrays of nanoseconds since the epoch, check the hint and need no search.
+ *
+ * TAI is ahead of UTC by 10 seconds at the start of 1972 and by one more second after every inserted leap second, and GPS time is behind TAI by 19 seconds, which makes it equal to UTC at the GPS epoch "1980-01-06 00:00:00 UTC".
+ * The offset of 1972 is used before it, as UTC before 1972 is not counted in whole leap seconds.
+ * A leap second itself, 23:59:60 UTC, cannot be represented by DateTime, so the TAI and GPS times during an inserted leap second are converted to 23:59:59 UTC, which repeats.
+ *
+ * @code
+ *    const LeapSeconds leapSeconds = LeapSeconds::builtIn();
+ *    leapSeconds.toTai(DateTime(Date(2024, 7, 1), Time(12, 0, 0))); // 2024-07-01 12:00:37
+ *    leapSeconds.fromGps(DateTime(Date(2024, 7, 1), Time(12, 0, 18))); // 2024-07-01 12:00:00
+ * @endcode
+ *
+ * @see The unit tests in @ref leapseconds.h for further details.
+ */
+class LeapSeconds {
+public:
+    using Seconds = DateTime::Seconds; ///< Second duration.
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an invalid LeapSeconds object. @see isValid()
+    LeapSeconds()
+        : m_expiration(std::numeric_limits<std::int64_t>::min())
+    {
+    }
+
+    /// Copy-constructs a LeapSeconds object from \p other.
+    LeapSeconds(const LeapSeconds& other) = default;
+
+    /// Move-constructs a LeapSeconds object from \p other.
+    LeapSeconds(LeapSeconds&& other) = default;
+
+    /// Default destructor.
+    ~LeapSeconds() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    LeapSeconds& operator=(const LeapSeconds& other) = default;
+
+    /// Move assignment operator.
+    LeapSeconds& operator=(LeapSeconds&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns whether this table has been loaded.
+    bool isValid() const
+    {
+        return !m_offsets.empty();
+    }
+
+    /// Returns the number of the entries of this table, i.e., the changes of the offset of TAI from UTC, including that of the start of 1972.
+    size_t size() const
+    {
+        return m_offsets.empty() ? 0 : m_offsets.size() - 1;
+    }
+
+    /// Returns the UTC datetime after which this table may miss leap seconds, or an invalid datetime if its file has none.
+    DateTime expiration() const
+    {
+        return m_expiration == std::numeric_limits<std::int64_t>::min() ? DateTime() : DateTime(std::chrono::seconds(static_cast<long long>(m_expiration)));
+    }
+
+    /// Returns the offset of TAI from UTC at the UTC datetime \p utc, e.g. 37 seconds since 2017, or 0 if either is invalid.
+    Seconds offset(const DateTime& utc) const
+    {
+        return Seconds(isValid() && utc.isValid() ? m_offsets[intervalAt(m_utc, m_utcHint, secondsOf(utc))] : 0);
+    }
+
+    /**
+     * Returns the leap second at the end of the UTC day \p date: 1 if a second is inserted, i.e., its last minute has 61 seconds, -1 if a second is deleted, i.e., its last minute has 59 seconds, and 0 otherwise.
+     * These are the days announced by the leap indicator of NTP packets. @see ntp::Packet::leap()
+     */
+    int leapSecond(const Date& date) const
+    {
+        if (!isValid() || !date.isValid())
+            return 0;
+        const std::int64_t end = (static_cast<std::int64_t>(date.toDaysSinceEpoch()) + 1) * 86400;
+        const auto it = std::lower_bound(m_utc.begin() + 1, m_utc.end() - 1, end);
+        return *it == end ? m_offsets[static_cast<size_t>(it - m_utc.begin())] - m_offsets[static_cast<size_t>(it - m_utc.begin()) - 1] : 0;
+    }
+
+    /// @}
+
+    /**
+     * @name Conversion Methods
+     * @{
+     */
+
+    /// Returns the TAI datetime of the UTC datetime \p utc, or an invalid datetime if either is invalid.
+    DateTime toTai(const DateTime& utc) const
+    {
+        if (!isValid() || !utc.isValid())
+            return DateTime();
+        return utc.addSeconds(m_offsets[intervalAt(m_utc, m_utcHint, secondsOf(utc))]);
+    }
+
+    /// Returns the UTC datetime of the TAI datetime \p tai, or an invalid datetime if either is invalid. See the description of the class for the datetimes during leap seconds.
+    DateTime fromTai(const DateTime& tai) const
+    {
+        if (!isValid() || !tai.isValid())
+            return DateTime();
+        return tai.subtractSeconds(m_offsets[intervalAt(m_tai, m_taiHint, secondsOf(tai))]);
+    }
+
+    /// Returns the GPS datetime of the UTC datetime \p utc, or an invalid datetime if either is invalid.
+    DateTime toGps(const DateTime& utc) const
+    {
+        if (!isValid() || !utc.isValid())
+            return DateTime();
+        return utc.addSeconds(m_offsets[intervalAt(m_utc, m_utcHint, secondsOf(utc))] - GpsOffset);
+    }
+
+    /// Returns the UTC datetime of the GPS datetime \p gps, or an invalid datetime if either is invalid. See the description of the class for the datetimes during leap seconds.
+    DateTime fromGps(const DateTime& gps) const
+    {
+        if (!isValid() || !gps.isValid())
+            return DateTime();
+        const DateTime tai = gps.addSeconds(GpsOffset);
+        return tai.subtractSeconds(m_offsets[intervalAt(m_tai, m_taiHint, secondsOf(tai))]);
+    }
+
+    /**
+     * Converts the \p count UTC nanoseconds since the epoch at \p utc to the TAI nanoseconds since the epoch at \p tai, which may be the same array as \p utc.
+     * The interval between two leap seconds of the last value is kept for the next one, so that the values of an array between the same two leap seconds, sorted or not, need no search.
+     * The values of an invalid table are copied as they are, as are those of the other batch conversions.
+     */
+    void toTai(const std::int64_t* utc, size_t count, std::int64_t* tai) const
+    {
+        convert(m_utc, m_utcHint, utc, count, tai, 0, 1, 0);
+    }
+
+    /// Converts the \p count TAI nanoseconds since the epoch at \p tai to the UTC nanoseconds since the epoch at \p utc, which may be the same array as \p tai.
+    void fromTai(const std::int64_t* tai, size_t count, std::int64_t* utc) const
+    {
+        convert(m_tai, m_taiHint, tai, count, utc, 0, -1, 0);
+    }
+
+    /// Converts the \p count UTC nanoseconds since the epoch at \p utc to the GPS nanoseconds since the epoch at \p gps, which may be the same array as \p utc.
+    void toGps(const std::int64_t* utc, size_t count, std::int64_t* gps) const
+    {
+        convert(m_utc, m_utcHint, utc, count, gps, 0, 1, -GpsOffset);
+    }
+
+    /// Converts the \p count GPS nanoseconds since the epoch at \p gps to the UTC nanoseconds since the epoch at \p utc, which may be the same array as \p gps.
+    void fromGps(const std::int64_t* gps, size_t count, std::int64_t* utc) const
+    {
+        convert(m_tai, m_taiHint, gps, count, utc, GpsOffset, -1, 0);
+    }
+
+    /// @}
+
+    /**
+     * @name Creation Methods
+     * @{
+     */
+
+    /// Returns the table compiled into the library, which expires on 2026-06-28.
+    static LeapSeconds builtIn()
+    {
+        // The NTP seconds since 1900 at which the offsets of TAI from UTC start, as listed by "leap-seconds.list".
+        static const std::int64_t times[] = {
+            2272060800, 2287785600, 2303683200, 2335219200, 2366755200, 2398291200, 2429913600,
+            2461449600, 2492985600, 2524521600, 2571782400, 2603318400, 2634854400, 2698012800,
+            2776982400, 2840140800, 2871676800, 2918937600, 2950473600, 2982009600, 3029443200,
+            3076704000, 3124137600, 3345062400, 3439756800, 3550089600, 3644697600, 3692217600
+        };
+        LeapSeconds table;
+        std::int32_t offset = 10;
+        for (std::int64_t time : times)
+            table.add(time - NtpEpochOffset, offset++);
+        table.m_expiration = 3991593600 - NtpEpochOffset;
+        table.finalize();
+        return table;
+    }
+
+    /**
+     * Returns the table of the contents \p list of a "leap-seconds.list" file, or an invalid table if they are malformed.
+     * Every line of the contents is either a comment, which starts with '#', or an entry of the NTP seconds since 1900 at which an offset of TAI from UTC starts and the offset, e.g. "3692217600 37 # 1 Jan 2017".
+     * The comment starting with "#@" is the NTP seconds of the expiration of the table. The hash of the contents in the comment starting with "#h" is not checked.
+     */
+    static LeapSeconds fromList(const std::string& list)
+    {
+        LeapSeconds table;
+        std::istringstream lines(list);
+        std::string line;
+        while (std::getline(lines, line)) {
+            std::istringstream fields(line);
+            std::int64_t time = 0, offset = 0;
+            if (line.compare(0, 2, "#@") == 0) {
+                fields.ignore(2);
+                if (!(fields >> time))
+                    return LeapSeconds();
+                table.m_expiration = time - NtpEpochOffset;
+                continue;
+            }
+            if (line.find_first_not_of(" \t\r") == std::string::npos || line[line.find_first_not_of(" \t\r")] == '#')
+                continue;
+            if (!(fields >> time >> offset) || (table.isValid() && (time - NtpEpochOffset <= table.m_utc.back() || (offset - table.m_offsets.back() != 1 && offset - table.m_offsets.back() != -1))))
+                return LeapSeconds();
+            table.add(time - NtpEpochOffset, static_cast<std::int32_t>(offset));
+        }
+        if (!table.isValid())
+            return LeapSeconds();
+        table.finalize();
+        return table;
+    }
+
+    /// Returns the table of the "leap-seconds.list" file at \p path, or an invalid table if there is no such file or it is malformed.
+    static LeapSeconds fromFile(const std::string& path = "/usr/share/zoneinfo/leap-seconds.list")
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            return LeapSeconds();
+        return fromList(std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()));
+    }
+
+    /// @}
+
+private:
+    static constexpr std::int64_t NtpEpochOffset = 2208988800; // the seconds from the NTP epoch "1900-01-01 00:00:00 UTC" to the epoch.
+    static constexpr std::int32_t GpsOffset = 19; // the offset of TAI from GPS time.
+    static constexpr std::int64_t NanosecondsPerSecond = 1000000000;
+
+    static std::int64_t secondsOf(const DateTime& datetime)
+    {
+        return static_cast<std::int64_t>(datetime.toDaysSinceEpoch()) * 86400 + datetime.time().toSecondsSinceMidnight();
+    }
+
+    // Adds the entry of the UTC seconds at which the offset starts, which is also the offset before the first entry.
+    void add(std::int64_t time, std::int32_t offset)
+    {
+        if (m_offsets.empty()) {
+            m_utc.assign(1, std::numeric_limits<std::int64_t>::min());
+            m_offsets.assign(1, offset);
+        }
+        m_utc.push_back(time);
+        m_offsets.push_back(offset);
+    }
+
+    // Ends the arrays, and derives the TAI seconds of the entries, at which the last second before an inserted leap second is repeated in UTC, and the second before a deleted leap second is skipped.
+    void finalize()
+    {
+        m_utc.push_back(std::numeric_limits<std::int64_t>::max());
+        m_tai.assign(1, std::numeric_limits<std::int64_t>::min());
+        for (size_t i = 1; i < m_offsets.size(); ++i)
+            m_tai.push_back(m_utc[i] + std::min(m_offsets[i - 1], m_offsets[i]));
+        m_tai.push_back(std::numeric_limits<std::int64_t>::max());
+    }
+
+    // Returns the interval of the seconds between the entries of times, starting with the hinted one.
+    static size_t intervalAt(const std::vector<std::int64_t>& times, internal::SharedHint& hint, std::int64_t seconds)
+    {
+        size_t i = hint.load();
+        if (seconds < times[i] || seconds >= times[i + 1]) {
+            i = static_cast<size_t>(std::upper_bound(times.begin() + 1, times.end() - 1, seconds) - times.begin()) - 1;
+            hint.store(i);
+        }
+        return i;
+    }
+
+    // Writes the count nanoseconds at input, shifted by inputShift seconds, plus the offsets of their intervals between the entries of times multiplied by sign, plus outputShift seconds, to output.
+    void convert(const std::vector<std::int64_t>& times, internal::SharedHint& hint, const std::int64_t* input, size_t count, std::int64_t* output, std::int32_t inputShift, int sign, std::int32_t outputShift) const
+    {
+        if (!isValid()) {
+            std::copy(input, input + count, output);
+            return;
+        }
+        size_t interval = hint.load();
+        for (size_t i = 0; i < count; ++i) {
+            const std::int64_t seconds = internal::floorDivide(input[i], NanosecondsPerSecond) + inputShift;
+            if (seconds < times[interval] || seconds >= times[interval + 1]) {
+                // The search halves the intervals without branches, which the unpredictable intervals of unsorted values would mispredict.
+                interval = 0;
+                for (size_t size = times.size() - 1; size > 1; size -= size / 2)
+                    interval = times[interval + size / 2] <= seconds ? interval + size / 2 : interval;
+            }
+            output[i] = input[i] + (inputShift + sign * m_offsets[interval] + outputShift) * NanosecondsPerSecond;
+        }
+        hint.store(interval);
+    }
+
+    std::vector<std::int64_t> m_utc; // the UTC seconds of the entries, between the least and the greatest seconds.
+    std::vector<std::int64_t> m_tai; // the TAI seconds of the entries, between the least and the greatest seconds.
+    std::vector<std::int32_t> m_offsets; // the offsets of TAI from UTC in the intervals, which precede and follow the entries.
+    std::int64_t m_expiration; // the UTC seconds of the expiration, if any.
+    mutable internal::SharedHint m_utcHint;
+    mutable internal::SharedHint m_taiHint;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_LEAPSECONDS_HPP
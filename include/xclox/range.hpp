@@ -0,0 +1,750 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_RANGE_HPP
+#define XCLOX_RANGE_HPP
+
+#include "datetime.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <limits>
+
+namespace xclox {
+
+namespace internal {
+
+    // The result of operator->() of an iterator whose elements are computed values, which holds a copy of the element.
+    template <typename T>
+    class ArrowProxy {
+    public:
+        explicit ArrowProxy(const T& value)
+            : m_value(value)
+        {
+        }
+
+        const T* operator->() const
+        {
+            return &m_value;
+        }
+
+    private:
+        T m_value;
+    };
+
+    // Returns a * b / d, and sets remainder to a * b % d, for a less than d and d at most 2^63, without computing the product, which may exceed 64 bits.
+    inline std::uint64_t multiplyDivide(std::uint64_t a, std::uint64_t b, std::uint64_t d, std::uint64_t* remainder)
+    {
+        std::uint64_t quotient = 0;
+        std::uint64_t rest = 0;
+        for (int bit = 63; bit >= 0; --bit) {
+            quotient <<= 1;
+            rest <<= 1;
+            if (rest >= d) {
+                rest -= d;
+                ++quotient;
+            }
+            if ((b >> bit) & 1) {
+                rest += a;
+                if (rest >= d) {
+                    rest -= d;
+                    ++quotient;
+                }
+            }
+        }
+        *remainder = rest;
+        return quotient;
+    }
+
+    // A civil date that moves by whole days. Short moves carry the day into the next or previous months, so that the fields are converted from days since the epoch only after long moves.
+    class DayCursor {
+    public:
+        explicit DayCursor(long days = 0)
+            : m_days(days)
+            , m_year(0)
+            , m_month(0)
+            , m_day(0)
+        {
+            daysToYmd(Days(days), &m_year, &m_month, &m_day);
+        }
+
+        void advance(long days)
+        {
+            m_days += days;
+            if (days > 31 || days < -31) {
+                daysToYmd(Days(m_days), &m_year, &m_month, &m_day);
+                return;
+            }
+            m_day += static_cast<int>(days);
+            for (int length = Date::daysInMonthOfYear(m_year, m_month); m_day > length; length = Date::daysInMonthOfYear(m_year, m_month)) {
+                m_day -= length;
+                if (++m_month > 12) {
+                    m_month = 1;
+                    m_year = m_year == -1 ? 1 : m_year + 1; // there is no year 0.
+                }
+            }
+            while (m_day < 1) {
+                if (--m_month < 1) {
+                    m_month = 12;
+                    m_year = m_year == 1 ? -1 : m_year - 1;
+                }
+                m_day += Date::daysInMonthOfYear(m_year, m_month);
+            }
+        }
+
+        long days() const
+        {
+            return m_days;
+        }
+
+        Date date() const
+        {
+            return Date(m_year, m_month, m_day);
+        }
+
+    private:
+        long m_days;
+        int m_year;
+        int m_month;
+        int m_day;
+    };
+
+} // namespace internal
+
+/**
+ * @class DateRange
+ *
+ * DateRange is an immutable, lazy range of the dates from a first date up to, but not including, a last date, a fixed number of days apart; e.g. every day or every week of 2024.
+ *
+ * The dates are not stored but generated by the iterators of the range, which are random-access iterators, so DateRange can be used in range-based for loops and standard algorithms.
+ * Stepping an iterator by up to a month carries the day into the next month or year, instead of converting the date to days since the epoch and back as Date::addDays() does; longer jumps convert it once.
+ * A range whose first or last date is invalid, whose last date is not later than its first, or whose step is less than one day, is empty.
+ *
+ * @code
+ *    for (const Date& date : DateRange(Date(2024, 1, 1), Date(2025, 1, 1)))
+ *        std::cout << date << '\n'; // 2024-01-01 through 2024-12-31
+ *    const DateRange mondays(Date(2024, 1, 1), Date(2025, 1, 1), Date::Weeks(1));
+ *    std::vector<Date> schedule(mondays.begin(), mondays.end());
+ * @endcode
+ *
+ * @see The unit tests in @ref range.h for further details.
+ */
+class DateRange {
+public:
+    using Days = Date::Days; ///< Day duration.
+
+    /**
+     * @class Iterator
+     * A random-access iterator over the dates of a DateRange. Dereferencing it returns a copy of its date, as the dates are computed rather than stored, so that the date stays valid after the iterator moves or is destroyed, e.g. in std::reverse_iterator.
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag; ///< Iterator category.
+        using value_type = Date; ///< Type of the elements.
+        using difference_type = std::ptrdiff_t; ///< Type of the distance between iterators.
+        using pointer = internal::ArrowProxy<Date>; ///< Type of the result of operator->().
+        using reference = Date; ///< Type of the result of dereferencing.
+
+        /// Constructs an iterator, which may only be assigned to.
+        Iterator()
+            : m_index(0)
+            , m_step(1)
+        {
+        }
+
+        /// Returns the date of this iterator.
+        reference operator*() const
+        {
+            return m_date;
+        }
+
+        /// Returns an object through which the members of the date of this iterator are accessed.
+        pointer operator->() const
+        {
+            return pointer(m_date);
+        }
+
+        /// Returns the date \p n steps away from this iterator.
+        value_type operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        /// Moves this iterator to the next date.
+        Iterator& operator++()
+        {
+            return *this += 1;
+        }
+
+        /// Moves this iterator to the next date, and returns its previous state.
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            *this += 1;
+            return previous;
+        }
+
+        /// Moves this iterator to the previous date.
+        Iterator& operator--()
+        {
+            return *this += -1;
+        }
+
+        /// Moves this iterator to the previous date, and returns its previous state.
+        Iterator operator--(int)
+        {
+            Iterator previous = *this;
+            *this += -1;
+            return previous;
+        }
+
+        /// Moves this iterator \p n steps forward.
+        Iterator& operator+=(difference_type n)
+        {
+            m_index += n;
+            m_cursor.advance(static_cast<long>(n * m_step));
+            m_date = m_cursor.date();
+            return *this;
+        }
+
+        /// Moves this iterator \p n steps backward.
+        Iterator& operator-=(difference_type n)
+        {
+            return *this += -n;
+        }
+
+        /// Returns an iterator \p n steps ahead of \p it.
+        friend Iterator operator+(Iterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        /// Returns an iterator \p n steps ahead of \p it.
+        friend Iterator operator+(difference_type n, Iterator it)
+        {
+            return it += n;
+        }
+
+        /// Returns an iterator \p n steps behind \p it.
+        friend Iterator operator-(Iterator it, difference_type n)
+        {
+            return it += -n;
+        }
+
+        /// Returns the number of steps from \p b to \p a.
+        friend difference_type operator-(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index - b.m_index;
+        }
+
+        /// Returns whether \p a and \p b are at the same date.
+        friend bool operator==(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index == b.m_index;
+        }
+
+        /// Returns whether \p a and \p b are at different dates.
+        friend bool operator!=(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index != b.m_index;
+        }
+
+        /// Returns whether \p a is before \p b.
+        friend bool operator<(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index < b.m_index;
+        }
+
+        /// Returns whether \p a is after \p b.
+        friend bool operator>(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index > b.m_index;
+        }
+
+        /// Returns whether \p a is before \p b or at the same date.
+        friend bool operator<=(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index <= b.m_index;
+        }
+
+        /// Returns whether \p a is after \p b or at the same date.
+        friend bool operator>=(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index >= b.m_index;
+        }
+
+    private:
+        friend class DateRange;
+
+        Iterator(long days, difference_type index, long step)
+            : m_cursor(days)
+            , m_date(m_cursor.date())
+            , m_index(index)
+            , m_step(step)
+        {
+        }
+
+        internal::DayCursor m_cursor;
+        Date m_date;
+        difference_type m_index;
+        long m_step;
+    };
+
+    using iterator = Iterator; ///< Iterator type, for standard algorithms.
+    using const_iterator = Iterator; ///< Constant iterator type, for standard algorithms.
+    using value_type = Date; ///< Type of the elements.
+    using size_type = std::size_t; ///< Type of the size.
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an empty DateRange object.
+    DateRange()
+        : m_first(0)
+        , m_step(1)
+        , m_size(0)
+    {
+    }
+
+    /// Constructs a DateRange object of the dates from \p first up to, but not including, \p last, \p step apart.
+    explicit DateRange(const Date& first, const Date& last, const Days& step = Days(1))
+        : m_first(first.toDaysSinceEpoch())
+        , m_step(step.count())
+        , m_size(0)
+    {
+        const long span = last.toDaysSinceEpoch() - m_first;
+        if (first.isValid() && last.isValid() && m_step > 0 && span > 0)
+            m_size = static_cast<size_type>((span - 1) / m_step + 1);
+    }
+
+    /// Copy-constructs a DateRange object from \p other.
+    DateRange(const DateRange& other) = default;
+
+    /// Move-constructs a DateRange object from \p other.
+    DateRange(DateRange&& other) = default;
+
+    /// Default destructor.
+    ~DateRange() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    DateRange& operator=(const DateRange& other) = default;
+
+    /// Move assignment operator.
+    DateRange& operator=(DateRange&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns an iterator at the first date.
+    Iterator begin() const
+    {
+        return Iterator(m_first, 0, stride());
+    }
+
+    /// Returns an iterator past the last date.
+    Iterator end() const
+    {
+        return Iterator(m_first + static_cast<long>(m_size) * stride(), static_cast<Iterator::difference_type>(m_size), stride());
+    }
+
+    /// Returns the number of dates.
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    /// Returns whether there are no dates.
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /// Returns date \p i, without checking whether it is within the range.
+    Date operator[](size_type i) const
+    {
+        return Date(Days(m_first + static_cast<long>(i) * m_step));
+    }
+
+    /// Returns the step between consecutive dates.
+    Days step() const
+    {
+        return Days(m_step);
+    }
+
+    /// @}
+
+private:
+    // Returns the step of the iterators. A range of one date is iterated one day apart, as any step reaches its end, and the step may be so long that adding it to the first date overflows; otherwise, the last step ends before the last date plus the step.
+    long stride() const
+    {
+        return m_size > 1 ? m_step : 1;
+    }
+
+    long m_first;
+    long m_step;
+    size_type m_size;
+};
+
+/**
+ * @class DateTimeRange
+ *
+ * DateTimeRange is an immutable, lazy range of the datetimes from a first datetime up to, but not including, a last datetime, a fixed duration apart; e.g. every 15 minutes of a day.
+ *
+ * As DateRange, it generates the datetimes in its random-access iterators, so it can be used in range-based for loops and standard algorithms.
+ * Stepping an iterator adds the step to the time of day, and carries the days into the date as DateRange does, instead of converting the datetime as DateTime::addDuration() does.
+ * A range whose first or last datetime is invalid, whose last datetime is not later than its first, or whose step is less than one nanosecond, is empty.
+ * The step may be as long as about 292 years, the range of 64-bit nanoseconds, while the first and last datetimes may be any distance apart; a range of more datetimes than its iterators can count is empty.
+ *
+ * @code
+ *    const DateTime open(Date(2024, 3, 1), Time(9, 30, 0));
+ *    for (const DateTime& slot : DateTimeRange(open, open.addHours(8), std::chrono::minutes(15)))
+ *        book(slot);
+ * @endcode
+ *
+ * @see The unit tests in @ref range.h for further details.
+ */
+class DateTimeRange {
+public:
+    using Nanoseconds = DateTime::Nanoseconds; ///< Nanosecond duration.
+
+    /**
+     * @class Iterator
+     * A random-access iterator over the datetimes of a DateTimeRange. Dereferencing it returns a copy of its datetime, as the datetimes are computed rather than stored, so that the datetime stays valid after the iterator moves or is destroyed, e.g. in std::reverse_iterator.
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::random_access_iterator_tag; ///< Iterator category.
+        using value_type = DateTime; ///< Type of the elements.
+        using difference_type = std::ptrdiff_t; ///< Type of the distance between iterators.
+        using pointer = internal::ArrowProxy<DateTime>; ///< Type of the result of operator->().
+        using reference = DateTime; ///< Type of the result of dereferencing.
+
+        /// Constructs an iterator, which may only be assigned to.
+        Iterator()
+            : m_firstDays(0)
+            , m_firstTimeOfDay(0)
+            , m_timeOfDay(0)
+            , m_index(0)
+            , m_step(1)
+        {
+        }
+
+        /// Returns the datetime of this iterator.
+        reference operator*() const
+        {
+            return m_datetime;
+        }
+
+        /// Returns an object through which the members of the datetime of this iterator are accessed.
+        pointer operator->() const
+        {
+            return pointer(m_datetime);
+        }
+
+        /// Returns the datetime \p n steps away from this iterator.
+        value_type operator[](difference_type n) const
+        {
+            return *(*this + n);
+        }
+
+        /// Moves this iterator to the next datetime.
+        Iterator& operator++()
+        {
+            return *this += 1;
+        }
+
+        /// Moves this iterator to the next datetime, and returns its previous state.
+        Iterator operator++(int)
+        {
+            Iterator previous = *this;
+            *this += 1;
+            return previous;
+        }
+
+        /// Moves this iterator to the previous datetime.
+        Iterator& operator--()
+        {
+            return *this += -1;
+        }
+
+        /// Moves this iterator to the previous datetime, and returns its previous state.
+        Iterator operator--(int)
+        {
+            Iterator previous = *this;
+            *this += -1;
+            return previous;
+        }
+
+        /// Moves this iterator \p n steps forward.
+        Iterator& operator+=(difference_type n)
+        {
+            m_index += n;
+            if (n == 1 || n == -1) {
+                std::int64_t days = m_step / internal::NanosecondsPerDay * n;
+                m_timeOfDay += m_step % internal::NanosecondsPerDay * n;
+                if (m_timeOfDay >= internal::NanosecondsPerDay) {
+                    m_timeOfDay -= internal::NanosecondsPerDay;
+                    ++days;
+                } else if (m_timeOfDay < 0) {
+                    m_timeOfDay += internal::NanosecondsPerDay;
+                    --days;
+                }
+                if (days != 0)
+                    m_cursor.advance(static_cast<long>(days));
+            } else {
+                // The offset from the first datetime is split into days and nanoseconds, as it may exceed 64 bits; the index is not negative as long as the iterator stays within its range.
+                const std::int64_t stepTime = m_step % internal::NanosecondsPerDay;
+                std::int64_t days = m_step / internal::NanosecondsPerDay * m_index;
+                if (m_index <= std::numeric_limits<std::int64_t>::max() / std::max<std::int64_t>(stepTime, 1)) {
+                    days += stepTime * m_index / internal::NanosecondsPerDay;
+                    m_timeOfDay = stepTime * m_index % internal::NanosecondsPerDay + m_firstTimeOfDay;
+                } else {
+                    std::uint64_t time = 0;
+                    days += static_cast<std::int64_t>(internal::multiplyDivide(static_cast<std::uint64_t>(stepTime), static_cast<std::uint64_t>(m_index), static_cast<std::uint64_t>(internal::NanosecondsPerDay), &time));
+                    m_timeOfDay = static_cast<std::int64_t>(time) + m_firstTimeOfDay;
+                }
+                if (m_timeOfDay >= internal::NanosecondsPerDay) {
+                    m_timeOfDay -= internal::NanosecondsPerDay;
+                    ++days;
+                } else if (m_timeOfDay < 0) {
+                    m_timeOfDay += internal::NanosecondsPerDay;
+                    --days;
+                }
+                m_cursor.advance(static_cast<long>(m_firstDays + days - m_cursor.days()));
+            }
+            m_datetime = DateTime(m_cursor.date(), Time(Nanoseconds(m_timeOfDay)));
+            return *this;
+        }
+
+        /// Moves this iterator \p n steps backward.
+        Iterator& operator-=(difference_type n)
+        {
+            return *this += -n;
+        }
+
+        /// Returns an iterator \p n steps ahead of \p it.
+        friend Iterator operator+(Iterator it, difference_type n)
+        {
+            return it += n;
+        }
+
+        /// Returns an iterator \p n steps ahead of \p it.
+        friend Iterator operator+(difference_type n, Iterator it)
+        {
+            return it += n;
+        }
+
+        /// Returns an iterator \p n steps behind \p it.
+        friend Iterator operator-(Iterator it, difference_type n)
+        {
+            return it += -n;
+        }
+
+        /// Returns the number of steps from \p b to \p a.
+        friend difference_type operator-(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index - b.m_index;
+        }
+
+        /// Returns whether \p a and \p b are at the same datetime.
+        friend bool operator==(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index == b.m_index;
+        }
+
+        /// Returns whether \p a and \p b are at different datetimes.
+        friend bool operator!=(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index != b.m_index;
+        }
+
+        /// Returns whether \p a is before \p b.
+        friend bool operator<(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index < b.m_index;
+        }
+
+        /// Returns whether \p a is after \p b.
+        friend bool operator>(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index > b.m_index;
+        }
+
+        /// Returns whether \p a is before \p b or at the same datetime.
+        friend bool operator<=(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index <= b.m_index;
+        }
+
+        /// Returns whether \p a is after \p b or at the same datetime.
+        friend bool operator>=(const Iterator& a, const Iterator& b)
+        {
+            return a.m_index >= b.m_index;
+        }
+
+    private:
+        friend class DateTimeRange;
+
+        Iterator(const DateTime& first, difference_type index, std::int64_t step)
+            : m_firstDays(first.toDaysSinceEpoch())
+            , m_firstTimeOfDay(first.time().toNanosecondsSinceMidnight())
+            , m_cursor(m_firstDays)
+            , m_timeOfDay(m_firstTimeOfDay)
+            , m_datetime(first)
+            , m_index(0)
+            , m_step(step)
+        {
+            if (index != 0)
+                *this += index;
+        }
+
+        long m_firstDays;
+        std::int64_t m_firstTimeOfDay;
+        internal::DayCursor m_cursor;
+        std::int64_t m_timeOfDay;
+        DateTime m_datetime;
+        difference_type m_index;
+        std::int64_t m_step;
+    };
+
+    using iterator = Iterator; ///< Iterator type, for standard algorithms.
+    using const_iterator = Iterator; ///< Constant iterator type, for standard algorithms.
+    using value_type = DateTime; ///< Type of the elements.
+    using size_type = std::size_t; ///< Type of the size.
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an empty DateTimeRange object.
+    DateTimeRange()
+        : m_step(1)
+        , m_size(0)
+    {
+    }
+
+    /// Constructs a DateTimeRange object of the datetimes from \p first up to, but not including, \p last, \p step apart.
+    template <typename Rep, typename Period>
+    explicit DateTimeRange(const DateTime& first, const DateTime& last, const std::chrono::duration<Rep, Period>& step)
+        : m_first(first)
+        , m_step(std::chrono::duration_cast<Nanoseconds>(step).count())
+        , m_size(0)
+    {
+        if (!first.isValid() || !last.isValid() || m_step < 1 || !(first < last))
+            return;
+        // The span less one nanosecond is split into days and nanoseconds, as it may exceed 64 bits, and divided by the step as (days / step * NanosecondsPerDay) + (days % step * NanosecondsPerDay + nanoseconds) / step.
+        std::int64_t spanDays = last.toDaysSinceEpoch() - first.toDaysSinceEpoch();
+        std::int64_t spanTime = last.time().toNanosecondsSinceMidnight() - first.time().toNanosecondsSinceMidnight() - 1;
+        if (spanTime < 0) {
+            spanTime += internal::NanosecondsPerDay;
+            --spanDays;
+        }
+        const std::uint64_t maxCount = static_cast<std::uint64_t>(std::numeric_limits<Iterator::difference_type>::max());
+        const std::uint64_t day = static_cast<std::uint64_t>(internal::NanosecondsPerDay);
+        const std::uint64_t stepLength = static_cast<std::uint64_t>(m_step);
+        const std::uint64_t wholeSteps = static_cast<std::uint64_t>(spanDays) / stepLength;
+        if (wholeSteps > maxCount / day)
+            return;
+        std::uint64_t rest = 0;
+        std::uint64_t count = wholeSteps * day + internal::multiplyDivide(static_cast<std::uint64_t>(spanDays) % stepLength, day, stepLength, &rest);
+        count += (rest + static_cast<std::uint64_t>(spanTime)) / stepLength;
+        if (count < maxCount)
+            m_size = static_cast<size_type>(count + 1);
+    }
+
+    /// Copy-constructs a DateTimeRange object from \p other.
+    DateTimeRange(const DateTimeRange& other) = default;
+
+    /// Move-constructs a DateTimeRange object from \p other.
+    DateTimeRange(DateTimeRange&& other) = default;
+
+    /// Default destructor.
+    ~DateTimeRange() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    DateTimeRange& operator=(const DateTimeRange& other) = default;
+
+    /// Move assignment operator.
+    DateTimeRange& operator=(DateTimeRange&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns an iterator at the first datetime.
+    Iterator begin() const
+    {
+        return Iterator(m_first, 0, m_step);
+    }
+
+    /// Returns an iterator past the last datetime.
+    Iterator end() const
+    {
+        return Iterator(m_first, static_cast<Iterator::difference_type>(m_size), m_step);
+    }
+
+    /// Returns the number of datetimes.
+    size_type size() const
+    {
+        return m_size;
+    }
+
+    /// Returns whether there are no datetimes.
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    /// Returns datetime \p i, without checking whether it is within the range.
+    DateTime operator[](size_type i) const
+    {
+        return begin()[static_cast<Iterator::difference_type>(i)];
+    }
+
+    /// Returns the step between consecutive datetimes.
+    Nanoseconds step() const
+    {
+        return Nanoseconds(m_step);
+    }
+
+    /// @}
+
+private:
+    DateTime m_first;
+    std::int64_t m_step;
+    size_type m_size;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_RANGE_HPP
@@ -0,0 +1,1037 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_RECURRENCE_HPP
+#define XCLOX_RECURRENCE_HPP
+
+#include "datetime.hpp"
+
+#include <algorithm>
+#include <bitset>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace xclox {
+
+namespace internal {
+
+    // Returns the astronomical number of year, in which year 1 BCE is 0, year 2 BCE is -1, and so on.
+    inline long astronomicalYear(int year)
+    {
+        return year < 0 ? year + 1 : year;
+    }
+
+    // Returns the year n years after year, skipping the year 0.
+    inline int shiftYear(int year, long n)
+    {
+        const long astronomical = astronomicalYear(year) + n;
+        return static_cast<int>(astronomical < 1 ? astronomical - 1 : astronomical);
+    }
+
+    // Returns the day of year on which week 1 of year starts, if weeks start on weekStart, from -2 to 4. Week 1 is the first week with at least four days in the year.
+    inline int firstWeekStart(int year, int weekStart)
+    {
+        const int offset = (dayOfWeek(ymdToDays(year, 1, 1)) - weekStart + 7) % 7;
+        return offset <= 3 ? 1 - offset : 8 - offset;
+    }
+
+    // Returns the number of weeks, 52 or 53, in year, if weeks start on weekStart.
+    inline int weeksInYear(int year, int weekStart)
+    {
+        return ((Date::isLeapYear(year) ? 366 : 365) + firstWeekStart(shiftYear(year, 1), weekStart) - firstWeekStart(year, weekStart)) / 7;
+    }
+
+    // Returns the lowest bit set in mask at or above bit first, or -1 if there is none.
+    inline int nextBit(std::uint64_t mask, int first)
+    {
+        mask = first < 64 ? mask >> first : 0;
+        return mask ? first + countTrailingZeros(mask) : -1;
+    }
+
+    // Reads the comma-separated integers of value into function, and returns true, if each is between 1 and limit, or between -limit and -1 if negative is true. If zero is true, 0 is accepted, and limit is inclusive as well.
+    template <typename Function>
+    bool readNumberList(const std::string& value, int limit, bool negative, bool zero, Function function)
+    {
+        size_t pos = 0;
+        do {
+            const bool minus = negative && pos < value.size() && value[pos] == '-';
+            if (negative && pos < value.size() && (value[pos] == '-' || value[pos] == '+'))
+                ++pos;
+            int number = 0;
+            const size_t first = pos;
+            while (pos < value.size() && value[pos] >= '0' && value[pos] <= '9' && pos - first < 4)
+                number = number * 10 + (value[pos++] - '0');
+            if (pos == first || (pos < value.size() && value[pos] != ',') || number > limit || (number == 0 && !zero))
+                return false;
+            function(minus ? -number : number);
+        } while (pos++ < value.size());
+        return true;
+    }
+
+    // Reads the positive integer of value into number, and returns true, if value is made of digits only and the integer fits in a long.
+    inline bool readPositiveNumber(const std::string& value, long& number)
+    {
+        long result = 0;
+        for (char c : value) {
+            if (c < '0' || c > '9' || result > (std::numeric_limits<long>::max() - (c - '0')) / 10)
+                return false;
+            result = result * 10 + (c - '0');
+        }
+        number = result;
+        return result > 0;
+    }
+
+} // namespace internal
+
+/**
+ * @class Recurrence
+ *
+ * Recurrence is an immutable class for the recurrence rules of RFC 5545 (iCalendar), such as "FREQ=MONTHLY;BYDAY=2TU" for the second Tuesday of every month, and for generating their occurrences.
+ *
+ * A rule is parsed once by fromString(), and its parts are kept as bit masks.
+ * The occurrences after a first datetime, the "DTSTART" of RFC 5545, are generated one at a time by a Cursor, which walks the days of every period of the rule (e.g. every month of a monthly rule) in order, advancing the civil fields of the day incrementally, and tests each day against the masks.
+ * So, there is no set of candidates to build, sort, and filter, except for rules with a "BYSETPOS" part, whose positions refer to the set of every period.
+ * Besides generating occurrences one after the other, Recurrence finds the next occurrence after a datetime by next(), and writes the occurrences within a window into a caller-provided array by expand(); rules without a "COUNT" part jump straight to the period of the datetime or window, instead of generating the occurrences before it.
+ *
+ * Every part of RFC 5545 is supported: "FREQ", "INTERVAL", "COUNT", "UNTIL", "BYSECOND", "BYMINUTE", "BYHOUR", "BYDAY", "BYMONTHDAY", "BYYEARDAY", "BYWEEKNO", "BYMONTH", "BYSETPOS", and "WKST".
+ * Weeks start on "WKST", Monday by default, and week 1 of a year is the first week with at least four days in the year, so that the week numbers of "BYWEEKNO" are those of Date::weekOfYear() with the default "WKST".
+ * The datetimes are local, so "UNTIL" may end with the UTC designator "Z" or not, to the same effect; a date-only "UNTIL", e.g. "UNTIL=20241231", includes the whole day.
+ * The second 60 of "BYSECOND" is accepted but never occurs, as Time has no leap seconds, and the occurrences keep the subsecond of the first datetime.
+ * As in RFC 5545, invalid dates, such as February 30 for "BYMONTHDAY=30", are skipped, and the first datetime is an occurrence only if it matches the rule.
+ * Occurrences are generated up to the year #MaxYear, so a rule that never matches, such as "FREQ=YEARLY;BYMONTH=2;BYMONTHDAY=30", ends there.
+ *
+ * @code
+ *    const Recurrence rule = Recurrence::fromString("FREQ=MONTHLY;BYDAY=2TU;COUNT=12");
+ *    Recurrence::Cursor cursor = rule.occurrences(DateTime(Date(2024, 1, 1), Time(10, 0, 0)));
+ *    DateTime occurrence;
+ *    while (cursor.next(occurrence))
+ *        std::cout << occurrence << '\n'; // 2024-01-09 10:00:00, 2024-02-13 10:00:00, ...
+ * @endcode
+ *
+ * @see The unit tests in @ref recurrence.h for further details.
+ */
+class Recurrence {
+public:
+    /**
+     * @name Enumerations
+     * @{
+     */
+
+    /**
+     * @enum Frequency
+     * Type of the frequency of a rule, the "FREQ" part of RFC 5545.
+     */
+    enum class Frequency {
+        Yearly,
+        Monthly,
+        Weekly,
+        Daily,
+        Hourly,
+        Minutely,
+        Secondly
+    };
+
+    /// @}
+
+    static constexpr int MaxYear = 9999; ///< The year after which no occurrences are generated.
+
+    /**
+     * @class Cursor
+     * Cursor generates the occurrences of a Recurrence after a first datetime one at a time, in order. The Recurrence must outlive its cursors.
+     */
+    class Cursor {
+    public:
+        /// Constructs a cursor, which generates no occurrences.
+        Cursor() = default;
+
+        /// Constructs a cursor for the occurrences of \p rule on and after \p start. If either is invalid, it generates no occurrences.
+        explicit Cursor(const Recurrence& rule, const DateTime& start)
+            : m_rule(&rule)
+            , m_startDays(start.toDaysSinceEpoch())
+            , m_startNanoseconds(start.time().toNanosecondsSinceMidnight())
+            , m_lowerDays(m_startDays)
+            , m_lowerNanoseconds(m_startNanoseconds)
+            , m_subsecond(start.nanosecond())
+            , m_done(!rule.isValid() || !start.isValid())
+        {
+            if (m_done)
+                return;
+            if (rule.m_until.isValid())
+                limit(rule.m_until.toDaysSinceEpoch(), rule.m_until.time().toNanosecondsSinceMidnight() + 1);
+            const Frequency frequency = rule.m_frequency;
+            m_startYear = start.year();
+            m_startMonth = start.month();
+            // An interval that reaches past MaxYear leaves only the first period, so it is capped at as many periods as the years up to MaxYear may have, which keeps the period arithmetic within its types.
+            static const std::int64_t periodsPerYear[] = { 1, 12, 53, 366, 366 * 24, 366 * 24 * 60, 366 * 24 * 60 * 60 };
+            const std::int64_t years = std::max<std::int64_t>(internal::astronomicalYear(MaxYear) - internal::astronomicalYear(m_startYear) + 1, 1);
+            m_interval = static_cast<long>(std::min<std::int64_t>(rule.m_interval, years * periodsPerYear[static_cast<int>(frequency)]));
+            // The defaults of RFC 5545 fill in the parts that a rule without any part on days would take from its first datetime.
+            m_byMonth = rule.m_byMonth;
+            m_byMonthDay = rule.m_byMonthDay;
+            m_byWeekday = rule.m_byWeekday;
+            if (!rule.m_byWeekNo && !rule.m_byWeekNoFromEnd && rule.m_byYearDay.none() && rule.m_byYearDayFromEnd.none() && !rule.m_byMonthDay && !rule.m_byMonthDayFromEnd && !rule.m_hasByDay) {
+                if (frequency == Frequency::Yearly) {
+                    if (!m_byMonth)
+                        m_byMonth = static_cast<std::uint16_t>(1u << m_startMonth);
+                    m_byMonthDay = 1u << start.day();
+                } else if (frequency == Frequency::Monthly) {
+                    m_byMonthDay = 1u << start.day();
+                } else if (frequency == Frequency::Weekly) {
+                    m_byWeekday = static_cast<std::uint8_t>(1u << start.date().dayOfWeek());
+                }
+            }
+            m_nthInMonth = frequency == Frequency::Monthly || (frequency == Frequency::Yearly && rule.m_byMonth);
+            m_hasWeekNo = rule.m_byWeekNo || rule.m_byWeekNoFromEnd;
+            m_hasYearDay = rule.m_byYearDay.any() || rule.m_byYearDayFromEnd.any();
+            m_hasMonthDay = m_byMonthDay || rule.m_byMonthDayFromEnd;
+            m_hasDay = m_byWeekday || rule.m_hasByDay;
+            m_weekdays = m_byWeekday;
+            for (int weekday = 1; weekday <= 7; ++weekday) {
+                if (rule.m_byNthWeekday[weekday] || rule.m_byNthWeekdayFromEnd[weekday])
+                    m_weekdays = static_cast<std::uint8_t>(m_weekdays | 1u << weekday);
+            }
+            // The times of a period are offsets from its start, so a subdaily rule has no hours, minutes, or seconds finer than its frequency to expand. The second 60 never occurs.
+            m_hours = frequency >= Frequency::Hourly ? 1 : rule.m_byHour ? rule.m_byHour : std::uint64_t(1) << start.hour();
+            m_minutes = frequency >= Frequency::Minutely ? 1 : rule.m_byMinute ? rule.m_byMinute : std::uint64_t(1) << start.minute();
+            m_seconds = frequency >= Frequency::Secondly ? 1 : rule.m_bySecond ? rule.m_bySecond & ~(std::uint64_t(1) << 60) : std::uint64_t(1) << start.second();
+            if (!m_seconds || (frequency == Frequency::Secondly && rule.m_bySecond == std::uint64_t(1) << 60)) {
+                m_done = true;
+                return;
+            }
+            m_day.days = m_startDays + 1; // forces the first period to derive the fields of its first day.
+            if (frequency == Frequency::Yearly) {
+                m_periodYear = m_startYear;
+            } else if (frequency == Frequency::Monthly) {
+                m_periodYear = m_startYear;
+                m_periodMonth = m_startMonth;
+            } else if (frequency == Frequency::Weekly) {
+                m_origin = m_startDays - (start.date().dayOfWeek() - rule.m_weekStart + 7) % 7;
+            } else if (frequency == Frequency::Daily) {
+                m_origin = m_startDays;
+            } else {
+                const std::int64_t unit = frequency == Frequency::Hourly ? 3600 : frequency == Frequency::Minutely ? 60 : 1;
+                const std::int64_t second = m_startDays * std::int64_t(86400) + m_startNanoseconds / 1000000000;
+                m_origin = second - second % unit;
+                m_periodStep = unit * m_interval;
+            }
+            m_periodFirst = m_origin;
+            beginPeriod();
+        }
+
+        /// Copy-constructs a Cursor object from \p other.
+        Cursor(const Cursor& other) = default;
+
+        /// Move-constructs a Cursor object from \p other.
+        Cursor(Cursor&& other) = default;
+
+        /// Default destructor.
+        ~Cursor() = default;
+
+        /// Copy assignment operator.
+        Cursor& operator=(const Cursor& other) = default;
+
+        /// Move assignment operator.
+        Cursor& operator=(Cursor&& other) = default;
+
+        /// Stores the next occurrence in \p occurrence, and returns true, if there is one; otherwise, returns false, and leaves \p occurrence unchanged.
+        bool next(DateTime& occurrence)
+        {
+            if (m_hasPending) {
+                m_hasPending = false;
+                occurrence = m_pending;
+                return true;
+            }
+            Candidate candidate;
+            while (!m_done) {
+                if (!nextInPeriod(candidate)) {
+                    nextPeriod();
+                    continue;
+                }
+                const std::int64_t nanoseconds = candidate.second * std::int64_t(1000000000) + m_subsecond;
+                if (candidate.days < m_lowerDays || (candidate.days == m_lowerDays && nanoseconds < m_lowerNanoseconds))
+                    continue;
+                if (candidate.days > m_endDays || (candidate.days == m_endDays && nanoseconds >= m_endNanoseconds)) {
+                    m_done = true;
+                    break;
+                }
+                occurrence = DateTime(Date(candidate.year, candidate.month, candidate.day), Time(candidate.second / 3600, candidate.second / 60 % 60, candidate.second % 60, Time::Nanoseconds(m_subsecond)));
+                if (m_rule->m_count && ++m_emitted == m_rule->m_count)
+                    m_done = true;
+                return true;
+            }
+            return false;
+        }
+
+        /**
+         * Moves this cursor forward, so that the next occurrence is the first one on or after \p from.
+         * Unless the rule has a "COUNT" part, whose occurrences are counted from the first datetime, this jumps straight to the period of \p from.
+         */
+        void seek(const DateTime& from)
+        {
+            if (m_done || !from.isValid())
+                return;
+            if (m_hasPending) {
+                if (!(m_pending < from))
+                    return;
+                m_hasPending = false;
+            }
+            if (m_rule->m_count) {
+                DateTime occurrence;
+                while (next(occurrence)) {
+                    if (!(occurrence < from)) {
+                        m_pending = occurrence;
+                        m_hasPending = true;
+                        return;
+                    }
+                }
+                return;
+            }
+            const long fromDays = from.toDaysSinceEpoch();
+            const std::int64_t fromNanoseconds = from.time().toNanosecondsSinceMidnight();
+            if (fromDays < m_lowerDays || (fromDays == m_lowerDays && fromNanoseconds <= m_lowerNanoseconds))
+                return;
+            m_lowerDays = fromDays;
+            m_lowerNanoseconds = fromNanoseconds;
+            const long interval = m_interval;
+            switch (m_rule->m_frequency) {
+            case Frequency::Yearly: {
+                const int year = internal::shiftYear(m_startYear, (internal::astronomicalYear(from.year()) - internal::astronomicalYear(m_startYear)) / interval * interval);
+                if (internal::astronomicalYear(year) > internal::astronomicalYear(m_periodYear)) {
+                    m_periodYear = year;
+                    beginPeriod();
+                }
+                break;
+            }
+            case Frequency::Monthly: {
+                const long months = (internal::astronomicalYear(from.year()) - internal::astronomicalYear(m_startYear)) * 12 + from.month() - m_startMonth;
+                const long target = months / interval * interval + m_startMonth - 1;
+                const long current = (internal::astronomicalYear(m_periodYear) - internal::astronomicalYear(m_startYear)) * 12 + m_periodMonth - 1;
+                if (target > current) {
+                    m_periodYear = internal::shiftYear(m_startYear, target / 12);
+                    m_periodMonth = static_cast<int>(target % 12) + 1;
+                    beginPeriod();
+                }
+                break;
+            }
+            case Frequency::Weekly:
+            case Frequency::Daily: {
+                const long length = m_rule->m_frequency == Frequency::Weekly ? 7 : 1;
+                const std::int64_t first = m_origin + (fromDays - m_origin) / (length * interval) * length * interval;
+                if (first > m_periodFirst) {
+                    m_periodFirst = first;
+                    beginPeriod();
+                }
+                break;
+            }
+            default: {
+                const std::int64_t second = fromDays * std::int64_t(86400) + fromNanoseconds / 1000000000;
+                const std::int64_t first = m_origin + (second - m_origin) / m_periodStep * m_periodStep;
+                if (first > m_periodFirst) {
+                    m_periodFirst = first;
+                    beginPeriod();
+                }
+                break;
+            }
+            }
+        }
+
+    private:
+        friend class Recurrence;
+
+        // A candidate occurrence: a day and a second of the day.
+        struct Candidate {
+            long days;
+            int year;
+            int month;
+            int day;
+            int second;
+
+            bool operator<(const Candidate& other) const
+            {
+                return days < other.days || (days == other.days && second < other.second);
+            }
+
+            bool operator==(const Candidate& other) const
+            {
+                return days == other.days && second == other.second;
+            }
+        };
+
+        // The civil fields of a day, advanced a day at a time.
+        struct Day {
+            long days;
+            int year;
+            int month;
+            int day;
+            int weekday;
+            int yearDay;
+            int daysInMonth;
+            int daysInYear;
+            int firstWeekStart;
+            int weeks;
+            int previousWeeks;
+            int nextWeeks;
+        };
+
+        // Stops the cursor before the nanosecond nanoseconds, which may be a whole day, of the day days since the epoch, if it is earlier than the current end.
+        void limit(long days, std::int64_t nanoseconds)
+        {
+            if (nanoseconds >= internal::NanosecondsPerDay) {
+                ++days;
+                nanoseconds -= internal::NanosecondsPerDay;
+            }
+            if (days < m_endDays || (days == m_endDays && nanoseconds < m_endNanoseconds)) {
+                m_endDays = days;
+                m_endNanoseconds = nanoseconds;
+            }
+        }
+
+        // Stores the next time of the hours, minutes, and seconds of the cursor in time, as seconds since the start of the period, and returns true, if there is one in the current day or period.
+        bool nextTime(int& time)
+        {
+            int hour = 0, minute = 0, second = 0;
+            if (m_time < 0) {
+                hour = internal::nextBit(m_hours, 0);
+                minute = internal::nextBit(m_minutes, 0);
+                second = internal::nextBit(m_seconds, 0);
+            } else if ((second = internal::nextBit(m_seconds, m_time % 60 + 1)) >= 0) {
+                hour = m_time / 3600;
+                minute = m_time / 60 % 60;
+            } else {
+                second = internal::nextBit(m_seconds, 0);
+                hour = m_time / 3600;
+                if ((minute = internal::nextBit(m_minutes, m_time / 60 % 60 + 1)) < 0) {
+                    minute = internal::nextBit(m_minutes, 0);
+                    if ((hour = internal::nextBit(m_hours, hour + 1)) < 0)
+                        return false;
+                }
+            }
+            time = m_time = hour * 3600 + minute * 60 + second;
+            return true;
+        }
+
+        void setYear(int year)
+        {
+            m_day.year = year;
+            m_day.daysInYear = Date::isLeapYear(year) ? 366 : 365;
+            if (m_hasWeekNo) {
+                m_day.firstWeekStart = internal::firstWeekStart(year, m_rule->m_weekStart);
+                m_day.weeks = internal::weeksInYear(year, m_rule->m_weekStart);
+                m_day.previousWeeks = internal::weeksInYear(internal::shiftYear(year, -1), m_rule->m_weekStart);
+                m_day.nextWeeks = internal::weeksInYear(internal::shiftYear(year, 1), m_rule->m_weekStart);
+            }
+        }
+
+        // Moves to the day days since the epoch, day by day if it is up to a month ahead, and by converting it otherwise.
+        void moveTo(long days)
+        {
+            if (days >= m_day.days && days - m_day.days <= 31) {
+                while (m_day.days < days)
+                    nextDay();
+                return;
+            }
+            m_day.days = days;
+            int year = 0;
+            internal::daysToYmd(internal::Days(days), &year, &m_day.month, &m_day.day);
+            setYear(year);
+            m_day.weekday = internal::dayOfWeek(internal::Days(days));
+            m_day.yearDay = static_cast<int>(days - internal::ymdToDays(year, 1, 1).count()) + 1;
+            m_day.daysInMonth = Date::daysInMonthOfYear(year, m_day.month);
+        }
+
+        void nextDay()
+        {
+            ++m_day.days;
+            ++m_day.yearDay;
+            m_day.weekday = m_day.weekday == 7 ? 1 : m_day.weekday + 1;
+            if (++m_day.day > m_day.daysInMonth) {
+                m_day.day = 1;
+                if (++m_day.month > 12) {
+                    m_day.month = 1;
+                    m_day.yearDay = 1;
+                    setYear(m_day.year == -1 ? 1 : m_day.year + 1);
+                }
+                m_day.daysInMonth = Date::daysInMonthOfYear(m_day.year, m_day.month);
+            }
+        }
+
+        // Moves days days ahead, which must not be past the end of the next month.
+        void skipDays(int days)
+        {
+            m_day.days += days;
+            m_day.yearDay += days;
+            m_day.weekday = (m_day.weekday - 1 + days) % 7 + 1;
+            if ((m_day.day += days) > m_day.daysInMonth) {
+                m_day.day -= m_day.daysInMonth;
+                if (++m_day.month > 12) {
+                    m_day.month = 1;
+                    m_day.yearDay = m_day.day;
+                    setYear(m_day.year == -1 ? 1 : m_day.year + 1);
+                }
+                m_day.daysInMonth = Date::daysInMonthOfYear(m_day.year, m_day.month);
+            }
+        }
+
+        bool matchesDay() const
+        {
+            const Recurrence& rule = *m_rule;
+            const Day& d = m_day;
+            if (m_byMonth && !(m_byMonth >> d.month & 1))
+                return false;
+            if (m_hasWeekNo) {
+                int week = 0, weeks = 0;
+                if (d.yearDay < d.firstWeekStart) {
+                    week = weeks = d.previousWeeks;
+                } else if ((week = (d.yearDay - d.firstWeekStart) / 7 + 1) > d.weeks) {
+                    week = 1;
+                    weeks = d.nextWeeks;
+                } else {
+                    weeks = d.weeks;
+                }
+                if (!(rule.m_byWeekNo >> week & 1) && !(rule.m_byWeekNoFromEnd >> (weeks - week + 1) & 1))
+                    return false;
+            }
+            if (m_hasYearDay && !rule.m_byYearDay[d.yearDay] && !rule.m_byYearDayFromEnd[d.daysInYear - d.yearDay + 1])
+                return false;
+            if (m_hasMonthDay && !(m_byMonthDay >> d.day & 1) && !(rule.m_byMonthDayFromEnd >> (d.daysInMonth - d.day + 1) & 1))
+                return false;
+            if (m_hasDay) {
+                if (m_byWeekday >> d.weekday & 1)
+                    return true;
+                const int nth = m_nthInMonth ? (d.day - 1) / 7 + 1 : (d.yearDay - 1) / 7 + 1;
+                const int nthFromEnd = m_nthInMonth ? (d.daysInMonth - d.day) / 7 + 1 : (d.daysInYear - d.yearDay) / 7 + 1;
+                return (rule.m_byNthWeekday[d.weekday] >> nth & 1) || (rule.m_byNthWeekdayFromEnd[d.weekday] >> nthFromEnd & 1);
+            }
+            return true;
+        }
+
+        // Positions the cursor at the first day of the period that starts at m_periodYear, m_periodMonth, or m_periodFirst, and skips periods until one may have occurrences.
+        void beginPeriod()
+        {
+            m_time = -1;
+            m_setIndex = 0;
+            m_set.clear();
+            m_setFilled = false;
+            const Recurrence& rule = *m_rule;
+            switch (rule.m_frequency) {
+            case Frequency::Yearly:
+                if (m_periodYear > MaxYear) {
+                    m_done = true;
+                    return;
+                }
+                moveTo(internal::ymdToDays(m_periodYear, 1, 1).count());
+                m_periodEnd = m_day.days + m_day.daysInYear;
+                return;
+            case Frequency::Monthly:
+                while (m_byMonth && !(m_byMonth >> m_periodMonth & 1) && m_periodYear <= MaxYear)
+                    shiftMonth();
+                if (m_periodYear > MaxYear) {
+                    m_done = true;
+                    return;
+                }
+                moveTo(internal::ymdToDays(m_periodYear, m_periodMonth, 1).count());
+                m_periodEnd = m_day.days + m_day.daysInMonth;
+                return;
+            case Frequency::Weekly:
+            case Frequency::Daily:
+                moveTo(static_cast<long>(m_periodFirst));
+                if (m_day.year > MaxYear)
+                    m_done = true;
+                m_periodEnd = m_day.days + (rule.m_frequency == Frequency::Weekly ? 7 : 1);
+                return;
+            default:
+                break;
+            }
+            // A period of a subdaily rule is skipped up to the next day, hour, or minute, if its day, hour, or minute does not match.
+            for (;;) {
+                const std::int64_t days = m_periodFirst / 86400 - (m_periodFirst % 86400 < 0 ? 1 : 0);
+                moveTo(static_cast<long>(days));
+                if (m_day.year > MaxYear) {
+                    m_done = true;
+                    return;
+                }
+                const int second = static_cast<int>(m_periodFirst - days * 86400);
+                if (!matchesDay()) {
+                    skipPeriodsTo((days + 1) * 86400);
+                } else if (rule.m_byHour && !(rule.m_byHour >> (second / 3600) & 1)) {
+                    skipPeriodsTo(days * 86400 + (second / 3600 + 1) * 3600);
+                } else if (rule.m_frequency >= Frequency::Minutely && rule.m_byMinute && !(rule.m_byMinute >> (second / 60 % 60) & 1)) {
+                    skipPeriodsTo(days * 86400 + (second / 60 + 1) * 60);
+                } else if (rule.m_frequency == Frequency::Secondly && rule.m_bySecond && !(rule.m_bySecond >> (second % 60) & 1)) {
+                    skipPeriodsTo(m_periodFirst + 1);
+                } else {
+                    m_periodSecond = second;
+                    return;
+                }
+            }
+        }
+
+        // Moves m_periodFirst to the first period that starts on or after second.
+        void skipPeriodsTo(std::int64_t second)
+        {
+            m_periodFirst += (second - m_periodFirst + m_periodStep - 1) / m_periodStep * m_periodStep;
+        }
+
+        void shiftMonth()
+        {
+            const long month = m_periodMonth - 1 + m_interval;
+            m_periodYear = internal::shiftYear(m_periodYear, month / 12);
+            m_periodMonth = static_cast<int>(month % 12) + 1;
+        }
+
+        void nextPeriod()
+        {
+            switch (m_rule->m_frequency) {
+            case Frequency::Yearly:
+                m_periodYear = internal::shiftYear(m_periodYear, m_interval);
+                break;
+            case Frequency::Monthly:
+                shiftMonth();
+                break;
+            case Frequency::Weekly:
+                m_periodFirst += 7 * m_interval;
+                break;
+            case Frequency::Daily:
+                m_periodFirst += m_interval;
+                break;
+            default:
+                m_periodFirst += m_periodStep;
+                break;
+            }
+            beginPeriod();
+        }
+
+        // Stores the next candidate of the period in candidate, in order, and returns true, if there is one.
+        bool nextCandidate(Candidate& candidate)
+        {
+            int time = 0;
+            if (m_rule->m_frequency >= Frequency::Hourly) {
+                if (!nextTime(time))
+                    return false;
+                candidate = Candidate { m_day.days, m_day.year, m_day.month, m_day.day, m_periodSecond + time };
+                return true;
+            }
+            while (m_day.days < m_periodEnd) {
+                if (m_time < 0 && !matchesDay()) {
+                    // Whole months of other months, and days of other weekdays, are skipped at once.
+                    if (m_byMonth && !(m_byMonth >> m_day.month & 1)) {
+                        skipDays(m_day.daysInMonth - m_day.day + 1);
+                    } else if (m_hasDay && !(m_weekdays >> m_day.weekday & 1)) {
+                        int days = 1;
+                        while (!(m_weekdays >> ((m_day.weekday - 1 + days) % 7 + 1) & 1))
+                            ++days;
+                        skipDays(days);
+                    } else {
+                        nextDay();
+                    }
+                    continue;
+                }
+                if (nextTime(time)) {
+                    candidate = Candidate { m_day.days, m_day.year, m_day.month, m_day.day, time };
+                    return true;
+                }
+                m_time = -1;
+                nextDay();
+            }
+            return false;
+        }
+
+        // As nextCandidate(), but selects the candidates of the period by the positions of "BYSETPOS", if any.
+        bool nextInPeriod(Candidate& candidate)
+        {
+            if (m_rule->m_bySetPos.empty())
+                return nextCandidate(candidate);
+            if (!m_setFilled) {
+                m_all.clear();
+                while (nextCandidate(candidate))
+                    m_all.push_back(candidate);
+                const long size = static_cast<long>(m_all.size());
+                for (const int position : m_rule->m_bySetPos) {
+                    const long index = position > 0 ? position - 1 : size + position;
+                    if (index >= 0 && index < size)
+                        m_set.push_back(m_all[index]);
+                }
+                std::sort(m_set.begin(), m_set.end());
+                m_set.erase(std::unique(m_set.begin(), m_set.end()), m_set.end());
+                m_setFilled = true;
+            }
+            if (m_setIndex == m_set.size())
+                return false;
+            candidate = m_set[m_setIndex++];
+            return true;
+        }
+
+        const Recurrence* m_rule = nullptr;
+        long m_startDays = 0;
+        std::int64_t m_startNanoseconds = 0;
+        long m_lowerDays = 0;
+        std::int64_t m_lowerNanoseconds = 0;
+        long m_subsecond = 0;
+        long m_endDays = std::numeric_limits<long>::max();
+        std::int64_t m_endNanoseconds = 0;
+        long m_emitted = 0;
+        long m_interval = 1;
+        bool m_done = true;
+        bool m_hasPending = false;
+        DateTime m_pending;
+        int m_startYear = 0;
+        int m_startMonth = 0;
+        std::uint16_t m_byMonth = 0;
+        std::uint32_t m_byMonthDay = 0;
+        std::uint8_t m_byWeekday = 0;
+        bool m_nthInMonth = false;
+        bool m_hasWeekNo = false;
+        bool m_hasYearDay = false;
+        bool m_hasMonthDay = false;
+        bool m_hasDay = false;
+        std::uint8_t m_weekdays = 0;
+        std::uint64_t m_hours = 0;
+        std::uint64_t m_minutes = 0;
+        std::uint64_t m_seconds = 0;
+        Day m_day {};
+        long m_periodEnd = 0;
+        int m_time = -1;
+        int m_periodYear = 0;
+        int m_periodMonth = 0;
+        std::int64_t m_origin = 0;
+        std::int64_t m_periodFirst = 0;
+        std::int64_t m_periodStep = 1;
+        int m_periodSecond = 0;
+        std::vector<Candidate> m_all;
+        std::vector<Candidate> m_set;
+        size_t m_setIndex = 0;
+        bool m_setFilled = false;
+    };
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an invalid Recurrence object. @see isValid()
+    Recurrence() = default;
+
+    /// Copy-constructs a Recurrence object from \p other.
+    Recurrence(const Recurrence& other) = default;
+
+    /// Move-constructs a Recurrence object from \p other.
+    Recurrence(Recurrence&& other) = default;
+
+    /// Default destructor.
+    ~Recurrence() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    Recurrence& operator=(const Recurrence& other) = default;
+
+    /// Move assignment operator.
+    Recurrence& operator=(Recurrence&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns whether this rule is valid; that is, whether it was parsed successfully. @see fromString()
+    bool isValid() const
+    {
+        return m_valid;
+    }
+
+    /// Returns the frequency of this rule.
+    Frequency frequency() const
+    {
+        return m_frequency;
+    }
+
+    /// Returns the interval of this rule, which is 1 if the rule has no "INTERVAL" part.
+    long interval() const
+    {
+        return m_interval;
+    }
+
+    /// Returns the number of occurrences of this rule, or zero if the rule has no "COUNT" part.
+    long count() const
+    {
+        return m_count;
+    }
+
+    /// Returns the last datetime of this rule, or an invalid DateTime object if the rule has no "UNTIL" part.
+    DateTime until() const
+    {
+        return m_until;
+    }
+
+    /// @}
+
+    /**
+     * @name Generating Methods
+     * @{
+     */
+
+    /// Returns a cursor over the occurrences of this rule on and after \p start.
+    Cursor occurrences(const DateTime& start) const
+    {
+        return Cursor(*this, start);
+    }
+
+    /// Returns the first occurrence of this rule, starting at \p start, that is after \p after, or an invalid DateTime object if there is none.
+    DateTime next(const DateTime& start, const DateTime& after) const
+    {
+        Cursor cursor(*this, start);
+        cursor.seek(after);
+        DateTime occurrence;
+        while (cursor.next(occurrence)) {
+            if (after < occurrence)
+                return occurrence;
+        }
+        return DateTime();
+    }
+
+    /**
+     * Writes the occurrences of this rule, starting at \p start, that are on or after \p from and before \p to into \p occurrences, in order, and returns their number.
+     * At most \p capacity occurrences are written; if there are more, the rest can be generated by calling this method again with \p from set after the last one written.
+     */
+    size_t expand(const DateTime& start, const DateTime& from, const DateTime& to, DateTime* occurrences, size_t capacity) const
+    {
+        Cursor cursor(*this, start);
+        if (!to.isValid())
+            return 0;
+        cursor.limit(to.toDaysSinceEpoch(), to.time().toNanosecondsSinceMidnight());
+        cursor.seek(from);
+        size_t size = 0;
+        while (size < capacity && cursor.next(occurrences[size]))
+            ++size;
+        return size;
+    }
+
+    /// @}
+
+    /**
+     * @name Parsing Methods
+     * @{
+     */
+
+    /**
+     * Returns a Recurrence object from the RFC 5545 rule \p rule, such as "FREQ=WEEKLY;INTERVAL=2;BYDAY=TU,TH", optionally prefixed with "RRULE:".
+     * The names and values are case-insensitive. If the rule is malformed, or breaks a constraint of RFC 5545, such as both "COUNT" and "UNTIL", or "BYWEEKNO" in a rule that is not yearly, returns an invalid Recurrence object.
+     */
+    static Recurrence fromString(const std::string& rule)
+    {
+        std::string text(rule);
+        for (char& c : text) {
+            if (c >= 'a' && c <= 'z')
+                c = static_cast<char>(c - 'a' + 'A');
+        }
+        if (text.compare(0, 6, "RRULE:") == 0)
+            text.erase(0, 6);
+        Recurrence result;
+        bool hasFrequency = false, hasNth = false;
+        unsigned seen = 0;
+        size_t pos = 0;
+        while (pos < text.size()) {
+            size_t end = text.find(';', pos);
+            if (end == std::string::npos)
+                end = text.size();
+            const size_t equals = text.find('=', pos);
+            if (equals == std::string::npos || equals >= end)
+                return Recurrence();
+            const std::string name = text.substr(pos, equals - pos);
+            const std::string value = text.substr(equals + 1, end - equals - 1);
+            pos = end + 1;
+            static const char* const names[] = { "FREQ", "INTERVAL", "COUNT", "UNTIL", "BYSECOND", "BYMINUTE", "BYHOUR", "BYDAY", "BYMONTHDAY", "BYYEARDAY", "BYWEEKNO", "BYMONTH", "BYSETPOS", "WKST" };
+            int part = 0;
+            while (part < 14 && name != names[part])
+                ++part;
+            if (part == 14 || (seen >> part & 1) || value.empty())
+                return Recurrence();
+            seen |= 1u << part;
+            bool ok = true;
+            switch (part) {
+            case 0: {
+                static const char* const frequencies[] = { "YEARLY", "MONTHLY", "WEEKLY", "DAILY", "HOURLY", "MINUTELY", "SECONDLY" };
+                int frequency = 0;
+                while (frequency < 7 && value != frequencies[frequency])
+                    ++frequency;
+                ok = frequency < 7;
+                result.m_frequency = static_cast<Frequency>(frequency);
+                hasFrequency = true;
+                break;
+            }
+            case 1:
+                ok = internal::readPositiveNumber(value, result.m_interval);
+                break;
+            case 2:
+                ok = internal::readPositiveNumber(value, result.m_count);
+                break;
+            case 3:
+                ok = parseUntil(value, result.m_until);
+                break;
+            case 4:
+                ok = internal::readNumberList(value, 60, false, true, [&](int n) { result.m_bySecond |= std::uint64_t(1) << n; });
+                break;
+            case 5:
+                ok = internal::readNumberList(value, 59, false, true, [&](int n) { result.m_byMinute |= std::uint64_t(1) << n; });
+                break;
+            case 6:
+                ok = internal::readNumberList(value, 23, false, true, [&](int n) { result.m_byHour |= 1u << n; });
+                break;
+            case 7:
+                ok = parseDays(value, result, hasNth);
+                break;
+            case 8:
+                ok = internal::readNumberList(value, 31, true, false, [&](int n) {
+                    if (n > 0)
+                        result.m_byMonthDay |= 1u << n;
+                    else
+                        result.m_byMonthDayFromEnd |= 1u << -n;
+                });
+                break;
+            case 9:
+                ok = internal::readNumberList(value, 366, true, false, [&](int n) {
+                    if (n > 0)
+                        result.m_byYearDay.set(n);
+                    else
+                        result.m_byYearDayFromEnd.set(-n);
+                });
+                break;
+            case 10:
+                ok = internal::readNumberList(value, 53, true, false, [&](int n) {
+                    if (n > 0)
+                        result.m_byWeekNo |= std::uint64_t(1) << n;
+                    else
+                        result.m_byWeekNoFromEnd |= std::uint64_t(1) << -n;
+                });
+                break;
+            case 11:
+                ok = internal::readNumberList(value, 12, false, false, [&](int n) { result.m_byMonth |= static_cast<std::uint16_t>(1u << n); });
+                break;
+            case 12:
+                ok = internal::readNumberList(value, 366, true, false, [&](int n) { result.m_bySetPos.push_back(n); });
+                break;
+            default:
+                ok = (result.m_weekStart = parseWeekday(value, 0)) != 0 && value.size() == 2;
+                break;
+            }
+            if (!ok)
+                return Recurrence();
+        }
+        const Frequency frequency = result.m_frequency;
+        const bool hasWeekNo = result.m_byWeekNo || result.m_byWeekNoFromEnd;
+        const bool hasYearDay = result.m_byYearDay.any() || result.m_byYearDayFromEnd.any();
+        const bool hasMonthDay = result.m_byMonthDay || result.m_byMonthDayFromEnd;
+        if (!hasFrequency || (result.m_count && result.m_until.isValid())
+            || (hasWeekNo && frequency != Frequency::Yearly)
+            || (hasYearDay && (frequency == Frequency::Monthly || frequency == Frequency::Weekly || frequency == Frequency::Daily))
+            || (hasMonthDay && frequency == Frequency::Weekly)
+            || (hasNth && (frequency > Frequency::Monthly || (frequency == Frequency::Yearly && hasWeekNo))))
+            return Recurrence();
+        result.m_valid = true;
+        return result;
+    }
+
+    /// @}
+
+private:
+    // Returns the weekday, from 1 (Monday) to 7 (Sunday), of the two-letter abbreviation at value[pos], or zero if there is none.
+    static int parseWeekday(const std::string& value, size_t pos)
+    {
+        static const char* const weekdays[] = { "MO", "TU", "WE", "TH", "FR", "SA", "SU" };
+        for (int weekday = 0; weekday < 7; ++weekday) {
+            if (value.compare(pos, std::string::npos, weekdays[weekday]) == 0 || (value.size() > pos + 2 && value.compare(pos, 2, weekdays[weekday]) == 0 && value[pos + 2] == ','))
+                return weekday + 1;
+        }
+        return 0;
+    }
+
+    // Parses the "BYDAY" value, such as "MO,-1FR,2TU", into the weekday masks of rule, and sets hasNth if any weekday has an ordinal.
+    static bool parseDays(const std::string& value, Recurrence& rule, bool& hasNth)
+    {
+        size_t pos = 0;
+        do {
+            const bool minus = value[pos] == '-';
+            const bool sign = minus || value[pos] == '+';
+            if (sign)
+                ++pos;
+            int nth = 0;
+            const size_t first = pos;
+            while (pos < value.size() && value[pos] >= '0' && value[pos] <= '9' && pos - first < 2)
+                nth = nth * 10 + (value[pos++] - '0');
+            const int weekday = parseWeekday(value, pos);
+            if (weekday == 0 || nth > 53 || ((sign || pos != first) && nth == 0))
+                return false;
+            if (nth == 0) {
+                rule.m_byWeekday |= static_cast<std::uint8_t>(1u << weekday);
+            } else if (minus) {
+                rule.m_byNthWeekdayFromEnd[weekday] |= std::uint64_t(1) << nth;
+            } else {
+                rule.m_byNthWeekday[weekday] |= std::uint64_t(1) << nth;
+            }
+            hasNth = hasNth || nth != 0;
+            pos += 2;
+        } while (pos++ < value.size());
+        rule.m_hasByDay = true;
+        return true;
+    }
+
+    // Parses the "UNTIL" value, either a date "yyyyMMdd", or a datetime "yyyyMMddThhmmss" optionally followed by "Z". A date includes the whole day.
+    static bool parseUntil(const std::string& value, DateTime& until)
+    {
+        if (value.size() != 8 && (value.size() < 15 || value.size() > 16 || value[8] != 'T' || (value.size() == 16 && value[15] != 'Z')))
+            return false;
+        int fields[6] = { 0, 0, 0, 23, 59, 59 };
+        static const int offsets[6] = { 0, 4, 6, 9, 11, 13 };
+        static const int widths[6] = { 4, 2, 2, 2, 2, 2 };
+        for (int i = 0; i < (value.size() == 8 ? 3 : 6); ++i) {
+            fields[i] = 0;
+            for (int j = 0; j < widths[i]; ++j) {
+                const char c = value[offsets[i] + j];
+                if (c < '0' || c > '9')
+                    return false;
+                fields[i] = fields[i] * 10 + (c - '0');
+            }
+        }
+        until = DateTime(Date(fields[0], fields[1], fields[2]), Time(fields[3], fields[4], fields[5], Time::Nanoseconds(value.size() == 8 ? 999999999 : 0)));
+        return until.isValid();
+    }
+
+    Frequency m_frequency = Frequency::Yearly;
+    long m_interval = 1;
+    long m_count = 0;
+    DateTime m_until;
+    std::uint16_t m_byMonth = 0;
+    std::uint32_t m_byMonthDay = 0;
+    std::uint32_t m_byMonthDayFromEnd = 0;
+    std::uint64_t m_byWeekNo = 0;
+    std::uint64_t m_byWeekNoFromEnd = 0;
+    std::bitset<367> m_byYearDay;
+    std::bitset<367> m_byYearDayFromEnd;
+    std::uint8_t m_byWeekday = 0;
+    std::uint64_t m_byNthWeekday[8] = {};
+    std::uint64_t m_byNthWeekdayFromEnd[8] = {};
+    bool m_hasByDay = false;
+    std::uint32_t m_byHour = 0;
+    std::uint64_t m_byMinute = 0;
+    std::uint64_t m_bySecond = 0;
+    std::vector<int> m_bySetPos;
+    int m_weekStart = 1;
+    bool m_valid = false;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_RECURRENCE_HPP
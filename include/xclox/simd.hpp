@@ -0,0 +1,370 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_SIMD_HPP
+#define XCLOX_SIMD_HPP
+
+#include "internal.hpp"
+
+#if !defined(XCLOX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define XCLOX_HAS_SSE2
+#include <emmintrin.h>
+#endif
+
+#if !defined(XCLOX_NO_SIMD) && (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define XCLOX_HAS_AVX
+#define XCLOX_TARGET_AVX2 __attribute__((target("avx2")))
+#define XCLOX_TARGET_AVX512 __attribute__((target("avx512f")))
+#include <immintrin.h>
+#endif
+
+namespace xclox {
+
+namespace internal {
+
+    // The number of characters of the ISO-8601 layout "yyyy-MM-ddThh:mm:ss.fffffffff".
+    constexpr size_t IsoLayoutSize = 29;
+
+    // The number of characters of getIsoTemplate(), which is IsoLayoutSize padded to a whole number of 16-byte vectors.
+    constexpr size_t IsoBufferSize = 32;
+
+    // Returns the IsoBufferSize-character template of the ISO-8601 layout, where every digit position holds '0'.
+    // The parsers below read a timestamp of the first 19 to IsoLayoutSize characters of the layout, such as "yyyy-MM-ddThh:mm:ss" or "yyyy-MM-ddThh:mm:ss.fff", as if the rest were taken from the template; so the missing subsecond digits are zeros.
+    inline const char* getIsoTemplate()
+    {
+        static const char isoTemplate[IsoBufferSize + 1] = "0000-00-00T00:00:00.000000000000";
+        return isoTemplate;
+    }
+
+    // Returns whether the parsed time fields are in range. The date fields are left to Date::isValid().
+    inline bool isIsoTimeInRange(const DateTimeFields& fields)
+    {
+        return fields.hour < 24 && fields.minute < 60 && fields.second < 60;
+    }
+
+    // Parses the size characters at src, laid out as the beginning of getIsoTemplate() with separator in place of 'T', into fields, one character at a time.
+    // Returns false if a digit or a separator is misplaced or a time field is out of range.
+    inline bool parseIsoScalar(const char* src, size_t size, char separator, DateTimeFields& fields)
+    {
+        const char* isoTemplate = getIsoTemplate();
+        for (size_t i = 0; i < size; ++i) {
+            const bool isDigitExpected = isoTemplate[i] == '0';
+            const bool isDigit = static_cast<unsigned char>(src[i] - '0') <= 9;
+            if (isDigitExpected ? !isDigit : src[i] != (i == 10 ? separator : isoTemplate[i]))
+                return false;
+        }
+        const auto digit = [src, size](size_t i) { return i < size ? src[i] - '0' : 0; };
+        fields.year = digit(0) * 1000 + digit(1) * 100 + digit(2) * 10 + digit(3);
+        fields.month = digit(5) * 10 + digit(6);
+        fields.day = digit(8) * 10 + digit(9);
+        fields.hour = digit(11) * 10 + digit(12);
+        fields.minute = digit(14) * 10 + digit(15);
+        fields.second = digit(17) * 10 + digit(18);
+        fields.nanosecond = 0;
+        for (size_t i = 20; i < IsoLayoutSize; ++i)
+            fields.nanosecond = fields.nanosecond * 10 + digit(i);
+        return isIsoTimeInRange(fields);
+    }
+
+#ifdef XCLOX_HAS_SSE2
+    // Returns, in every 16-bit lane of digits, the two-digit number formed by the lane's low byte (tens) and high byte (units).
+    inline __m128i combineDigitPairs(__m128i digits)
+    {
+        const __m128i tens = _mm_and_si128(digits, _mm_set1_epi16(0xFF));
+        const __m128i units = _mm_srli_epi16(digits, 8);
+        return _mm_add_epi16(_mm_mullo_epi16(tens, _mm_set1_epi16(10)), units);
+    }
+
+    // Returns a mask of the bytes of input that match pattern, where a '0' in the pattern matches any digit. digits holds the bytes of input minus '0'.
+    inline __m128i matchIsoPattern(__m128i input, __m128i digits, __m128i pattern)
+    {
+        const __m128i zero = _mm_set1_epi8('0');
+        // A character is a digit if subtracting '0' from it gives an unsigned byte not greater than 9.
+        const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+        const __m128i isDigitExpected = _mm_cmpeq_epi8(pattern, zero);
+        return _mm_or_si128(_mm_and_si128(isDigitExpected, isDigit), _mm_andnot_si128(isDigitExpected, _mm_cmpeq_epi8(input, pattern)));
+    }
+
+    // Parses the Size characters at src, laid out as the beginning of getIsoTemplate() with separator in place of 'T', into fields, sixteen characters at a time.
+    // It reads the timestamp with two overlapping 16-byte loads, the second of which is shifted into place and completed from the template, so it never reads past the timestamp.
+    // It then validates all digits and separators with a handful of vector comparisons, and combines every two adjacent digits into a number with one vector multiply-add.
+    // The pairs starting at even offsets and those starting at odd offsets are combined separately, so that every field is found in a single 16-bit lane.
+    // Returns false if a digit or a separator is misplaced or a time field is out of range.
+    template <size_t Size>
+    inline bool parseIsoSse2(const char* src, char separator, DateTimeFields& fields)
+    {
+        static_assert(Size >= 19 && Size <= IsoLayoutSize, "the timestamp must have between 19 and 29 characters");
+        const __m128i zero = _mm_set1_epi8('0');
+        const __m128i lowPattern = _mm_insert_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(getIsoTemplate())), static_cast<unsigned char>(separator) | '0' << 8, 5);
+        const __m128i highPattern = _mm_loadu_si128(reinterpret_cast<const __m128i*>(getIsoTemplate() + 16));
+        const __m128i lowInput = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        const __m128i highInput = _mm_or_si128(
+            _mm_srli_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(src + Size - 16)), 32 - Size),
+            _mm_slli_si128(_mm_srli_si128(highPattern, Size - 16), Size - 16));
+        const __m128i lowDigits = _mm_sub_epi8(lowInput, zero);
+        const __m128i highDigits = _mm_sub_epi8(highInput, zero);
+        if (_mm_movemask_epi8(_mm_and_si128(matchIsoPattern(lowInput, lowDigits, lowPattern), matchIsoPattern(highInput, highDigits, highPattern))) != 0xFFFF)
+            return false;
+
+        // Offsets:        0123456789012345 6789012345678901
+        // Layout:         yyyy-MM-ddThh:mm :ss.fffffffff000
+        const __m128i lowEven = combineDigitPairs(lowDigits);
+        const __m128i lowOdd = combineDigitPairs(_mm_srli_si128(lowDigits, 1));
+        const __m128i highOdd = combineDigitPairs(_mm_srli_si128(highDigits, 1));
+        fields.year = _mm_extract_epi16(lowEven, 0) * 100 + _mm_extract_epi16(lowEven, 1);
+        fields.month = _mm_extract_epi16(lowOdd, 2);
+        fields.day = _mm_extract_epi16(lowEven, 4);
+        fields.hour = _mm_extract_epi16(lowOdd, 5);
+        fields.minute = _mm_extract_epi16(lowEven, 7);
+        fields.second = _mm_extract_epi16(highOdd, 0);
+        fields.nanosecond = (_mm_extract_epi16(highDigits, 2) & 0xFF) * 100000000L + ((_mm_extract_epi16(highOdd, 2) * 100L + _mm_extract_epi16(highOdd, 3)) * 100L + _mm_extract_epi16(highOdd, 4)) * 100L + _mm_extract_epi16(highOdd, 5);
+        return isIsoTimeInRange(fields);
+    }
+#endif
+
+    // Parses the Size characters at src, laid out as the beginning of getIsoTemplate() with separator in place of 'T', into fields.
+    // It uses SSE2 vector instructions where the target supports them (every x86-64 CPU does), and scalar code otherwise, or if XCLOX_NO_SIMD is defined.
+    template <size_t Size>
+    inline bool parseIso(const char* src, char separator, DateTimeFields& fields)
+    {
+#ifdef XCLOX_HAS_SSE2
+        return parseIsoSse2<Size>(src, separator, fields);
+#else
+        return parseIsoScalar(src, Size, separator, fields);
+#endif
+    }
+
+    // Same as parseIso<Size>(), where the number of characters size is known only at runtime. Returns false if it is not that of a timestamp with zero to nine subsecond digits.
+    inline bool parseIso(const char* src, size_t size, char separator, DateTimeFields& fields)
+    {
+        switch (size) {
+        case 19:
+            return parseIso<19>(src, separator, fields);
+        case 21:
+            return parseIso<21>(src, separator, fields);
+        case 22:
+            return parseIso<22>(src, separator, fields);
+        case 23:
+            return parseIso<23>(src, separator, fields);
+        case 24:
+            return parseIso<24>(src, separator, fields);
+        case 25:
+            return parseIso<25>(src, separator, fields);
+        case 26:
+            return parseIso<26>(src, separator, fields);
+        case 27:
+            return parseIso<27>(src, separator, fields);
+        case 28:
+            return parseIso<28>(src, separator, fields);
+        case 29:
+            return parseIso<29>(src, separator, fields);
+        default:
+            return false;
+        }
+    }
+
+    // The vector instruction sets the civil conversion kernels below can use, from the least to the most capable.
+    enum class SimdLevel {
+        None,
+        Avx2,
+        Avx512
+    };
+
+    // Returns the most capable instruction set the CPU supports, detected once at the first call.
+    // It is always SimdLevel::None unless the target is x86 and the compiler is GCC or Clang, which can compile a function for an instruction set the rest of the program does not assume; or if XCLOX_NO_SIMD is defined.
+    inline SimdLevel getSimdLevel()
+    {
+#ifdef XCLOX_HAS_AVX
+        static const SimdLevel level = __builtin_cpu_supports("avx512f") ? SimdLevel::Avx512 : __builtin_cpu_supports("avx2") ? SimdLevel::Avx2 : SimdLevel::None;
+        return level;
+#else
+        return SimdLevel::None;
+#endif
+    }
+
+    // The civil conversions of whole arrays run Howard Hinnant's algorithms (http://howardhinnant.github.io/date_algorithms.html) on unsigned 32-bit integers, which vector instructions handle eight or sixteen at a time.
+    // The algorithms count days from "-0001-03-01" (year 0 of the proleptic Gregorian calendar); the days are shifted by a further CivilEraCount 400-year eras,
+    // so that every day from -2147468786 (CivilDaysOffset days before the epoch) to 2147483647 maps to an unsigned 32-bit integer.
+    constexpr std::uint32_t CivilEraCount = 14694;
+
+    // The days from the earliest day the civil conversions of whole arrays support to the epoch. See CivilEraCount.
+    constexpr std::uint32_t CivilDaysOffset = 719468 + CivilEraCount * 146097;
+
+    // The years the civil conversions of whole arrays shift the years by. See CivilEraCount.
+    constexpr std::uint32_t CivilYearOffset = CivilEraCount * 400;
+
+    // Returns the floor of the base-2 logarithm of value, which must be positive.
+    constexpr int floorLog2(std::uint32_t value)
+    {
+        return value < 2 ? 0 : 1 + floorLog2(value / 2);
+    }
+
+    // The multiplier and the shift that divide an unsigned 32-bit integer by Divisor with a 32 by 32 to 64-bit multiplication and a right shift, as compilers do for scalar divisions by constants.
+    // The quotients are exact for the divisors and the ranges of the dividends of the civil conversions below, as the unit tests verify, though not for every divisor and every 32-bit dividend.
+    template <std::uint32_t Divisor>
+    struct Reciprocal {
+        static constexpr int Shift = 31 + floorLog2(Divisor);
+        static constexpr std::uint64_t Multiplier = ((std::uint64_t(1) << Shift) + Divisor - 1) / Divisor;
+    };
+
+#ifdef XCLOX_HAS_AVX
+    // Returns the eight unsigned 32-bit lanes of value divided by Divisor.
+    template <std::uint32_t Divisor>
+    XCLOX_TARGET_AVX2 inline __m256i divideAvx2(__m256i value)
+    {
+        const __m256i multiplier = _mm256_set1_epi64x(static_cast<long long>(Reciprocal<Divisor>::Multiplier));
+        const __m256i even = _mm256_srli_epi64(_mm256_mul_epu32(value, multiplier), Reciprocal<Divisor>::Shift);
+        const __m256i odd = _mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(value, 32), multiplier), Reciprocal<Divisor>::Shift);
+        return _mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA);
+    }
+
+    // Converts the days since the epoch of the first count / 8 * 8 elements of dys to civil dates, eight at a time, and returns their number. See daysToYmd().
+    XCLOX_TARGET_AVX2 inline size_t daysToYmdAvx2(const std::int32_t* dys, size_t count, int* year, int* month, int* day)
+    {
+        const size_t vectorCount = count / 8 * 8;
+        for (size_t i = 0; i < vectorCount; i += 8) {
+            const __m256i z = _mm256_add_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(dys + i)), _mm256_set1_epi32(static_cast<int>(CivilDaysOffset)));
+            const __m256i era = divideAvx2<146097>(z);
+            const __m256i doe = _mm256_sub_epi32(z, _mm256_mullo_epi32(era, _mm256_set1_epi32(146097))); // [0, 146096]
+            const __m256i yoe = divideAvx2<365>(_mm256_sub_epi32(_mm256_add_epi32(_mm256_sub_epi32(doe, divideAvx2<1460>(doe)), divideAvx2<36524>(doe)), divideAvx2<146096>(doe))); // [0, 399]
+            const __m256i doy = _mm256_sub_epi32(doe, _mm256_sub_epi32(_mm256_add_epi32(_mm256_mullo_epi32(yoe, _mm256_set1_epi32(365)), _mm256_srli_epi32(yoe, 2)), divideAvx2<100>(yoe))); // [0, 365]
+            const __m256i mp = divideAvx2<153>(_mm256_add_epi32(_mm256_mullo_epi32(doy, _mm256_set1_epi32(5)), _mm256_set1_epi32(2))); // [0, 11]
+            const __m256i isJanuaryOrFebruary = _mm256_cmpgt_epi32(mp, _mm256_set1_epi32(9)); // all ones if true.
+            const __m256i m = _mm256_add_epi32(_mm256_add_epi32(mp, _mm256_set1_epi32(3)), _mm256_and_si256(isJanuaryOrFebruary, _mm256_set1_epi32(-12)));
+            const __m256i y = _mm256_sub_epi32(_mm256_sub_epi32(_mm256_add_epi32(yoe, _mm256_mullo_epi32(era, _mm256_set1_epi32(400))), isJanuaryOrFebruary), _mm256_set1_epi32(static_cast<int>(CivilYearOffset)));
+            const __m256i d = _mm256_sub_epi32(doy, _mm256_sub_epi32(divideAvx2<5>(_mm256_add_epi32(_mm256_mullo_epi32(mp, _mm256_set1_epi32(153)), _mm256_set1_epi32(2))), _mm256_set1_epi32(1)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(year + i), _mm256_add_epi32(y, _mm256_cmpgt_epi32(_mm256_set1_epi32(1), y))); // there is no year 0.
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(month + i), m);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(day + i), d);
+        }
+        return vectorCount;
+    }
+
+    // Converts the civil dates of the first count / 8 * 8 elements of year, month, and day to days since the epoch, eight at a time, and returns their number. See ymdToDays().
+    XCLOX_TARGET_AVX2 inline size_t ymdToDaysAvx2(const int* year, const int* month, const int* day, size_t count, std::int32_t* dys)
+    {
+        const size_t vectorCount = count / 8 * 8;
+        for (size_t i = 0; i < vectorCount; i += 8) {
+            const __m256i yr = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(year + i));
+            const __m256i m = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(month + i));
+            const __m256i isAfterFebruary = _mm256_cmpgt_epi32(m, _mm256_set1_epi32(2)); // all ones if true.
+            // The year starting in March, shifted as CivilEraCount says, plus one if the year is negative; i.e. before common era.
+            const __m256i y = _mm256_add_epi32(_mm256_sub_epi32(_mm256_sub_epi32(yr, _mm256_cmpgt_epi32(_mm256_set1_epi32(1), yr)), _mm256_andnot_si256(isAfterFebruary, _mm256_set1_epi32(1))), _mm256_set1_epi32(static_cast<int>(CivilYearOffset)));
+            const __m256i era = divideAvx2<400>(y);
+            const __m256i yoe = _mm256_sub_epi32(y, _mm256_mullo_epi32(era, _mm256_set1_epi32(400))); // [0, 399]
+            const __m256i mp = _mm256_add_epi32(_mm256_add_epi32(m, _mm256_set1_epi32(9)), _mm256_and_si256(isAfterFebruary, _mm256_set1_epi32(-12)));
+            const __m256i doy = _mm256_add_epi32(divideAvx2<5>(_mm256_add_epi32(_mm256_mullo_epi32(mp, _mm256_set1_epi32(153)), _mm256_set1_epi32(2))), _mm256_sub_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(day + i)), _mm256_set1_epi32(1))); // [0, 365]
+            const __m256i doe = _mm256_add_epi32(_mm256_sub_epi32(_mm256_add_epi32(_mm256_mullo_epi32(yoe, _mm256_set1_epi32(365)), _mm256_srli_epi32(yoe, 2)), divideAvx2<100>(yoe)), doy); // [0, 146096]
+            const __m256i days = _mm256_sub_epi32(_mm256_add_epi32(_mm256_mullo_epi32(era, _mm256_set1_epi32(146097)), doe), _mm256_set1_epi32(static_cast<int>(CivilDaysOffset)));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dys + i), days);
+        }
+        return vectorCount;
+    }
+
+// GCC 12 warns that the placeholder vectors of its own AVX-512 intrinsics may be used uninitialized.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+
+    // Returns the sixteen unsigned 32-bit lanes of value divided by Divisor.
+    template <std::uint32_t Divisor>
+    XCLOX_TARGET_AVX512 inline __m512i divideAvx512(__m512i value)
+    {
+        const __m512i multiplier = _mm512_set1_epi64(static_cast<long long>(Reciprocal<Divisor>::Multiplier));
+        const __m512i even = _mm512_srli_epi64(_mm512_mul_epu32(value, multiplier), Reciprocal<Divisor>::Shift);
+        const __m512i odd = _mm512_srli_epi64(_mm512_mul_epu32(_mm512_srli_epi64(value, 32), multiplier), Reciprocal<Divisor>::Shift);
+        return _mm512_mask_blend_epi32(0xAAAA, even, _mm512_slli_epi64(odd, 32));
+    }
+
+    // Converts the days since the epoch of the first count / 16 * 16 elements of dys to civil dates, sixteen at a time, and returns their number. See daysToYmd().
+    XCLOX_TARGET_AVX512 inline size_t daysToYmdAvx512(const std::int32_t* dys, size_t count, int* year, int* month, int* day)
+    {
+        const size_t vectorCount = count / 16 * 16;
+        for (size_t i = 0; i < vectorCount; i += 16) {
+            const __m512i z = _mm512_add_epi32(_mm512_loadu_si512(dys + i), _mm512_set1_epi32(static_cast<int>(CivilDaysOffset)));
+            const __m512i era = divideAvx512<146097>(z);
+            const __m512i doe = _mm512_sub_epi32(z, _mm512_mullo_epi32(era, _mm512_set1_epi32(146097))); // [0, 146096]
+            const __m512i yoe = divideAvx512<365>(_mm512_sub_epi32(_mm512_add_epi32(_mm512_sub_epi32(doe, divideAvx512<1460>(doe)), divideAvx512<36524>(doe)), divideAvx512<146096>(doe))); // [0, 399]
+            const __m512i doy = _mm512_sub_epi32(doe, _mm512_sub_epi32(_mm512_add_epi32(_mm512_mullo_epi32(yoe, _mm512_set1_epi32(365)), _mm512_srli_epi32(yoe, 2)), divideAvx512<100>(yoe))); // [0, 365]
+            const __m512i mp = divideAvx512<153>(_mm512_add_epi32(_mm512_mullo_epi32(doy, _mm512_set1_epi32(5)), _mm512_set1_epi32(2))); // [0, 11]
+            const __mmask16 isJanuaryOrFebruary = _mm512_cmpgt_epu32_mask(mp, _mm512_set1_epi32(9));
+            const __m512i m = _mm512_mask_sub_epi32(_mm512_add_epi32(mp, _mm512_set1_epi32(3)), isJanuaryOrFebruary, mp, _mm512_set1_epi32(9));
+            const __m512i shiftedYear = _mm512_add_epi32(yoe, _mm512_mullo_epi32(era, _mm512_set1_epi32(400)));
+            const __m512i y = _mm512_sub_epi32(_mm512_mask_add_epi32(shiftedYear, isJanuaryOrFebruary, shiftedYear, _mm512_set1_epi32(1)), _mm512_set1_epi32(static_cast<int>(CivilYearOffset)));
+            const __m512i d = _mm512_sub_epi32(doy, _mm512_sub_epi32(divideAvx512<5>(_mm512_add_epi32(_mm512_mullo_epi32(mp, _mm512_set1_epi32(153)), _mm512_set1_epi32(2))), _mm512_set1_epi32(1)));
+            _mm512_storeu_si512(year + i, _mm512_mask_sub_epi32(y, _mm512_cmplt_epi32_mask(y, _mm512_set1_epi32(1)), y, _mm512_set1_epi32(1))); // there is no year 0.
+            _mm512_storeu_si512(month + i, m);
+            _mm512_storeu_si512(day + i, d);
+        }
+        return vectorCount;
+    }
+
+    // Converts the civil dates of the first count / 16 * 16 elements of year, month, and day to days since the epoch, sixteen at a time, and returns their number. See ymdToDays().
+    XCLOX_TARGET_AVX512 inline size_t ymdToDaysAvx512(const int* year, const int* month, const int* day, size_t count, std::int32_t* dys)
+    {
+        const size_t vectorCount = count / 16 * 16;
+        for (size_t i = 0; i < vectorCount; i += 16) {
+            const __m512i yr = _mm512_loadu_si512(year + i);
+            const __m512i m = _mm512_loadu_si512(month + i);
+            const __mmask16 isAfterFebruary = _mm512_cmpgt_epi32_mask(m, _mm512_set1_epi32(2));
+            // The year starting in March, shifted as CivilEraCount says, plus one if the year is negative; i.e. before common era.
+            const __m512i shiftedYear = _mm512_add_epi32(_mm512_mask_add_epi32(yr, _mm512_cmplt_epi32_mask(yr, _mm512_set1_epi32(1)), yr, _mm512_set1_epi32(1)), _mm512_set1_epi32(static_cast<int>(CivilYearOffset)));
+            const __m512i y = _mm512_mask_sub_epi32(shiftedYear, static_cast<__mmask16>(~isAfterFebruary), shiftedYear, _mm512_set1_epi32(1));
+            const __m512i era = divideAvx512<400>(y);
+            const __m512i yoe = _mm512_sub_epi32(y, _mm512_mullo_epi32(era, _mm512_set1_epi32(400))); // [0, 399]
+            const __m512i mp = _mm512_mask_sub_epi32(_mm512_add_epi32(m, _mm512_set1_epi32(9)), isAfterFebruary, m, _mm512_set1_epi32(3));
+            const __m512i doy = _mm512_add_epi32(divideAvx512<5>(_mm512_add_epi32(_mm512_mullo_epi32(mp, _mm512_set1_epi32(153)), _mm512_set1_epi32(2))), _mm512_sub_epi32(_mm512_loadu_si512(day + i), _mm512_set1_epi32(1))); // [0, 365]
+            const __m512i doe = _mm512_add_epi32(_mm512_sub_epi32(_mm512_add_epi32(_mm512_mullo_epi32(yoe, _mm512_set1_epi32(365)), _mm512_srli_epi32(yoe, 2)), divideAvx512<100>(yoe)), doy); // [0, 146096]
+            const __m512i days = _mm512_sub_epi32(_mm512_add_epi32(_mm512_mullo_epi32(era, _mm512_set1_epi32(146097)), doe), _mm512_set1_epi32(static_cast<int>(CivilDaysOffset)));
+            _mm512_storeu_si512(dys + i, days);
+        }
+        return vectorCount;
+    }
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#endif
+
+    // Converts as many leading elements of dys to civil dates with vector instructions as getSimdLevel() allows, and returns their number, which may be zero. See daysToYmd().
+    inline size_t daysToYmdSimd(const std::int32_t* dys, size_t count, int* year, int* month, int* day)
+    {
+#ifdef XCLOX_HAS_AVX
+        switch (getSimdLevel()) {
+        case SimdLevel::Avx512:
+            return daysToYmdAvx512(dys, count, year, month, day);
+        case SimdLevel::Avx2:
+            return daysToYmdAvx2(dys, count, year, month, day);
+        default:
+            break;
+        }
+#endif
+        return 0;
+    }
+
+    // Converts as many leading civil dates of year, month, and day to days since the epoch with vector instructions as getSimdLevel() allows, and returns their number, which may be zero. See ymdToDays().
+    inline size_t ymdToDaysSimd(const int* year, const int* month, const int* day, size_t count, std::int32_t* dys)
+    {
+#ifdef XCLOX_HAS_AVX
+        switch (getSimdLevel()) {
+        case SimdLevel::Avx512:
+            return ymdToDaysAvx512(year, month, day, count, dys);
+        case SimdLevel::Avx2:
+            return ymdToDaysAvx2(year, month, day, count, dys);
+        default:
+            break;
+        }
+#endif
+        return 0;
+    }
+
+} // namespace internal
+
+} // namespace xclox
+
+#endif // XCLOX_SIMD_HPP
@@ -8,10 +8,56 @@
 #ifndef XCLOX_TIME_HPP
 #define XCLOX_TIME_HPP
 
-#include "internal.hpp"
+#include "format.hpp"
 
 namespace xclox {
 
+namespace internal {
+
+    // Reads the time fields from the size characters at input according to format, as Time::fromChars() does, except that the fields are not validated. It neither throws nor allocates memory.
+    inline ParseResult parseTime(const char* input, size_t size, const Format& format, DateTimeFields& fields)
+    {
+        fields = { 0, 0, 0, 0, 0, 0, 0 };
+        size_t pos = 0;
+        for (const auto& token : format.tokens()) {
+            if (pos >= size)
+                break;
+
+            const auto count = static_cast<size_t>(token.count);
+            if (token.flag == 'h' || token.flag == 'H' || token.flag == 'm' || token.flag == 's') {
+                if (!std::isdigit(static_cast<unsigned char>(input[pos])))
+                    return { ParseError::MissingValue, pos };
+                const int value = readDigits(input, size, pos, 2);
+                (token.flag == 'm' ? fields.minute : token.flag == 's' ? fields.second : fields.hour) = value;
+            } else if (token.flag == 'f') {
+                if (count > 9)
+                    return { ParseError::InvalidPattern, pos };
+                // the subsecond is read from at most count characters, and the missing digits are taken as trailing zeros.
+                size_t end = pos;
+                const int value = readDigits(input, size, end, count);
+                if (end == pos)
+                    return { ParseError::MissingValue, pos };
+                fields.nanosecond = value * getPowerOfTen(9 - static_cast<int>(end - pos));
+                pos += count;
+            } else if (token.flag == 'a' || token.flag == 'A') {
+                for (size_t i = 0; i < count && pos < size; ++i) {
+                    if (hasTextAt(input, size, pos, "pm", 2) || hasTextAt(input, size, pos, "PM", 2)) {
+                        fields.hour = (fields.hour > 12 ? fields.hour : fields.hour + 12);
+                        pos += 2;
+                    } else if (hasTextAt(input, size, pos, "am", 2) || hasTextAt(input, size, pos, "AM", 2)) {
+                        pos += 2;
+                    }
+                }
+            } else {
+                // not a pattern, skip it in the time string.
+                pos += count;
+            }
+        }
+        return { ParseError::None, std::min(pos, size) };
+    }
+
+} // namespace internal
+
 /**
  * @class Time
  *
@@ -68,7 +114,7 @@ public:
      */
 
     /// Constructs an invalid Time object with every field is set to zero. @see isValid()
-    Time()
+    XCLOX_CONSTEXPR14 Time()
         : m_duration(Hours(24))
     {
     }
@@ -80,7 +126,7 @@ public:
     Time(Time&& other) = default;
 
     /// Constructs a Time object from the standard library **std::time_t** object \p scalarStdTime.
-    explicit Time(std::time_t scalarStdTime)
+    XCLOX_CONSTEXPR14 explicit Time(std::time_t scalarStdTime)
         : m_duration(Seconds(scalarStdTime))
     {
     }
@@ -100,7 +146,7 @@ public:
      *
      * @param duration can be **Time::Duration** or **std::chrono::duration**.
      */
-    explicit Time(const Duration& duration)
+    XCLOX_CONSTEXPR14 explicit Time(const Duration& duration)
         : m_duration(duration)
     {
     }
@@ -112,13 +158,13 @@ public:
     }
 
     /// Constructs a Time object from the given \p hours, \p minutes and \p seconds.
-    explicit Time(int hours, int minutes, int seconds)
+    XCLOX_CONSTEXPR14 explicit Time(int hours, int minutes, int seconds)
         : m_duration(Hours(hours) + Minutes(minutes) + Seconds(seconds))
     {
     }
 
     /// Constructs a Time object from the given \p hours, \p minutes, \p seconds and \p milliseconds.
-    explicit Time(int hours, int minutes, int seconds, int milliseconds)
+    XCLOX_CONSTEXPR14 explicit Time(int hours, int minutes, int seconds, int milliseconds)
         : m_duration(Hours(hours) + Minutes(minutes) + Seconds(seconds) + Milliseconds(milliseconds))
     {
     }
@@ -127,7 +173,7 @@ public:
      * Constructs a Time object from the given \p hours, \p minutes, \p seconds, and \p subseconds.
      * The \p subseconds parameter can be any fine duration of Time such as **Time::Microseconds(54)**, or any fine duration of chrono, such as **std::chrono::nanoseconds(435223543)**.
      */
-    explicit Time(int hours, int minutes, int seconds, const Duration& subseconds)
+    XCLOX_CONSTEXPR14 explicit Time(int hours, int minutes, int seconds, const Duration& subseconds)
         : m_duration(Hours(hours) + Minutes(minutes) + Seconds(seconds) + subseconds)
     {
     }
@@ -141,7 +187,7 @@ public:
      *    Time sameTime(std::chrono::hours(2), std::chrono::::minutes(55), std::chrono::::seconds(10), std::chrono::::nanoseconds(435223543));
      * @endcode
      */
-    explicit Time(Hours hours, Minutes minutes, Seconds seconds, const Duration& subseconds)
+    XCLOX_CONSTEXPR14 explicit Time(Hours hours, Minutes minutes, Seconds seconds, const Duration& subseconds)
         : m_duration(hours + minutes + seconds + subseconds)
     {
     }
@@ -172,37 +218,37 @@ public:
      */
 
     /// Returns whether this time is earlier than \p other.
-    bool operator<(const Time& other) const
+    XCLOX_CONSTEXPR14 bool operator<(const Time& other) const
     {
         return this->m_duration < other.m_duration;
     }
 
     /// Returns whether this time is earlier than \p other or equal to it.
-    bool operator<=(const Time& other) const
+    XCLOX_CONSTEXPR14 bool operator<=(const Time& other) const
     {
         return this->m_duration <= other.m_duration;
     }
 
     /// Returns whether this time is later than \p other.
-    bool operator>(const Time& other) const
+    XCLOX_CONSTEXPR14 bool operator>(const Time& other) const
     {
         return this->m_duration > other.m_duration;
     }
 
     /// Returns whether this time is later than \p other or equal to it.
-    bool operator>=(const Time& other) const
+    XCLOX_CONSTEXPR14 bool operator>=(const Time& other) const
     {
         return this->m_duration >= other.m_duration;
     }
 
     /// Returns whether this time is equal to \p other.
-    bool operator==(const Time& other) const
+    XCLOX_CONSTEXPR14 bool operator==(const Time& other) const
     {
         return this->m_duration == other.m_duration;
     }
 
     /// Returns whether this time is different from \p other.
-    bool operator!=(const Time& other) const
+    XCLOX_CONSTEXPR14 bool operator!=(const Time& other) const
     {
         return this->m_duration != other.m_duration;
     }
@@ -215,19 +261,19 @@ public:
      */
 
     /// Returns the result of adding \p duration to this time as a new Time object.
-    Time operator+(const Duration& duration) const
+    XCLOX_CONSTEXPR14 Time operator+(const Duration& duration) const
     {
         return Time(this->m_duration + duration);
     }
 
     /// Returns the result of subtracting \p duration from this time as a new Time object.
-    Time operator-(const Duration& duration) const
+    XCLOX_CONSTEXPR14 Time operator-(const Duration& duration) const
     {
         return Time(this->m_duration - duration);
     }
 
     /// Returns the result of subtracting \p other from this time as a **Time::Nanoseconds** duration.
-    Nanoseconds operator-(const Time& other) const
+    XCLOX_CONSTEXPR14 Nanoseconds operator-(const Time& other) const
     {
         return Nanoseconds(this->m_duration - other.m_duration);
     }
@@ -254,43 +300,43 @@ public:
      *    Time t8(std::chrono::system_clock::now()); // t8.isValid(); returns true.
      * @endcode
      */
-    bool isValid() const
+    XCLOX_CONSTEXPR14 bool isValid() const
     {
         return m_duration.count() >= 0 && m_duration < Days(1);
     }
 
     /// Returns the nanosecond of second (0, 999999999).
-    long nanosecond() const
+    XCLOX_CONSTEXPR14 long nanosecond() const
     {
         return static_cast<long>(std::chrono::duration_cast<Nanoseconds>(m_duration % Seconds(1)).count());
     }
 
     /// Returns the microsecond of second (0, 999999).
-    long microsecond() const
+    XCLOX_CONSTEXPR14 long microsecond() const
     {
         return static_cast<long>(std::chrono::duration_cast<Microseconds>(m_duration % Seconds(1)).count());
     }
 
     /// Returns the millisecond of second (0, 999).
-    int millisecond() const
+    XCLOX_CONSTEXPR14 int millisecond() const
     {
         return static_cast<int>(std::chrono::duration_cast<Milliseconds>(m_duration % Seconds(1)).count());
     }
 
     /// Returns the second of minute (0, 59).
-    int second() const
+    XCLOX_CONSTEXPR14 int second() const
     {
         return static_cast<int>(std::chrono::duration_cast<Seconds>(m_duration % Minutes(1)).count());
     }
 
     /// Returns the minute of hour (0, 59).
-    int minute() const
+    XCLOX_CONSTEXPR14 int minute() const
     {
         return std::chrono::duration_cast<Minutes>(m_duration % Hours(1)).count();
     }
 
     /// Returns the hour of day (0, 23).
-    int hour() const
+    XCLOX_CONSTEXPR14 int hour() const
     {
         return std::chrono::duration_cast<Hours>(m_duration % Days(1)).count();
     }
@@ -303,85 +349,85 @@ public:
      */
 
     /// Returns the result of adding \p nanoseconds to this time as a new Time object.
-    Time addNanoseconds(int nanoseconds) const
+    XCLOX_CONSTEXPR14 Time addNanoseconds(int nanoseconds) const
     {
         return Time(m_duration + Nanoseconds(nanoseconds));
     }
 
     /// Returns the result of subtracting \p nanoseconds from this time as a new Time object.
-    Time subtractNanoseconds(int nanoseconds) const
+    XCLOX_CONSTEXPR14 Time subtractNanoseconds(int nanoseconds) const
     {
         return Time(m_duration - Nanoseconds(nanoseconds));
     }
 
     /// Returns the result of adding \p microseconds to this time as a new Time object.
-    Time addMicroseconds(int microseconds) const
+    XCLOX_CONSTEXPR14 Time addMicroseconds(int microseconds) const
     {
         return Time(m_duration + Microseconds(microseconds));
     }
 
     /// Returns the result of subtracting \p microseconds from this time as a new Time object.
-    Time subtractMicroseconds(int microseconds) const
+    XCLOX_CONSTEXPR14 Time subtractMicroseconds(int microseconds) const
     {
         return Time(m_duration - Microseconds(microseconds));
     }
 
     /// Returns the result of adding \p milliseconds to this time as a new Time object.
-    Time addMilliseconds(int milliseconds) const
+    XCLOX_CONSTEXPR14 Time addMilliseconds(int milliseconds) const
     {
         return Time(m_duration + Milliseconds(milliseconds));
     }
 
     /// Returns the result of subtracting \p milliseconds from this time as a new Time object.
-    Time subtractMilliseconds(int milliseconds) const
+    XCLOX_CONSTEXPR14 Time subtractMilliseconds(int milliseconds) const
     {
         return Time(m_duration - Milliseconds(milliseconds));
     }
 
     /// Returns the result of adding \p seconds to this time as a new Time object.
-    Time addSeconds(int seconds) const
+    XCLOX_CONSTEXPR14 Time addSeconds(int seconds) const
     {
         return Time(m_duration + Seconds(seconds));
     }
 
     /// Returns the result of subtracting \p seconds from this time as a new Time object.
-    Time subtractSeconds(int seconds) const
+    XCLOX_CONSTEXPR14 Time subtractSeconds(int seconds) const
     {
         return Time(m_duration - Seconds(seconds));
     }
 
     /// Returns the result of adding \p minutes to this time as a new Time object.
-    Time addMinutes(int minutes) const
+    XCLOX_CONSTEXPR14 Time addMinutes(int minutes) const
     {
         return Time(m_duration + Minutes(minutes));
     }
 
     /// Returns the result of subtracting \p minutes from this time as a new Time object.
-    Time subtractMinutes(int minutes) const
+    XCLOX_CONSTEXPR14 Time subtractMinutes(int minutes) const
     {
         return Time(m_duration - Minutes(minutes));
     }
 
     /// Returns the result of adding \p hours to this time as a new Time object.
-    Time addHours(int hours) const
+    XCLOX_CONSTEXPR14 Time addHours(int hours) const
     {
         return Time(m_duration + Hours(hours));
     }
 
     /// Returns the result of subtracting \p hours from this time as a new Time object.
-    Time subtractHours(int hours) const
+    XCLOX_CONSTEXPR14 Time subtractHours(int hours) const
     {
         return Time(m_duration - Hours(hours));
     }
 
     /// Returns the result of adding \p duration to this time as a new Time object.
-    Time addDuration(const Duration& duration) const
+    XCLOX_CONSTEXPR14 Time addDuration(const Duration& duration) const
     {
         return Time(m_duration + duration);
     }
 
     /// Returns the result of subtracting \p duration from this time as a new Time object.
-    Time subtractDuration(const Duration& duration) const
+    XCLOX_CONSTEXPR14 Time subtractDuration(const Duration& duration) const
     {
         return Time(m_duration - duration);
     }
@@ -394,43 +440,43 @@ public:
      */
 
     /// Returns the elapsed nanoseconds since midnight.
-    long long toNanosecondsSinceMidnight() const
+    XCLOX_CONSTEXPR14 long long toNanosecondsSinceMidnight() const
     {
         return std::chrono::duration_cast<Nanoseconds>(m_duration).count();
     }
 
     /// Returns the elapsed microseconds since midnight.
-    long long toMicrosecondsSinceMidnight() const
+    XCLOX_CONSTEXPR14 long long toMicrosecondsSinceMidnight() const
     {
         return std::chrono::duration_cast<Microseconds>(m_duration).count();
     }
 
     /// Returns the elapsed milliseconds since midnight.
-    long toMillisecondsSinceMidnight() const
+    XCLOX_CONSTEXPR14 long toMillisecondsSinceMidnight() const
     {
         return static_cast<long>(std::chrono::duration_cast<Milliseconds>(m_duration).count());
     }
 
     /// Returns the elapsed seconds since midnight.
-    long toSecondsSinceMidnight() const
+    XCLOX_CONSTEXPR14 long toSecondsSinceMidnight() const
     {
         return static_cast<long>(std::chrono::duration_cast<Seconds>(m_duration).count());
     }
 
     /// Returns the elapsed minutes since midnight.
-    int toMinutesSinceMidnight() const
+    XCLOX_CONSTEXPR14 int toMinutesSinceMidnight() const
     {
         return std::chrono::duration_cast<Minutes>(m_duration).count();
     }
 
     /// Returns the elapsed hours since midnight. If this time is invalid, the returned value may exceed 23. @see isValid().
-    int toHoursSinceMidnight() const
+    XCLOX_CONSTEXPR14 int toHoursSinceMidnight() const
     {
         return std::chrono::duration_cast<Hours>(m_duration).count();
     }
 
     /// Returns the elapsed time since midnight as a #Nanoseconds duration.
-    Nanoseconds toStdDurationSinceMidnight() const
+    XCLOX_CONSTEXPR14 Nanoseconds toStdDurationSinceMidnight() const
     {
         return m_duration;
     }
@@ -481,43 +527,51 @@ public:
      * If this time is invalid, an empty string will be returned.
      */
     std::string toString(const std::string& format) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /// Returns the time as a string formatted according to the precompiled format \p format. See toString(const std::string&) for information about the format patterns.
+    std::string toString(const Format& format) const
+    {
+        return internal::charsToString([&](char* first, char* last) { return toChars(first, last, format); });
+    }
+
+    /**
+     * Writes the time formatted according to the format string \p format into the character range [\p first, \p last), and returns the length of the formatted time.
+     * The format patterns are the same patterns used in the method toString(). @see toString()
+     *
+     * This method never allocates memory. If the range is too small, only the characters that fit are written, but the full length is still returned, as std::snprintf() does. For example:
+     *
+     * @code
+     *    char buffer[16];
+     *    size_t length = Time(9, 55, 2).toChars(buffer, buffer + sizeof(buffer), "hh:mm:ss"); // length = 8, buffer = "09:55:02"
+     * @endcode
+     *
+     * If this time is invalid, nothing is written and zero is returned.
+     */
+    size_t toChars(char* first, char* last, const char* format) const
+    {
+        return toChars(first, last, format, std::strlen(format));
+    }
+
+    /// Writes the time formatted according to the format string \p format into the character range [\p first, \p last). @see toChars(char*, char*, const char*)
+    size_t toChars(char* first, char* last, const std::string& format) const
+    {
+        return toChars(first, last, format.data(), format.size());
+    }
+
+    /// Writes the time formatted according to the precompiled format \p format into the character range [\p first, \p last). @see toChars(char*, char*, const char*)
+    size_t toChars(char* first, char* last, const Format& format) const
     {
         if (!isValid())
-            return std::string();
-
-        std::stringstream output;
-
-        for (size_t pos = 0; pos < format.size(); ++pos) {
-            const int patternLength = internal::countIdenticalCharsFrom(pos, format);
-
-            if (format[pos] == 'h') {
-                output << std::setfill('0') << std::setw(patternLength) << hour();
-                pos += patternLength - 1; // skip all identical characters except the last.
-            } else if (format[pos] == 'H') {
-                int hours12f = ((hour() == 0 || hour() == 12) ? 12 : hour() % 12);
-                output << std::setfill('0') << std::setw(patternLength) << hours12f;
-                pos += patternLength - 1;
-            } else if (format[pos] == 'm') {
-                output << std::setfill('0') << std::setw(patternLength) << minute();
-                pos += patternLength - 1;
-            } else if (format[pos] == 's') {
-                output << std::setfill('0') << std::setw(patternLength) << second();
-                pos += patternLength - 1;
-            } else if (format[pos] == 'f') {
-                std::string subseconds = std::to_string(std::chrono::duration_cast<Nanoseconds>(m_duration % Seconds(1)).count());
-                std::string padddedSubsecondsString = subseconds.insert(0, 9 - subseconds.size(), '0');
-                output << padddedSubsecondsString.substr(0, static_cast<size_t>(patternLength));
-                pos += patternLength - 1;
-            } else if (format[pos] == 'A') {
-                output << (hour() >= 12 ? "PM" : "AM");
-            } else if (format[pos] == 'a') {
-                output << (hour() >= 12 ? "pm" : "am");
-            } else {
-                output << format[pos];
-            }
-        }
+            return 0;
 
-        return output.str();
+        internal::CharWriter output(first, last);
+        for (const auto& token : format.tokens()) {
+            write(output, token);
+        }
+        return output.size();
     }
 
     /// @}
@@ -532,7 +586,7 @@ public:
     }
 
     /// Returns a Time object set to midnight (i.e., "00:00:00").
-    static Time midnight()
+    static XCLOX_CONSTEXPR14 Time midnight()
     {
         return Time(Nanoseconds::zero());
     }
@@ -543,38 +597,39 @@ public:
      */
     static Time fromString(const std::string& time, const std::string& format)
     {
-        int _hour = 0, _minute = 0, _second = 0;
-        long _subsecond = 0;
-
-        for (size_t fmtPos = 0, timPos = 0; fmtPos < format.size() && timPos < time.size(); ++fmtPos) {
-            const int patternLength = internal::countIdenticalCharsFrom(fmtPos, format);
-
-            if (format[fmtPos] == 'h' || format[fmtPos] == 'H') {
-                _hour = internal::readIntAndAdvancePos(time, timPos, 2);
-                fmtPos += patternLength - 1; // skip all identical characters except the last.
-            } else if (format[fmtPos] == 'm') {
-                _minute = internal::readIntAndAdvancePos(time, timPos, 2);
-                fmtPos += patternLength - 1;
-            } else if (format[fmtPos] == 's') {
-                _second = internal::readIntAndAdvancePos(time, timPos, 2);
-                fmtPos += patternLength - 1;
-            } else if (format[fmtPos] == 'f') {
-                std::string subsecondString = time.substr(timPos, static_cast<size_t>(patternLength));
-                _subsecond = std::stoi(subsecondString.append(9 - subsecondString.size(), '0'));
-                timPos += patternLength;
-                fmtPos += patternLength - 1;
-            } else if (format[fmtPos] == 'a' || format[fmtPos] == 'A') {
-                if (time.substr(timPos, 2) == "pm" || time.substr(timPos, 2) == "PM") {
-                    _hour = (_hour > 12 ? _hour : _hour + 12);
-                    timPos += 2;
-                }
-            } else {
-                ++timPos;
-            }
+        return fromString(time, Format(format));
+    }
+
+    /// Returns a Time object from the string \p time according to the precompiled format \p format. @see fromString(const std::string&, const std::string&)
+    static Time fromString(const std::string& time, const Format& format)
+    {
+        Time result;
+        fromChars(time.data(), time.data() + time.size(), format, result);
+        return result;
+    }
+
+    /**
+     * Parses the characters in the range [\p first, \p last), formatted according to the precompiled format \p format, into \p time as fromString() does, but without throwing exceptions or allocating memory.
+     * If parsing fails, \p time is set to an invalid Time object, and the returned ParseResult tells why and at which offset into the characters.
+     */
+    static ParseResult fromChars(const char* first, const char* last, const Format& format, Time& time)
+    {
+        internal::DateTimeFields fields;
+        ParseResult result = internal::parseTime(first, static_cast<size_t>(last - first), format, fields);
+        time = result ? Time(Hours(fields.hour) + Minutes(fields.minute) + Seconds(fields.second) + Nanoseconds(fields.nanosecond)) : Time();
+        if (result && !time.isValid()) {
+            result.error = ParseError::InvalidValue;
         }
+        return result;
+    }
 
-        return Time(Hours(_hour) + Minutes(_minute) + Seconds(_second) + Nanoseconds(_subsecond));
+#ifdef XCLOX_HAS_STRING_VIEW
+    /// Parses the string view \p input into \p time. Available since C++17. @see fromChars(const char*, const char*, const Format&, Time&)
+    static ParseResult fromChars(std::string_view input, const Format& format, Time& time)
+    {
+        return fromChars(input.data(), input.data() + input.size(), format, time);
     }
+#endif
 
     /**
      * @name Calculation Methods
@@ -584,37 +639,37 @@ public:
      */
 
     /// Returns the number of nanoseconds between \p from and \p to.
-    static long long nanosecondsBetween(const Time& from, const Time& to)
+    static XCLOX_CONSTEXPR14 long long nanosecondsBetween(const Time& from, const Time& to)
     {
         return to.toNanosecondsSinceMidnight() - from.toNanosecondsSinceMidnight();
     }
 
     /// Returns the number of microseconds between \p from and \p to.
-    static long long microsecondsBetween(const Time& from, const Time& to)
+    static XCLOX_CONSTEXPR14 long long microsecondsBetween(const Time& from, const Time& to)
     {
         return to.toMicrosecondsSinceMidnight() - from.toMicrosecondsSinceMidnight();
     }
 
     /// Returns the number of milliseconds between \p from and \p to.
-    static long millisecondsBetween(const Time& from, const Time& to)
+    static XCLOX_CONSTEXPR14 long millisecondsBetween(const Time& from, const Time& to)
     {
         return to.toMillisecondsSinceMidnight() - from.toMillisecondsSinceMidnight();
     }
 
     /// Returns the number of seconds between \p from and \p to.
-    static long secondsBetween(const Time& from, const Time& to)
+    static XCLOX_CONSTEXPR14 long secondsBetween(const Time& from, const Time& to)
     {
         return to.toSecondsSinceMidnight() - from.toSecondsSinceMidnight();
     }
 
     /// Returns the number of minutes between \p from and \p to.
-    static int minutesBetween(const Time& from, const Time& to)
+    static XCLOX_CONSTEXPR14 int minutesBetween(const Time& from, const Time& to)
     {
         return to.toMinutesSinceMidnight() - from.toMinutesSinceMidnight();
     }
 
     /// Returns the number of hours between \p from and \p to.
-    static int hoursBetween(const Time& from, const Time& to)
+    static XCLOX_CONSTEXPR14 int hoursBetween(const Time& from, const Time& to)
     {
         return to.toHoursSinceMidnight() - from.toHoursSinceMidnight();
     }
@@ -622,6 +677,48 @@ public:
     /// @}
 
 private:
+    size_t toChars(char* first, char* last, const char* format, size_t size) const
+    {
+        if (!isValid())
+            return 0;
+
+        internal::CharWriter output(first, last);
+        for (size_t pos = 0; pos < size;) {
+            const auto& token = Format::tokenAt(format, size, pos);
+            write(output, token);
+            pos += static_cast<size_t>(token.count);
+        }
+        return output.size();
+    }
+
+    void write(internal::CharWriter& output, const Format::Token& token) const
+    {
+        if (token.flag == 'h') {
+            output.writeInt(static_cast<unsigned>(hour()), token.count);
+        } else if (token.flag == 'H') {
+            const int hours12f = ((hour() == 0 || hour() == 12) ? 12 : hour() % 12);
+            output.writeInt(static_cast<unsigned>(hours12f), token.count);
+        } else if (token.flag == 'm') {
+            output.writeInt(static_cast<unsigned>(minute()), token.count);
+        } else if (token.flag == 's') {
+            output.writeInt(static_cast<unsigned>(second()), token.count);
+        } else if (token.flag == 'f') {
+            const int digits = std::min(token.count, 9);
+            output.writeInt(static_cast<unsigned long long>(nanosecond() / internal::getPowerOfTen(9 - digits)), digits);
+        } else {
+            // the indicators and unrecognized characters are written once per character.
+            for (int i = 0; i < token.count; ++i) {
+                if (token.flag == 'A') {
+                    output.write(hour() >= 12 ? "PM" : "AM", 2);
+                } else if (token.flag == 'a') {
+                    output.write(hour() >= 12 ? "pm" : "am", 2);
+                } else {
+                    output.write(token.flag);
+                }
+            }
+        }
+    }
+
     Duration m_duration;
 };
 
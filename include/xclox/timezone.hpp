@@ -0,0 +1,820 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#ifndef XCLOX_TIMEZONE_HPP
+#define XCLOX_TIMEZONE_HPP
+
+#include "datetime.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#else
+#include <fstream>
+#include <iterator>
+#endif
+
+namespace xclox {
+
+namespace internal {
+
+    // The read-only contents of a file, which are memory-mapped where the platform supports it, or read into memory otherwise. It is empty if the file cannot be read.
+    class MappedFile {
+    public:
+        explicit MappedFile(const std::string& path)
+            : m_data(nullptr)
+            , m_size(0)
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (descriptor < 0)
+                return;
+            struct stat status;
+            if (::fstat(descriptor, &status) == 0 && status.st_size > 0) {
+                void* address = ::mmap(nullptr, static_cast<size_t>(status.st_size), PROT_READ, MAP_PRIVATE, descriptor, 0);
+                if (address != MAP_FAILED) {
+                    m_data = static_cast<const char*>(address);
+                    m_size = static_cast<size_t>(status.st_size);
+                }
+            }
+            ::close(descriptor);
+#else
+            std::ifstream file(path, std::ios::binary);
+            m_buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+            m_data = m_buffer.data();
+            m_size = m_buffer.size();
+#endif
+        }
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+
+        ~MappedFile()
+        {
+#if defined(__unix__) || defined(__APPLE__)
+            if (m_data)
+                ::munmap(const_cast<char*>(m_data), m_size);
+#endif
+        }
+
+        const char* data() const
+        {
+            return m_data;
+        }
+
+        size_t size() const
+        {
+            return m_size;
+        }
+
+    private:
+        const char* m_data;
+        size_t m_size;
+#if !defined(__unix__) && !defined(__APPLE__)
+        std::string m_buffer;
+#endif
+    };
+
+    // Returns the size bytes at data as a signed big-endian integer.
+    inline std::int64_t readBigEndian(const char* data, int size)
+    {
+        std::uint64_t value = 0;
+        for (int i = 0; i < size; ++i)
+            value = value << 8 | static_cast<unsigned char>(data[i]);
+        if (size < 8 && value >> (size * 8 - 1))
+            return static_cast<std::int64_t>(value) - (std::int64_t(1) << (size * 8));
+        return static_cast<std::int64_t>(value);
+    }
+
+    // A time zone of POSIX, such as "CET-1CEST,M3.5.0,M10.5.0/3", which TZif files end with to describe the times after their last transition.
+    struct PosixTimeZone {
+        // A rule for the day and local time of a transition: "Jn" (kind 'J') for the day n from 1 to 365 not counting February 29, "n" (kind 'D') for the day n from 0 to 365, or "Mm.w.d" (kind 'M') for the weekday d, from Sunday as 0, of the week w, from 1 to 5 as the last, of the month m.
+        struct Rule {
+            char kind;
+            int month;
+            int week;
+            int weekday;
+            int day;
+            std::int32_t time;
+        };
+
+        std::string standardAbbreviation;
+        std::string daylightAbbreviation;
+        std::int32_t standardOffset;
+        std::int32_t daylightOffset;
+        bool hasDaylight;
+        Rule start;
+        Rule end;
+
+        // Parses value, and returns whether it is a valid time zone.
+        bool parse(const std::string& value)
+        {
+            const char* it = value.c_str();
+            hasDaylight = false;
+            if (!readAbbreviation(it, standardAbbreviation) || !readTime(it, &standardOffset))
+                return false;
+            standardOffset = -standardOffset; // POSIX offsets are positive west of Greenwich.
+            if (!*it)
+                return true;
+            if (!readAbbreviation(it, daylightAbbreviation))
+                return false;
+            daylightOffset = standardOffset + 3600;
+            if (*it && *it != ',') {
+                if (!readTime(it, &daylightOffset))
+                    return false;
+                daylightOffset = -daylightOffset;
+            }
+            hasDaylight = true;
+            if (!*it) {
+                start = Rule { 'M', 3, 2, 0, 0, 7200 }; // the rules of the United States, as POSIX leaves them unspecified.
+                end = Rule { 'M', 11, 1, 0, 0, 7200 };
+                return true;
+            }
+            return *it++ == ',' && readRule(it, start) && *it++ == ',' && readRule(it, end) && !*it;
+        }
+
+        // Returns the seconds since the epoch of the transitions to and from daylight saving time of the local year.
+        void transitions(int year, std::int64_t* toDaylight, std::int64_t* fromDaylight) const
+        {
+            *toDaylight = transitionDay(start, year) * 86400 + start.time - standardOffset;
+            *fromDaylight = transitionDay(end, year) * 86400 + end.time - daylightOffset;
+        }
+
+        // Returns whether seconds since the epoch are in daylight saving time.
+        bool isDaylightTime(std::int64_t seconds) const
+        {
+            if (!hasDaylight)
+                return false;
+            int year = 0, month = 0, day = 0;
+            daysToYmd(Days(static_cast<long>(floorDivide(seconds + standardOffset, 86400))), &year, &month, &day);
+            std::int64_t toDaylight = 0, fromDaylight = 0;
+            transitions(year, &toDaylight, &fromDaylight);
+            if (toDaylight < fromDaylight)
+                return seconds >= toDaylight && seconds < fromDaylight;
+            return seconds < fromDaylight || seconds >= toDaylight;
+        }
+
+        static std::int64_t transitionDay(const Rule& rule, int year)
+        {
+            const std::int64_t first = ymdToDays(year, 1, 1).count();
+            if (rule.kind == 'J')
+                return first + rule.day - 1 + (rule.day >= 60 && Date::isLeapYear(year) ? 1 : 0);
+            if (rule.kind == 'D')
+                return first + rule.day;
+            const std::int64_t monthFirst = ymdToDays(year, rule.month, 1).count();
+            std::int64_t day = monthFirst + (rule.weekday - dayOfWeek(Days(static_cast<long>(monthFirst))) % 7 + 7) % 7 + (rule.week - 1) * 7;
+            while (day >= monthFirst + Date::daysInMonthOfYear(year, rule.month))
+                day -= 7;
+            return day;
+        }
+
+        static bool readAbbreviation(const char*& it, std::string& abbreviation)
+        {
+            const char* first = it;
+            if (*it == '<') {
+                while (*it && *it != '>')
+                    ++it;
+                if (*it != '>')
+                    return false;
+                abbreviation.assign(first + 1, it++);
+            } else {
+                while ((*it >= 'A' && *it <= 'Z') || (*it >= 'a' && *it <= 'z'))
+                    ++it;
+                abbreviation.assign(first, it);
+            }
+            return abbreviation.size() >= 3;
+        }
+
+        // Reads "[+|-]h[h][:mm[:ss]]", whose hours may reach 167 for the times of rules.
+        static bool readTime(const char*& it, std::int32_t* seconds)
+        {
+            const int sign = *it == '-' ? -1 : 1;
+            if (*it == '-' || *it == '+')
+                ++it;
+            std::int32_t value = 0;
+            for (int part = 0, limit = 167; part < 3; ++part, limit = 59) {
+                if (part > 0 && *it != ':')
+                    break;
+                if (part > 0)
+                    ++it;
+                if (*it < '0' || *it > '9')
+                    return false;
+                std::int32_t number = 0;
+                for (int digits = 0; *it >= '0' && *it <= '9' && digits < 3; ++digits)
+                    number = number * 10 + (*it++ - '0');
+                if (number > limit)
+                    return false;
+                value += number * (part == 0 ? 3600 : part == 1 ? 60 : 1);
+            }
+            *seconds = sign * value;
+            return true;
+        }
+
+        static bool readNumber(const char*& it, int min, int max, int* number)
+        {
+            if (*it < '0' || *it > '9')
+                return false;
+            *number = 0;
+            for (int digits = 0; *it >= '0' && *it <= '9' && digits < 3; ++digits)
+                *number = *number * 10 + (*it++ - '0');
+            return *number >= min && *number <= max;
+        }
+
+        static bool readRule(const char*& it, Rule& rule)
+        {
+            rule = Rule { 'D', 0, 0, 0, 0, 7200 };
+            bool valid = false;
+            if (*it == 'J') {
+                rule.kind = *it++;
+                valid = readNumber(it, 1, 365, &rule.day);
+            } else if (*it == 'M') {
+                rule.kind = *it++;
+                valid = readNumber(it, 1, 12, &rule.month) && *it++ == '.' && readNumber(it, 1, 5, &rule.week) && *it++ == '.' && readNumber(it, 0, 6, &rule.weekday);
+            } else {
+                valid = readNumber(it, 0, 365, &rule.day);
+            }
+            if (valid && *it == '/') {
+                ++it;
+                return readTime(it, &rule.time);
+            }
+            return valid;
+        }
+    };
+
+    // A type of local time of a time zone.
+    struct LocalTimeType {
+        std::int32_t offset;
+        bool daylight;
+        std::string abbreviation;
+    };
+
+    // The contents of a TZif file (RFC 8536): the types of local time, of which the first is before the first transition, the times of the transitions and the types after them, and the footer.
+    struct TzifFile {
+        std::vector<LocalTimeType> types;
+        std::vector<std::int64_t> times;
+        std::vector<std::uint16_t> typeIndices;
+        std::string footer;
+
+        // Reads the size bytes at data, and returns whether they are a valid TZif file without leap seconds.
+        bool parse(const char* data, size_t size)
+        {
+            const size_t headerSize = 44;
+            if (!data || size < headerSize || std::memcmp(data, "TZif", 4) != 0)
+                return false;
+            const char* block = data + headerSize;
+            const char* const last = data + size;
+            std::uint64_t counts[6] = {}; // isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt
+            size_t timeSize = 4;
+            for (int i = 0; i < 6; ++i)
+                counts[i] = static_cast<std::uint32_t>(readBigEndian(data + 20 + i * 4, 4));
+            if (data[4] >= '2') {
+                // Version 2 and later files repeat the header and data with 64-bit times after the data of version 1.
+                const std::uint64_t skipped = counts[3] * 5 + counts[4] * 6 + counts[5] + counts[2] * 8 + counts[1] + counts[0];
+                if (skipped + headerSize > static_cast<std::uint64_t>(last - block) || std::memcmp(block + skipped, "TZif", 4) != 0)
+                    return false;
+                const char* header = block + skipped;
+                for (int i = 0; i < 6; ++i)
+                    counts[i] = static_cast<std::uint32_t>(readBigEndian(header + 20 + i * 4, 4));
+                block = header + headerSize;
+                timeSize = 8;
+            }
+            const std::uint64_t blockSize = counts[3] * (timeSize + 1) + counts[4] * 6 + counts[5] + counts[2] * (timeSize + 4) + counts[1] + counts[0];
+            if (counts[2] != 0 || counts[4] == 0 || counts[4] > 256 || counts[5] == 0 || blockSize > static_cast<std::uint64_t>(last - block))
+                return false;
+            const size_t transitionCount = static_cast<size_t>(counts[3]);
+            const size_t typeCount = static_cast<size_t>(counts[4]);
+            const size_t characterCount = static_cast<size_t>(counts[5]);
+            const char* const indices = block + transitionCount * timeSize;
+            const char* const records = indices + transitionCount;
+            const char* const characters = records + typeCount * 6;
+            types.clear();
+            times.clear();
+            typeIndices.clear();
+            footer.clear();
+            for (size_t i = 0; i < typeCount; ++i) {
+                const char* record = records + i * 6;
+                const size_t index = static_cast<unsigned char>(record[5]);
+                if (index >= characterCount)
+                    return false;
+                const char* abbreviation = characters + index;
+                types.push_back(LocalTimeType { static_cast<std::int32_t>(readBigEndian(record, 4)), record[4] != 0, std::string(abbreviation, std::find(abbreviation, characters + characterCount, '\0')) });
+            }
+            for (size_t i = 0; i < transitionCount; ++i) {
+                times.push_back(readBigEndian(block + i * timeSize, static_cast<int>(timeSize)));
+                typeIndices.push_back(static_cast<unsigned char>(indices[i]));
+            }
+            const char* first = block + blockSize;
+            if (timeSize == 8 && first < last && *first == '\n') {
+                const char* end = static_cast<const char*>(std::memchr(first + 1, '\n', static_cast<size_t>(last - first - 1)));
+                if (end)
+                    footer.assign(first + 1, end);
+            }
+            return true;
+        }
+    };
+
+    // Returns a hash of the string name, which differs by seed, for the perfect hash tables of TimeZoneDatabase.
+    inline std::uint32_t hashName(const char* name, std::uint32_t seed)
+    {
+        std::uint32_t hash = 2166136261u ^ seed;
+        for (; *name; ++name)
+            hash = (hash ^ static_cast<unsigned char>(*name)) * 16777619u;
+        hash ^= hash >> 16;
+        hash *= 0x85EBCA6Bu;
+        hash ^= hash >> 13;
+        hash *= 0xC2B2AE35u;
+        return hash ^ (hash >> 16);
+    }
+
+} // namespace internal
+
+/**
+ * @struct TimeZoneDatabase
+ *
+ * TimeZoneDatabase is the layout of the time zones that are compiled into a program as constant data, such as those of the header "xclox/tzdb.hpp", which is generated by the target "tzdb" of the build from the TZif files of selected time zones.
+ * It needs neither files nor memory allocations until a time zone is created from it by TimeZone::fromDatabase(), and its names are found by a minimal perfect hash, i.e., one hash of a name to a bucket, and a second hash, seeded by the displacement of the bucket, to the only zone that may have the name.
+ *
+ * The types of local time, their abbreviations, the footers, and the names are stored once for all zones, and the transitions of a zone are stored once for all zones with the same transitions, e.g. the links of the database such as "Asia/Calcutta" and "Asia/Kolkata".
+ * The transitions that follow the rule of the footer of a zone are left out, as TimeZone derives them from the footer.
+ */
+struct TimeZoneDatabase {
+    /// A type of local time.
+    struct Type {
+        std::int32_t offset; ///< The offset of the local time from UTC in seconds.
+        bool daylight; ///< Whether the local time is daylight saving time.
+        std::uint32_t abbreviation; ///< The position of the abbreviation in #characters.
+    };
+
+    /// A time zone.
+    struct Zone {
+        std::uint32_t name; ///< The position of the name in #characters.
+        std::uint32_t footer; ///< The position of the footer in #characters, which is empty if there is none.
+        std::uint32_t firstTransition; ///< The position of the first transition in #times and #transitionTypes.
+        std::uint32_t transitionCount; ///< The number of transitions.
+        std::uint16_t initialType; ///< The index of the type before the first transition in #types.
+    };
+
+    const char* version; ///< The version of the time zone database, e.g. "2024a".
+    const char* characters; ///< The null-terminated names, abbreviations, and footers.
+    const Type* types; ///< The types of local time.
+    const std::int64_t* times; ///< The times of the transitions in seconds since the epoch.
+    const std::uint16_t* transitionTypes; ///< The indices in #types of the types after the transitions.
+    const Zone* zones; ///< The time zones, in the order of the perfect hash of their names.
+    std::uint32_t zoneCount; ///< The number of time zones.
+    const std::uint16_t* displacements; ///< The seeds of the second hashes of the buckets.
+    std::uint32_t bucketCount; ///< The number of buckets.
+
+    /// Returns the time zone named \p name, or a null pointer if there is none.
+    const Zone* find(const char* name) const
+    {
+        if (zoneCount == 0 || bucketCount == 0)
+            return nullptr;
+        const Zone& zone = zones[internal::hashName(name, displacements[internal::hashName(name, 0) % bucketCount]) % zoneCount];
+        return std::strcmp(characters + zone.name, name) == 0 ? &zone : nullptr;
+    }
+};
+
+/**
+ * @class TimeZone
+ *
+ * TimeZone is a class for the time zones of the IANA time zone database, such as "Europe/Berlin", and for converting datetimes between UTC and their local time.
+ *
+ * A time zone is loaded from a TZif file (RFC 8536) of the database, as found in "/usr/share/zoneinfo" on most Unix-like systems, by fromName() or fromFile(), which map the file into memory and read it once, or from the bytes of such a file by fromTzif().
+ * Its transitions are kept in sorted arrays: the times of the transitions, their local times, and the offsets from UTC in between, so that a conversion is a binary search of one array, whose result is also kept as a hint for the next conversion; as consecutive conversions mostly fall between the same transitions, most conversions check the hint, and need no search.
+ * The hints are shared by the threads that use the time zone without locking, unlike the standard `localtime_r()`, which locks a global mutex of the time zone in some C libraries.
+ * The transitions after the last transition of the file follow the rule of its footer, e.g. "CET-1CEST,M3.5.0,M10.5.0/3", which are added to the arrays up to the year 2100, and computed for every conversion after it.
+ *
+ * Converting a local datetime to UTC has two special cases: a local datetime that occurs twice, as the clocks are set back, is converted to the earlier of the two; and a local datetime that does not occur, as the clocks are set forward, is converted as if the clocks had not been set forward yet, so that it becomes later by the length of the gap, e.g. 02:30 becomes 03:30 in Central Europe on the last Sunday of March.
+ * The leap seconds of the "right/" time zones are not supported, so loading them results in invalid time zones.
+ *
+ * Time zones can also be created from the constant data of a TimeZoneDatabase by fromDatabase(), without reading any files, e.g. in containers without "/usr/share/zoneinfo".
+ *
+ * @code
+ *    const TimeZone berlin = TimeZone::fromName("Europe/Berlin");
+ *    berlin.toLocal(DateTime(Date(2024, 7, 1), Time(12, 0, 0))); // 2024-07-01 14:00:00
+ *    berlin.toUtc(DateTime(Date(2024, 1, 1), Time(12, 0, 0))); // 2024-01-01 11:00:00
+ *    berlin.abbreviation(DateTime(Date(2024, 7, 1), Time(12, 0, 0))); // "CEST"
+ * @endcode
+ *
+ * @see The unit tests in @ref timezone.h for further details.
+ */
+class TimeZone {
+public:
+    using Seconds = DateTime::Seconds; ///< Second duration.
+
+    /**
+     * @name Constructors and Destructors
+     * @{
+     */
+
+    /// Constructs an invalid TimeZone object. @see isValid()
+    TimeZone()
+        : m_ruleFrom(std::numeric_limits<std::int64_t>::max())
+        , m_rule()
+        , m_ruleStandardType(0)
+        , m_ruleDaylightType(0)
+    {
+    }
+
+    /// Copy-constructs a TimeZone object from \p other.
+    TimeZone(const TimeZone& other) = default;
+
+    /// Move-constructs a TimeZone object from \p other.
+    TimeZone(TimeZone&& other) = default;
+
+    /// Default destructor.
+    ~TimeZone() = default;
+
+    /// @}
+
+    /**
+     * @name Assignment Operators
+     * @{
+     */
+
+    /// Copy assignment operator.
+    TimeZone& operator=(const TimeZone& other) = default;
+
+    /// Move assignment operator.
+    TimeZone& operator=(TimeZone&& other) = default;
+
+    /// @}
+
+    /**
+     * @name Querying Methods
+     * @{
+     */
+
+    /// Returns whether this time zone has been loaded.
+    bool isValid() const
+    {
+        return m_times.size() > 1;
+    }
+
+    /// Returns the name of this time zone, e.g. "Europe/Berlin".
+    const std::string& name() const
+    {
+        return m_name;
+    }
+
+    /// Returns the offset of the local time from UTC at the UTC datetime \p utc, or 0 if either is invalid.
+    Seconds offset(const DateTime& utc) const
+    {
+        return Seconds(isValid() && utc.isValid() ? offsetAt(secondsOf(utc)) : 0);
+    }
+
+    /// Returns whether the local time is daylight saving time at the UTC datetime \p utc.
+    bool isDaylightTime(const DateTime& utc) const
+    {
+        return isValid() && utc.isValid() && m_types[typeAt(secondsOf(utc))].daylight;
+    }
+
+    /// Returns the abbreviation of the local time at the UTC datetime \p utc, e.g. "CET" or "CEST", or an empty string if either is invalid.
+    std::string abbreviation(const DateTime& utc) const
+    {
+        return isValid() && utc.isValid() ? m_types[typeAt(secondsOf(utc))].abbreviation : std::string();
+    }
+
+    /// @}
+
+    /**
+     * @name Conversion Methods
+     * @{
+     */
+
+    /// Returns the local datetime of the UTC datetime \p utc, or an invalid datetime if either is invalid.
+    DateTime toLocal(const DateTime& utc) const
+    {
+        if (!isValid() || !utc.isValid())
+            return DateTime();
+        return utc.addSeconds(offsetAt(secondsOf(utc)));
+    }
+
+    /// Returns the UTC datetime of the local datetime \p local, or an invalid datetime if either is invalid. See the description of the class for local datetimes that occur twice or do not occur.
+    DateTime toUtc(const DateTime& local) const
+    {
+        if (!isValid() || !local.isValid())
+            return DateTime();
+        return local.subtractSeconds(localOffsetAt(secondsOf(local)));
+    }
+
+    /**
+     * Converts the \p count UTC nanoseconds since the epoch at \p utc to the local nanoseconds since the epoch at \p local, which may be the same array as \p utc, e.g. a timestamp column of Apache Arrow or of DateTimeColumn.
+     * The values are converted a block at a time: the transitions of a sorted block are found by a cursor that moves forward from one value to the next, and those of an unsorted block by searching only the transitions between its least and greatest values, so that a block between two transitions needs no search at all.
+     * The local values of an invalid time zone are the UTC values.
+     */
+    void toLocal(const std::int64_t* utc, size_t count, std::int64_t* local) const
+    {
+        if (!isValid()) {
+            std::copy(utc, utc + count, local);
+            return;
+        }
+        forEachOffset(utc, count, [&](size_t i, std::int32_t offset) { local[i] = utc[i] + offset * NanosecondsPerSecond; });
+    }
+
+    /// Converts the \p count UTC nanoseconds since the epoch at \p utc to the local datetimes at \p local, in the same way as the conversion to local nanoseconds, or to invalid datetimes if this time zone is invalid.
+    void toLocal(const std::int64_t* utc, size_t count, DateTime* local) const
+    {
+        if (!isValid()) {
+            std::fill(local, local + count, DateTime());
+            return;
+        }
+        forEachOffset(utc, count, [&](size_t i, std::int32_t offset) { local[i] = DateTime(DateTime::Nanoseconds(utc[i] + offset * NanosecondsPerSecond)); });
+    }
+
+    /// @}
+
+    /**
+     * @name Creation Methods
+     * @{
+     */
+
+    /// Returns the time zone of UTC, which has no transitions.
+    static TimeZone utc()
+    {
+        internal::TzifFile file;
+        file.types.push_back(internal::LocalTimeType { 0, false, "UTC" });
+        return build("UTC", file);
+    }
+
+    /// Returns the time zone named \p name, e.g. "Europe/Berlin", from the TZif file of the same name in \p directory, or an invalid time zone if there is no such file or it is malformed.
+    static TimeZone fromName(const std::string& name, const std::string& directory = "/usr/share/zoneinfo")
+    {
+        if (name.empty() || name[0] == '/' || name.find("..") != std::string::npos)
+            return TimeZone();
+        return fromFile(directory + '/' + name, name);
+    }
+
+    /// Returns the time zone of the TZif file at \p path, named \p name, or an invalid time zone if there is no such file or it is malformed.
+    static TimeZone fromFile(const std::string& path, const std::string& name = std::string())
+    {
+        const internal::MappedFile file(path);
+        return fromTzif(file.data(), file.size(), name);
+    }
+
+    /**
+     * Returns the time zone named \p name of \p database, or an invalid time zone if there is none. For example:
+     *
+     * @code
+     *    #include <xclox/tzdb.hpp>
+     *    const TimeZone berlin = TimeZone::fromDatabase("Europe/Berlin", tzdb::database());
+     * @endcode
+     */
+    static TimeZone fromDatabase(const std::string& name, const TimeZoneDatabase& database)
+    {
+        const TimeZoneDatabase::Zone* zone = database.find(name.c_str());
+        if (!zone)
+            return TimeZone();
+        // The types of the zone are copied in the order of their first use, starting with its initial type.
+        internal::TzifFile file;
+        std::vector<std::uint16_t> used;
+        const auto localIndex = [&](std::uint16_t type) {
+            const size_t index = static_cast<size_t>(std::find(used.begin(), used.end(), type) - used.begin());
+            if (index == used.size()) {
+                used.push_back(type);
+                file.types.push_back(internal::LocalTimeType { database.types[type].offset, database.types[type].daylight, database.characters + database.types[type].abbreviation });
+            }
+            return static_cast<std::uint16_t>(index);
+        };
+        localIndex(zone->initialType);
+        for (std::uint32_t i = zone->firstTransition; i < zone->firstTransition + zone->transitionCount; ++i) {
+            file.times.push_back(database.times[i]);
+            file.typeIndices.push_back(localIndex(database.transitionTypes[i]));
+        }
+        file.footer = database.characters + zone->footer;
+        return build(name, file);
+    }
+
+    /// Returns the time zone of the \p size bytes of TZif data at \p data, named \p name, or an invalid time zone if they are malformed.
+    static TimeZone fromTzif(const char* data, size_t size, const std::string& name = std::string())
+    {
+        internal::TzifFile file;
+        return file.parse(data, size) ? build(name, file) : TimeZone();
+    }
+
+    /// @}
+
+private:
+    static constexpr int LastTabulatedYear = 2100; // the last year whose transitions by the rule of the footer are added to the arrays.
+    static constexpr size_t BlockSize = 256; // the number of values that are converted at a time by the batch conversions.
+    static constexpr std::int64_t NanosecondsPerSecond = 1000000000;
+
+    // Returns the time zone named name of the contents of a TZif file, or an invalid time zone if they are inconsistent.
+    static TimeZone build(const std::string& name, const internal::TzifFile& file)
+    {
+        if (file.types.empty() || file.types.size() > 256 || file.times.size() != file.typeIndices.size())
+            return TimeZone();
+        TimeZone zone;
+        zone.m_name = name;
+        zone.m_types = file.types;
+        zone.initialize(0);
+        for (size_t i = 0; i < file.times.size(); ++i) {
+            if (file.typeIndices[i] >= file.types.size() || file.times[i] <= zone.m_times.back())
+                return TimeZone();
+            zone.add(file.times[i], file.typeIndices[i]);
+        }
+        if (!file.footer.empty() && !zone.follow(file.footer))
+            return TimeZone();
+        zone.finalize();
+        return zone;
+    }
+
+    static std::int64_t secondsOf(const DateTime& datetime)
+    {
+        return static_cast<std::int64_t>(datetime.toDaysSinceEpoch()) * 86400 + datetime.time().toSecondsSinceMidnight();
+    }
+
+    // Starts the arrays with the local time type before the first transition.
+    void initialize(size_t type)
+    {
+        m_times.assign(1, std::numeric_limits<std::int64_t>::min());
+        m_intervalTypes.assign(1, static_cast<std::uint16_t>(type));
+    }
+
+    void add(std::int64_t time, size_t type)
+    {
+        m_times.push_back(time);
+        m_intervalTypes.push_back(static_cast<std::uint16_t>(type));
+    }
+
+    // Returns the index of the type, which is added if there is none.
+    size_t findType(std::int32_t offset, bool daylight, const std::string& abbreviation)
+    {
+        for (size_t i = 0; i < m_types.size(); ++i) {
+            if (m_types[i].offset == offset && m_types[i].daylight == daylight && m_types[i].abbreviation == abbreviation)
+                return i;
+        }
+        m_types.push_back(internal::LocalTimeType { offset, daylight, abbreviation });
+        return m_types.size() - 1;
+    }
+
+    // Adds the transitions by the footer after the last transition up to the last tabulated year, and returns whether the footer is valid.
+    bool follow(const std::string& footer)
+    {
+        if (!m_rule.parse(footer))
+            return false;
+        if (!m_rule.hasDaylight)
+            return true;
+        m_ruleStandardType = findType(m_rule.standardOffset, false, m_rule.standardAbbreviation);
+        m_ruleDaylightType = findType(m_rule.daylightOffset, true, m_rule.daylightAbbreviation);
+        int year = 1970, month = 0, day = 0;
+        if (m_times.size() > 1)
+            internal::daysToYmd(internal::Days(static_cast<long>(internal::floorDivide(m_times.back(), 86400))), &year, &month, &day);
+        for (; year <= LastTabulatedYear; ++year) {
+            std::int64_t toDaylight = 0, fromDaylight = 0;
+            m_rule.transitions(year, &toDaylight, &fromDaylight);
+            const bool daylightFirst = toDaylight < fromDaylight;
+            if ((daylightFirst ? toDaylight : fromDaylight) > m_times.back())
+                add(std::min(toDaylight, fromDaylight), daylightFirst ? m_ruleDaylightType : m_ruleStandardType);
+            if ((daylightFirst ? fromDaylight : toDaylight) > m_times.back())
+                add(std::max(toDaylight, fromDaylight), daylightFirst ? m_ruleStandardType : m_ruleDaylightType);
+        }
+        m_ruleFrom = m_times.back();
+        return true;
+    }
+
+    // Ends the arrays, and derives the offsets and local times of the intervals.
+    void finalize()
+    {
+        m_times.push_back(std::numeric_limits<std::int64_t>::max());
+        m_offsets.clear();
+        m_localTimes.assign(1, std::numeric_limits<std::int64_t>::min());
+        for (size_t i = 0; i < m_intervalTypes.size(); ++i) {
+            m_offsets.push_back(m_types[m_intervalTypes[i]].offset);
+            if (i > 0)
+                m_localTimes.push_back(std::max(m_localTimes.back(), m_times[i] + m_offsets[i]));
+        }
+        m_localTimes.push_back(std::numeric_limits<std::int64_t>::max());
+    }
+
+    // Returns the interval of the UTC seconds, i.e., the number of transitions at or before them.
+    size_t intervalAt(std::int64_t seconds) const
+    {
+        size_t i = m_utcHint.load();
+        if (seconds < m_times[i] || seconds >= m_times[i + 1]) {
+            i = static_cast<size_t>(std::upper_bound(m_times.begin() + 1, m_times.end() - 1, seconds) - m_times.begin()) - 1;
+            m_utcHint.store(i);
+        }
+        return i;
+    }
+
+    // Returns the interval of the UTC seconds among the intervals first through last.
+    size_t intervalBetween(size_t first, size_t last, std::int64_t seconds) const
+    {
+        return static_cast<size_t>(std::upper_bound(m_times.begin() + static_cast<std::ptrdiff_t>(first) + 1, m_times.begin() + static_cast<std::ptrdiff_t>(last) + 1, seconds) - m_times.begin()) - 1;
+    }
+
+    std::int32_t offsetIn(size_t interval, std::int64_t seconds) const
+    {
+        if (seconds >= m_ruleFrom)
+            return m_rule.isDaylightTime(seconds) ? m_rule.daylightOffset : m_rule.standardOffset;
+        return m_offsets[interval];
+    }
+
+    // Calls write(i, offset) with the offset of every one of the count UTC nanoseconds.
+    template <typename Function>
+    void forEachOffset(const std::int64_t* utc, size_t count, const Function& write) const
+    {
+        const size_t lastInterval = m_times.size() - 2;
+        std::int64_t seconds[BlockSize];
+        size_t interval = 0;
+        for (size_t first = 0; first < count; first += BlockSize) {
+            const size_t size = count - first < BlockSize ? count - first : BlockSize;
+            bool sorted = true;
+            std::int64_t least = std::numeric_limits<std::int64_t>::max(), greatest = std::numeric_limits<std::int64_t>::min();
+            for (size_t i = 0; i < size; ++i) {
+                seconds[i] = internal::floorDivide(utc[first + i], NanosecondsPerSecond);
+                sorted &= i == 0 || seconds[i] >= seconds[i - 1];
+                least = std::min(least, seconds[i]);
+                greatest = std::max(greatest, seconds[i]);
+            }
+            if (sorted) {
+                // The cursor moves to the next interval, and only searches if the values skip over more than one transition.
+                if (seconds[0] < m_times[interval])
+                    interval = intervalBetween(0, lastInterval, seconds[0]);
+                for (size_t i = 0; i < size; ++i) {
+                    if (seconds[i] >= m_times[interval + 1])
+                        interval = seconds[i] < m_times[interval + 2] ? interval + 1 : intervalBetween(interval + 2, lastInterval, seconds[i]);
+                    write(first + i, offsetIn(interval, seconds[i]));
+                }
+                continue;
+            }
+            const size_t leastInterval = intervalBetween(0, lastInterval, least);
+            const size_t greatestInterval = intervalBetween(leastInterval, lastInterval, greatest);
+            if (leastInterval == greatestInterval && greatest < m_ruleFrom) {
+                const std::int32_t offset = m_offsets[leastInterval];
+                for (size_t i = 0; i < size; ++i)
+                    write(first + i, offset);
+            } else {
+                for (size_t i = 0; i < size; ++i)
+                    write(first + i, offsetIn(intervalBetween(leastInterval, greatestInterval, seconds[i]), seconds[i]));
+            }
+        }
+    }
+
+    std::int32_t offsetAt(std::int64_t seconds) const
+    {
+        if (seconds >= m_ruleFrom)
+            return m_rule.isDaylightTime(seconds) ? m_rule.daylightOffset : m_rule.standardOffset;
+        return m_offsets[intervalAt(seconds)];
+    }
+
+    size_t typeAt(std::int64_t seconds) const
+    {
+        if (seconds >= m_ruleFrom)
+            return m_rule.isDaylightTime(seconds) ? m_ruleDaylightType : m_ruleStandardType;
+        return m_intervalTypes[intervalAt(seconds)];
+    }
+
+    // Returns the offset by which the local seconds are converted to UTC.
+    std::int32_t localOffsetAt(std::int64_t seconds) const
+    {
+        size_t i = m_localHint.load();
+        if (seconds < m_localTimes[i] || seconds >= m_localTimes[i + 1]) {
+            i = static_cast<size_t>(std::upper_bound(m_localTimes.begin() + 1, m_localTimes.end() - 1, seconds) - m_localTimes.begin()) - 1;
+            m_localHint.store(i);
+        }
+        // The local time of the previous interval overlaps the interval if the clocks were set back, and the earlier time is taken; a local time skipped by setting the clocks forward keeps the previous offset.
+        const std::int32_t offset = i > 0 && seconds < m_times[i] + m_offsets[i - 1] ? m_offsets[i - 1] : m_offsets[i];
+        if (seconds - offset < m_ruleFrom)
+            return offset;
+        const std::int64_t standard = seconds - m_rule.standardOffset;
+        const std::int64_t daylight = seconds - m_rule.daylightOffset;
+        const bool isStandard = !m_rule.isDaylightTime(standard);
+        const bool isDaylight = m_rule.isDaylightTime(daylight);
+        if (isStandard != isDaylight)
+            return isStandard ? m_rule.standardOffset : m_rule.daylightOffset;
+        return static_cast<std::int32_t>(seconds - (isStandard ? std::min(standard, daylight) : std::max(standard, daylight)));
+    }
+
+    std::string m_name;
+    std::vector<internal::LocalTimeType> m_types;
+    std::vector<std::int64_t> m_times; // the UTC seconds of the transitions, between the least and the greatest seconds.
+    std::vector<std::int64_t> m_localTimes; // the local seconds at which the intervals start, in the offsets of the intervals.
+    std::vector<std::int32_t> m_offsets; // the offsets of the intervals, which precede and follow the transitions.
+    std::vector<std::uint16_t> m_intervalTypes;
+    mutable internal::SharedHint m_utcHint;
+    mutable internal::SharedHint m_localHint;
+    std::int64_t m_ruleFrom; // the UTC seconds from which the rule of the footer is computed.
+    internal::PosixTimeZone m_rule;
+    size_t m_ruleStandardType;
+    size_t m_ruleDaylightType;
+};
+
+} // namespace xclox
+
+#endif // XCLOX_TIMEZONE_HPP
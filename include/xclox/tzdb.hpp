@@ -0,0 +1,1351 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+// This file is generated by tools/tzdb_generator.cpp from the time zone database 2025b; regenerate it by building the target "tzdb" instead of editing it.
+
+#ifndef XCLOX_TZDB_HPP
+#define XCLOX_TZDB_HPP
+
+#include "timezone.hpp"
+
+namespace xclox {
+
+namespace tzdb {
+
+    // The tables of the database, which are members of a class template so that every program has one copy of them.
+    template <typename T = void>
+    struct Tables {
+        static constexpr char characters[] =
+            "UTC\0"
+            "UTC0\0"
+            "Etc/UTC\0"
+            "Etc/GMT\0"
+            "GMT0\0"
+            "GMT\0"
+            "EET\0"
+            "EEST\0"
+            "Africa/Cairo\0"
+            "EET-2EEST,M4.5.5/0,M10.5.4/24\0"
+            "LMT\0"
+            "+00\0"
+            "+01\0"
+            "Africa/Casablanca\0"
+            "<+01>-1\0"
+            "SAST\0"
+            "Africa/Johannesburg\0"
+            "SAST-2\0"
+            "+0030\0"
+            "WAT\0"
+            "Africa/Lagos\0"
+            "WAT-1\0"
+            "+0230\0"
+            "EAT\0"
+            "+0245\0"
+            "Africa/Nairobi\0"
+            "EAT-3\0"
+            "AST\0"
+            "AWT\0"
+            "APT\0"
+            "AHST\0"
+            "AHDT\0"
+            "YST\0"
+            "AKST\0"
+            "AKDT\0"
+            "America/Anchorage\0"
+            "AKST9AKDT,M3.2.0,M11.1.0\0"
+            "CMT\0"
+            "-04\0"
+            "-03\0"
+            "-02\0"
+            "America/Argentina/Buenos_Aires\0"
+            "<-03>3\0"
+            "BMT\0"
+            "-05\0"
+            "America/Bogota\0"
+            "<-05>5\0"
+            "CST\0"
+            "CDT\0"
+            "EST\0"
+            "CWT\0"
+            "CPT\0"
+            "America/Chicago\0"
+            "CST6CDT,M3.2.0,M11.1.0\0"
+            "MST\0"
+            "MDT\0"
+            "MWT\0"
+            "MPT\0"
+            "America/Denver\0"
+            "MST7MDT,M3.2.0,M11.1.0\0"
+            "ADT\0"
+            "America/Halifax\0"
+            "AST4ADT,M3.2.0,M11.1.0\0"
+            "PST\0"
+            "PDT\0"
+            "PWT\0"
+            "PPT\0"
+            "America/Los_Angeles\0"
+            "PST8PDT,M3.2.0,M11.1.0\0"
+            "America/Mexico_City\0"
+            "CST6\0"
+            "EDT\0"
+            "EWT\0"
+            "EPT\0"
+            "America/New_York\0"
+            "EST5EDT,M3.2.0,M11.1.0\0"
+            "America/Phoenix\0"
+            "MST7\0"
+            "SMT\0"
+            "America/Santiago\0"
+            "<-04>4<-03>,M9.1.6/24,M4.1.6/24\0"
+            "America/Sao_Paulo\0"
+            "NST\0"
+            "NDT\0"
+            "NWT\0"
+            "NPT\0"
+            "NDDT\0"
+            "America/St_Johns\0"
+            "NST3:30NDT,M3.2.0,M11.1.0\0"
+            "America/Toronto\0"
+            "America/Vancouver\0"
+            "+07\0"
+            "Asia/Bangkok\0"
+            "<+07>-7\0"
+            "HMT\0"
+            "+0630\0"
+            "+0530\0"
+            "+06\0"
+            "Asia/Dhaka\0"
+            "<+06>-6\0"
+            "+04\0"
+            "Asia/Dubai\0"
+            "<+04>-4\0"
+            "HKT\0"
+            "HKST\0"
+            "HKWT\0"
+            "JST\0"
+            "Asia/Hong_Kong\0"
+            "HKT-8\0"
+            "+0720\0"
+            "+0730\0"
+            "+09\0"
+            "+08\0"
+            "WIB\0"
+            "Asia/Jakarta\0"
+            "WIB-7\0"
+            "JMT\0"
+            "IST\0"
+            "IDT\0"
+            "IDDT\0"
+            "Asia/Jerusalem\0"
+            "IST-2IDT,M3.4.4/26,M10.5.0\0"
+            "+05\0"
+            "PKT\0"
+            "PKST\0"
+            "Asia/Karachi\0"
+            "PKT-5\0"
+            "+0545\0"
+            "Asia/Kathmandu\0"
+            "<+0545>-5:45\0"
+            "MMT\0"
+            "Asia/Kolkata\0"
+            "IST-5:30\0"
+            "Asia/Calcutta\0"
+            "Asia/Manila\0"
+            "PST-8\0"
+            "KST\0"
+            "KDT\0"
+            "Asia/Seoul\0"
+            "KST-9\0"
+            "Asia/Shanghai\0"
+            "CST-8\0"
+            "Asia/Singapore\0"
+            "<+08>-8\0"
+            "Asia/Taipei\0"
+            "TMT\0"
+            "+0330\0"
+            "+0430\0"
+            "Asia/Tehran\0"
+            "<+0330>-3:30\0"
+            "JDT\0"
+            "Asia/Tokyo\0"
+            "JST-9\0"
+            "-01\0"
+            "Atlantic/Reykjavik\0"
+            "ACST\0"
+            "ACDT\0"
+            "Australia/Adelaide\0"
+            "ACST-9:30ACDT,M10.1.0,M4.1.0/3\0"
+            "AEST\0"
+            "AEDT\0"
+            "Australia/Brisbane\0"
+            "AEST-10\0"
+            "AWST\0"
+            "AWDT\0"
+            "Australia/Perth\0"
+            "AWST-8\0"
+            "Australia/Sydney\0"
+            "AEST-10AEDT,M10.1.0,M4.1.0/3\0"
+            "AMT\0"
+            "+0120\0"
+            "+0020\0"
+            "CEST\0"
+            "CET\0"
+            "Europe/Amsterdam\0"
+            "CET-1CEST,M3.5.0,M10.5.0/3\0"
+            "Europe/Athens\0"
+            "EET-2EEST,M3.5.0/3,M10.5.0/4\0"
+            "CEMT\0"
+            "Europe/Berlin\0"
+            "DMT\0"
+            "BST\0"
+            "Europe/Dublin\0"
+            "IST-1GMT0,M10.5.0,M3.5.0/1\0"
+            "IMT\0"
+            "+03\0"
+            "Europe/Istanbul\0"
+            "<+03>-3\0"
+            "WET\0"
+            "WEST\0"
+            "WEMT\0"
+            "Europe/Lisbon\0"
+            "WET0WEST,M3.5.0/1,M10.5.0\0"
+            "BDST\0"
+            "Europe/London\0"
+            "GMT0BST,M3.5.0/1,M10.5.0\0"
+            "Europe/Madrid\0"
+            "MDST\0"
+            "MSD\0"
+            "MSK\0"
+            "Europe/Moscow\0"
+            "MSK-3\0"
+            "PMT\0"
+            "Europe/Paris\0"
+            "RMT\0"
+            "Europe/Rome\0"
+            "SET\0"
+            "Europe/Stockholm\0"
+            "WMT\0"
+            "Europe/Warsaw\0"
+            "Europe/Zurich\0"
+            "NZMT\0"
+            "NZST\0"
+            "NZDT\0"
+            "Pacific/Auckland\0"
+            "NZST-12NZDT,M9.5.0,M4.1.0/3\0"
+            "HST\0"
+            "HDT\0"
+            "HWT\0"
+            "HPT\0"
+            "Pacific/Honolulu\0"
+            "HST10\0"
+            "US/Eastern\0"
+            "US/Pacific\0";
+        static constexpr TimeZoneDatabase::Type types[] = {
+            { 0, false, 0 }, { 0, false, 30 }, { 7200, false, 34 }, { 10800, true, 38 }, { 7509, false, 86 }, { 0, false, 90 }, { 3600, true, 94 }, { 3600, false, 94 },
+            { 0, true, 90 }, { -1820, false, 86 }, { 5400, false, 124 }, { 7200, false, 124 }, { 10800, true, 124 }, { 6720, false, 86 }, { 815, false, 86 }, { 1800, false, 156 },
+            { 3600, false, 162 }, { 9000, false, 185 }, { 10800, false, 191 }, { 9900, false, 195 }, { 8836, false, 86 }, { -35976, false, 86 }, { -36000, false, 222 }, { -32400, true, 226 },
+            { -32400, true, 230 }, { -36000, false, 234 }, { -32400, true, 239 }, { -32400, false, 244 }, { -32400, false, 248 }, { -28800, true, 253 }, { 50424, false, 86 }, { -15408, false, 301 },
+            { -14400, false, 305 }, { -10800, true, 309 }, { -10800, false, 309 }, { -7200, true, 313 }, { -14028, false, 86 }, { -17776, false, 355 }, { -18000, false, 359 }, { -14400, true, 305 },
+            { -17776, false, 86 }, { -21600, false, 385 }, { -18000, true, 389 }, { -18000, false, 393 }, { -18000, true, 397 }, { -18000, true, 401 }, { -21036, false, 86 }, { -25200, false, 444 },
+            { -21600, true, 448 }, { -21600, true, 452 }, { -21600, true, 456 }, { -25196, false, 86 }, { -14400, false, 222 }, { -10800, true, 498 }, { -10800, true, 226 }, { -10800, true, 230 },
+            { -15264, false, 86 }, { -28800, false, 541 }, { -25200, true, 545 }, { -25200, true, 549 }, { -25200, true, 553 }, { -28378, false, 86 }, { -23796, false, 86 }, { -14400, true, 625 },
+            { -14400, true, 629 }, { -14400, true, 633 }, { -17762, false, 86 }, { -26898, false, 86 }, { -16965, false, 698 }, { -16965, false, 86 }, { -11188, false, 86 }, { -12652, false, 769 },
+            { -9052, true, 773 }, { -12600, false, 769 }, { -9000, true, 773 }, { -9000, true, 777 }, { -9000, true, 781 }, { -5400, true, 785 }, { -12652, false, 86 }, { -19052, false, 86 },
+            { -29548, false, 86 }, { 24124, false, 355 }, { 25200, false, 867 }, { 24124, false, 86 }, { 21200, false, 892 }, { 23400, false, 896 }, { 19800, false, 902 }, { 21600, false, 908 },
+            { 25200, true, 867 }, { 21700, false, 86 }, { 14400, false, 931 }, { 13272, false, 86 }, { 28800, false, 954 }, { 32400, true, 958 }, { 30600, true, 963 }, { 32400, false, 968 },
+            { 27402, false, 86 }, { 25632, false, 355 }, { 26400, false, 993 }, { 27000, false, 999 }, { 32400, false, 1005 }, { 28800, false, 1009 }, { 25200, false, 1013 }, { 25632, false, 86 },
+            { 8440, false, 1036 }, { 7200, false, 1040 }, { 10800, true, 1044 }, { 14400, true, 1048 }, { 8454, false, 86 }, { 23400, true, 896 }, { 18000, false, 1095 }, { 18000, false, 1099 },
+            { 21600, true, 1103 }, { 16092, false, 86 }, { 20700, false, 1127 }, { 20476, false, 86 }, { 19270, false, 1161 }, { 19800, false, 1040 }, { 21208, false, 86 }, { 29032, false, 86 },
+            { 28800, false, 541 }, { 32400, true, 545 }, { -57368, false, 86 }, { 30600, false, 1219 }, { 32400, false, 1219 }, { 36000, true, 1223 }, { 34200, true, 1223 }, { 30472, false, 86 },
+            { 28800, false, 385 }, { 32400, true, 389 }, { 29143, false, 86 }, { 24925, false, 698 }, { 26400, true, 993 }, { 24925, false, 86 }, { 29160, false, 86 }, { 12344, false, 1299 },
+            { 12600, false, 1303 }, { 16200, true, 1309 }, { 18000, true, 1095 }, { 12344, false, 86 }, { 36000, true, 1340 }, { 33539, false, 86 }, { -3600, false, 1361 }, { -5280, false, 86 },
+            { 32400, false, 1384 }, { 34200, false, 1384 }, { 37800, true, 1389 }, { 33260, false, 86 }, { 36000, false, 1444 }, { 39600, true, 1449 }, { 36728, false, 86 }, { 28800, false, 1481 },
+            { 32400, true, 1486 }, { 27804, false, 86 }, { 36292, false, 86 }, { 1172, false, 1560 }, { 4772, true, 769 }, { 4800, true, 1564 }, { 1200, false, 1570 }, { 7200, true, 1576 },
+            { 3600, false, 1581 }, { 1172, false, 86 }, { 5692, false, 1560 }, { 5692, false, 86 }, { 10800, true, 1672 }, { 3208, false, 86 }, { -1521, false, 1691 }, { 2079, true, 1040 },
+            { 3600, true, 1695 }, { 3600, true, 1040 }, { 3600, false, 1040 }, { 0, true, 30 }, { -1521, false, 86 }, { 7016, false, 1740 }, { 10800, false, 1744 }, { 14400, true, 931 },
+            { 6952, false, 86 }, { -2205, false, 86 }, { 0, false, 1772 }, { 3600, true, 1776 }, { 7200, true, 1781 }, { 7200, true, 1826 }, { 3600, false, 1695 }, { -75, false, 86 },
+            { -884, false, 86 }, { 9017, false, 1161 }, { 9079, false, 1161 }, { 12679, true, 444 }, { 16279, true, 1884 }, { 14400, true, 1889 }, { 10800, false, 1893 }, { 14400, false, 1893 },
+            { 9017, false, 86 }, { 561, false, 1917 }, { 561, false, 86 }, { 2996, false, 1934 }, { 2996, false, 86 }, { 3614, false, 1950 }, { 4332, false, 86 }, { 5040, false, 1971 },
+            { 5040, false, 86 }, { 1786, false, 355 }, { 2048, false, 86 }, { 41400, false, 2003 }, { 45000, true, 2008 }, { 43200, true, 2008 }, { 43200, false, 2008 }, { 46800, true, 2013 },
+            { 41944, false, 86 }, { -37800, false, 2063 }, { -34200, true, 2067 }, { -34200, true, 2071 }, { -34200, true, 2075 }, { -36000, false, 2063 }, { -37886, false, 86 },
+        };
+        static constexpr std::int64_t times[] = {
+            -2185409109LL, -929844000, -923108400, -906170400, -892868400, -875844000, -857790000, -844308000,
+            -825822000, -812685600, -794199600, -779853600, -762663600, -399088800, -386650800, -368330400,
+            -355114800, -336790800, -323654400, -305168400, -292032000, -273632400, -260496000, -242096400,
+            -228960000, -210560400, -197424000, -178938000, -165801600, -147402000, -134265600, -115866000,
+            -102643200, -84330000, -71107200, -52707600, -39484800, -21171600, -7948800, 10364400,
+            23587200, 41900400, 55123200, 73522800, 86745600, 105058800, 118281600, 136594800,
+            149817600, 168130800, 181353600, 199753200, 212976000, 231289200, 244512000, 262825200,
+            276048000, 294361200, 307584000, 325983600, 339206400, 357519600, 370742400, 396399600,
+            402278400, 426812400, 433814400, 452214000, 465436800, 483750000, 496972800, 515286000,
+            528508800, 546822000, 560044800, 578444400, 591667200, 610412400, 623203200, 641516400,
+            654739200, 673052400, 686275200, 704674800, 717897600, 736210800, 749433600, 767746800,
+            780969600, 799020000, 812322000, 830469600, 843771600, 861919200, 875221200, 893368800,
+            906670800, 925423200, 938725200, 956872800, 970174800, 988322400, 1001624400, 1019772000,
+            1033074000, 1051221600, 1064523600, 1083276000, 1096578000, 1114725600, 1128027600, 1146175200,
+            1158872400, 1177624800, 1189112400, 1209074400, 1219957200, 1240524000, 1250802000, 1272578400,
+            1281474000, 1284069600, 1285880400, 1400191200, 1403816400, 1406844000, 1411678800, 1682632800,
+            -1773012580, -956361600, -950490000, -942019200, -761187600, -617241600, -605149200, -81432000,
+            -71110800, 141264000, 147222000, 199756800, 207702000, 231292800, 244249200, 265507200,
+            271033200, 448243200, 504918000, 1212278400, 1220223600, 1243814400, 1250809200, 1272758400,
+            1281222000, 1301788800, 1312066800, 1335664800, 1342749600, 1345428000, 1348970400, 1367114400,
+            1373162400, 1376100000, 1382839200, 1396144800, 1403920800, 1406944800, 1414288800, 1427594400,
+            1434247200, 1437271200, 1445738400, 1459044000, 1465092000, 1468116000, 1477792800, 1490493600,
+            1495332000, 1498960800, 1509242400, 1521943200, 1526176800, 1529200800, 1540692000, 1557021600,
+            1560045600, 1587261600, 1590890400, 1618106400, 1621130400, 1648346400, 1651975200, 1679191200,
+            1682215200, 1710036000, 1713060000, 1740276000, 1743904800, 1771120800, 1774144800, 1801965600,
+            1804989600, 1832205600, 1835834400, 1863050400, 1866074400, 1893290400, 1896919200, 1924135200,
+            1927159200, 1954980000, 1958004000, 1985220000, 1988848800, 2016064800, 2019088800, 2046304800,
+            2049933600, 2077149600, 2080778400, 2107994400, 2111018400, 2138234400, 2141863200, 2169079200LL,
+            2172103200LL, 2199924000LL, 2202948000LL, 2230164000LL, 2233792800LL, 2261008800LL, 2264032800LL, 2291248800LL,
+            2294877600LL, 2322093600LL, 2325722400LL, 2352938400LL, 2355962400LL, 2383178400LL, 2386807200LL, 2414023200LL,
+            2417047200LL, 2444868000LL, 2447892000LL, 2475108000LL, 2478736800LL, 2505952800LL, 2508976800LL, 2536192800LL,
+            2539821600LL, 2567037600LL, 2570666400LL, 2597882400LL, 2600906400LL, 2628122400LL, 2631751200LL, 2658967200LL,
+            2661991200LL, 2689812000LL, 2692836000LL, 2720052000LL, 2723680800LL, 2750896800LL, 2753920800LL, 2781136800LL,
+            2784765600LL, 2811981600LL, 2815610400LL, 2842826400LL, 2845850400LL, 2873066400LL, 2876695200LL, 2903911200LL,
+            2906935200LL, 2934756000LL, 2937780000LL, 2964996000LL, 2968624800LL, 2995840800LL, 2998864800LL, 3026080800LL,
+            3029709600LL, 3056925600LL, 3060554400LL, 3087770400LL, 3090794400LL, 3118010400LL, 3121639200LL, 3148855200LL,
+            3151879200LL, 3179700000LL, 3182724000LL, 3209940000LL, 3213568800LL, 3240784800LL, 3243808800LL, 3271024800LL,
+            3274653600LL, 3301869600LL, 3305498400LL, 3332714400LL, 3335738400LL, 3362954400LL, 3366583200LL, 3393799200LL,
+            3396823200LL, 3424644000LL, 3427668000LL, 3454884000LL, 3458512800LL, 3485728800LL, 3488752800LL, 3515968800LL,
+            3519597600LL, 3546813600LL, 3549837600LL, 3577658400LL, 3580682400LL, 3607898400LL, 3611527200LL, 3638743200LL,
+            3641767200LL, 3669588000LL, 3672612000LL, 3699828000LL, 3703456800LL, -2458173120LL, -2109288600, -860976000,
+            -845254800, -829526400, -813805200, -2035584815, -1940889600, -1767226415, -1588465800, -1946168836,
+            -1309746600, -1261969200, -1041388200, -865305900, -3225223727LL, -2188951224LL, -880200000, -769395600,
+            -765378000, -86882400, -21470400, -5749200, 9979200, 25700400, 41428800, 57754800,
+            73483200, 89204400, 104932800, 120654000, 126705600, 152103600, 162388800, 183553200,
+            199281600, 215607600, 230731200, 247057200, 262785600, 278506800, 294235200, 309956400,
+            325684800, 341406000, 357134400, 372855600, 388584000, 404910000, 420033600, 436359600,
+            439030800, 452084400, 467805600, 483534000, 499255200, 514983600, 530704800, 544618800,
+            562154400, 576068400, 594208800, 607518000, 625658400, 638967600, 657108000, 671022000,
+            688557600, 702471600, 720007200, 733921200, 752061600, 765370800, 783511200, 796820400,
+            814960800, 828874800, 846410400, 860324400, 877860000, 891774000, 909309600, 923223600,
+            941364000, 954673200, 972813600, 986122800, 1004263200, 1018177200, 1035712800, 1049626800,
+            1067162400, 1081076400, 1099216800, 1112526000, 1130666400, 1143975600, 1162116000, 1173610800,
+            -2372097972LL, -1567453392, -1233432000, -1222981200, -1205956800, -1194037200, -1172865600, -1162501200,
+            -1141329600, -1130965200, -1109793600, -1099429200, -1078257600, -1067806800, -1046635200, -1036270800,
+            -1015099200, -1004734800, -983563200, -973198800, -952027200, -941576400, -931032000, -900882000,
+            -890337600, -833749200, -827265600, -752274000, -733780800, -197326800, -190843200, -184194000,
+            -164491200, -152658000, -132955200, -121122000, -101419200, -86821200, -71092800, -54766800,
+            -39038400, -23317200, -7588800, 128142000, 136605600, 596948400, 605066400, 624423600,
+            636516000, 656478000, 667965600, 687927600, 699415200, 719377200, 731469600, 938919600,
+            952052400, 1198983600, 1205632800, 1224385200, 1237082400, 2147483647, -2707671824LL, -1739041424,
+            704869200, 729057600, 2147483647, -2717647200LL, -1633276800, -1615136400, -1601827200, -1583686800,
+            -1563724800, -1551632400, -1538928000, -1520182800, -1504454400, -1491757200, -1473004800, -1459702800,
+            -1441555200, -1428253200, -1410105600, -1396803600, -1378656000, -1365354000, -1347206400, -1333904400,
+            -1315152000, -1301850000, -1283702400, -1270400400, -1252252800, -1238950800, -1220803200, -1207501200,
+            -1189353600, -1176051600, -1157299200, -1144602000, -1125849600, -1112547600, -1094400000, -1081098000,
+            -1067788800, -1045414800, -1031500800, -1018198800, -1000051200, -986749200, -967996800, -955299600,
+            -936547200, -923245200, -905097600, -891795600, -880214400, -769395600, -765392400, -747244800,
+            -733942800, -715795200, -702493200, -684345600, -671043600, -652896000, -639594000, -620841600,
+            -608144400, -589392000, -576090000, -557942400, -544640400, -526492800, -513190800, -495043200,
+            -481741200, -463593600, -447267600, -431539200, -415818000, -400089600, -384368400, -368640000,
+            -352918800, -337190400, -321469200, -305740800, -289414800, -273686400, -257965200, -242236800,
+            -226515600, -210787200, -195066000, -179337600, -163616400, -147888000, -131562000, -116438400,
+            -100112400, -84384000, -68662800, -52934400, -37213200, -21484800, -5763600, 9964800,
+            25686000, 41414400, 57740400, 73468800, 89190000, 104918400, 120639600, 126691200,
+            152089200, 162374400, 183538800, 199267200, 215593200, 230716800, 247042800, 262771200,
+            278492400, 294220800, 309942000, 325670400, 341391600, 357120000, 372841200, 388569600,
+            404895600, 420019200, 436345200, 452073600, 467794800, 483523200, 499244400, 514972800,
+            530694000, 544608000, 562143600, 576057600, 594198000, 607507200, 625647600, 638956800,
+            657097200, 671011200, 688546800, 702460800, 719996400, 733910400, 752050800, 765360000,
+            783500400, 796809600, 814950000, 828864000, 846399600, 860313600, 877849200, 891763200,
+            909298800, 923212800, 941353200, 954662400, 972802800, 986112000, 1004252400, 1018166400,
+            1035702000, 1049616000, 1067151600, 1081065600, 1099206000, 1112515200, 1130655600, 1143964800,
+            1162105200, 1173600000, -2717643600LL, -1633273200, -1615132800, -1601823600, -1583683200, -1570374000,
+            -1551628800, -1538924400, -1534089600, -880210800, -769395600, -765388800, -147884400, -131558400,
+            -116434800, -100108800, -84380400, -68659200, -52930800, -37209600, -21481200, -5760000,
+            9968400, 25689600, 41418000, 57744000, 73472400, 89193600, 104922000, 120643200,
+            126694800, 152092800, 162378000, 183542400, 199270800, 215596800, 230720400, 247046400,
+            262774800, 278496000, 294224400, 309945600, 325674000, 341395200, 357123600, 372844800,
+            388573200, 404899200, 420022800, 436348800, 452077200, 467798400, 483526800, 499248000,
+            514976400, 530697600, 544611600, 562147200, 576061200, 594201600, 607510800, 625651200,
+            638960400, 657100800, 671014800, 688550400, 702464400, 720000000, 733914000, 752054400,
+            765363600, 783504000, 796813200, 814953600, 828867600, 846403200, 860317200, 877852800,
+            891766800, 909302400, 923216400, 941356800, 954666000, 972806400, 986115600, 1004256000,
+            1018170000, 1035705600, 1049619600, 1067155200, 1081069200, 1099209600, 1112518800, 1130659200,
+            1143968400, 1162108800, 1173603600, -2131645536, -1696276800, -1680469200, -1632074400, -1615143600,
+            -1566763200, -1557090000, -1535486400, -1524949200, -1504468800, -1493413200, -1472414400, -1461963600,
+            -1440964800, -1429390800, -1409515200, -1396731600, -1376856000, -1366491600, -1346616000, -1333832400,
+            -1313956800, -1303678800, -1282507200, -1272661200, -1251057600, -1240088400, -1219608000, -1207429200,
+            -1188763200, -1175979600, -1157313600, -1143925200, -1124049600, -1113771600, -1091390400, -1081026000,
+            -1059854400, -1050786000, -1030910400, -1018126800, -999460800, -986677200, -965592000, -955227600,
+            -935956800, -923173200, -904507200, -891723600, -880221600, -769395600, -765399600, -747252000,
+            -733950000, -715802400, -702500400, -684352800, -671050800, -652903200, -639601200, -589399200,
+            -576097200, -557949600, -544647600, -526500000, -513198000, -495050400, -481748400, -431546400,
+            -418244400, -400096800, -386794800, -368647200, -355345200, -337197600, -323895600, -242244000,
+            -226522800, -210794400, -195073200, -179344800, -163623600, -147895200, -131569200, -116445600,
+            -100119600, -84391200, -68670000, -52941600, -37220400, -21492000, -5770800, 9957600,
+            25678800, 41407200, 57733200, 73461600, 89182800, 104911200, 120632400, 136360800,
+            152082000, 167810400, 183531600, 199260000, 215586000, 230709600, 247035600, 262764000,
+            278485200, 294213600, 309934800, 325663200, 341384400, 357112800, 372834000, 388562400,
+            404888400, 420012000, 436338000, 452066400, 467787600, 483516000, 499237200, 514965600,
+            530686800, 544600800, 562136400, 576050400, 594190800, 607500000, 625640400, 638949600,
+            657090000, 671004000, 688539600, 702453600, 719989200, 733903200, 752043600, 765352800,
+            783493200, 796802400, 814942800, 828856800, 846392400, 860306400, 877842000, 891756000,
+            909291600, 923205600, 941346000, 954655200, 972795600, 986104800, 1004245200, 1018159200,
+            1035694800, 1049608800, 1067144400, 1081058400, 1099198800, 1112508000, 1130648400, 1143957600,
+            1162098000, 1173592800, -2717640000LL, -1633269600, -1615129200, -1601820000, -1583679600, -880207200,
+            -769395600, -765385200, -687967140, -662655600, -620838000, -608137200, -589388400, -576082800,
+            -557938800, -544633200, -526489200, -513183600, -495039600, -481734000, -463590000, -450284400,
+            -431535600, -418230000, -400086000, -386780400, -368636400, -355330800, -337186800, -323881200,
+            -305737200, -292431600, -273682800, -260982000, -242233200, -226508400, -210783600, -195058800,
+            -179334000, -163609200, -147884400, -131554800, -116434800, -100105200, -84376800, -68655600,
+            -52927200, -37206000, -21477600, -5756400, 9972000, 25693200, 41421600, 57747600,
+            73476000, 89197200, 104925600, 120646800, 126698400, 152096400, 162381600, 183546000,
+            199274400, 215600400, 230724000, 247050000, 262778400, 278499600, 294228000, 309949200,
+            325677600, 341398800, 357127200, 372848400, 388576800, 404902800, 420026400, 436352400,
+            452080800, 467802000, 483530400, 499251600, 514980000, 530701200, 544615200, 562150800,
+            576064800, 594205200, 607514400, 625654800, 638964000, 657104400, 671018400, 688554000,
+            702468000, 720003600, 733917600, 752058000, 765367200, 783507600, 796816800, 814957200,
+            828871200, 846406800, 860320800, 877856400, 891770400, 909306000, 923220000, 941360400,
+            954669600, 972810000, 986119200, 1004259600, 1018173600, 1035709200, 1049623200, 1067158800,
+            1081072800, 1099213200, 1112522400, 1130662800, 1143972000, 1162112400, 1173607200, -1514739600,
+            -1343149200, -1234807200, -1220461200, -1207159200, -1191344400, -975261600, -963169200, -917114400,
+            -907354800, -821901600, -810068400, -627501600, -612990000, 828864000, 846399600, 860313600,
+            877849200, 891763200, 909298800, 923212800, 941353200, 954662400, 972802800, 989136000,
+            1001833200, 1018166400, 1035702000, 1049616000, 1067151600, 1081065600, 1099206000, 1112515200,
+            1130655600, 1143964800, 1162105200, 1175414400, 1193554800, 1207468800, 1225004400, 1238918400,
+            1256454000, 1270368000, 1288508400, 1301817600, 1319958000, 1333267200, 1351407600, 1365321600,
+            1382857200, 1396771200, 1414306800, 1428220800, 1445756400, 1459670400, 1477810800, 1491120000,
+            1509260400, 1522569600, 1540710000, 1554624000, 1572159600, 1586073600, 1603609200, 1617523200,
+            1635663600, 1648972800, 1667113200, -2717650800LL, -1633280400, -1615140000, -1601830800, -1583690400,
+            -1570381200, -1551636000, -1536512400, -1523210400, -1504458000, -1491760800, -1473008400, -1459706400,
+            -1441558800, -1428256800, -1410109200, -1396807200, -1378659600, -1365357600, -1347210000, -1333908000,
+            -1315155600, -1301853600, -1283706000, -1270404000, -1252256400, -1238954400, -1220806800, -1207504800,
+            -1189357200, -1176055200, -1157302800, -1144605600, -1125853200, -1112551200, -1094403600, -1081101600,
+            -1062954000, -1049652000, -1031504400, -1018202400, -1000054800, -986752800, -968000400, -955303200,
+            -936550800, -923248800, -905101200, -891799200, -880218000, -769395600, -765396000, -747248400,
+            -733946400, -715798800, -702496800, -684349200, -671047200, -652899600, -639597600, -620845200,
+            -608148000, -589395600, -576093600, -557946000, -544644000, -526496400, -513194400, -495046800,
+            -481744800, -463597200, -447271200, -431542800, -415821600, -400093200, -384372000, -368643600,
+            -352922400, -337194000, -321472800, -305744400, -289418400, -273690000, -257968800, -242240400,
+            -226519200, -210790800, -195069600, -179341200, -163620000, -147891600, -131565600, -116442000,
+            -100116000, -84387600, -68666400, -52938000, -37216800, -21488400, -5767200, 9961200,
+            25682400, 41410800, 57736800, 73465200, 89186400, 104914800, 120636000, 126687600,
+            152085600, 162370800, 183535200, 199263600, 215589600, 230713200, 247039200, 262767600,
+            278488800, 294217200, 309938400, 325666800, 341388000, 357116400, 372837600, 388566000,
+            404892000, 420015600, 436341600, 452070000, 467791200, 483519600, 499240800, 514969200,
+            530690400, 544604400, 562140000, 576054000, 594194400, 607503600, 625644000, 638953200,
+            657093600, 671007600, 688543200, 702457200, 719992800, 733906800, 752047200, 765356400,
+            783496800, 796806000, 814946400, 828860400, 846396000, 860310000, 877845600, 891759600,
+            909295200, 923209200, 941349600, 954658800, 972799200, 986108400, 1004248800, 1018162800,
+            1035698400, 1049612400, 1067148000, 1081062000, 1099202400, 1112511600, 1130652000, 1143961200,
+            1162101600, 1173596400, -2717643600LL, -1633273200, -1615132800, -1601823600, -1583683200, -880210800,
+            -820519140, -812653140, -796845540, -84380400, -68659200, -2524504635LL, -1892661435, -1688410800,
+            -1619205435, -1593806400, -1335986235, -1317585600, -1304362800, -1286049600, -1272826800, -1254513600,
+            -1241290800, -1222977600, -1209754800, -1191355200, -1178132400, -870552000, -865278000, -740520000,
+            -736635600, -718056000, -713649600, -36619200, -23922000, -3355200, 7527600, 24465600,
+            37767600, 55915200, 69217200, 87969600, 100666800, 118209600, 132116400, 150868800,
+            163566000, 182318400, 195620400, 213768000, 227070000, 245217600, 258519600, 277272000,
+            289969200, 308721600, 321418800, 340171200, 353473200, 371620800, 384922800, 403070400,
+            416372400, 434520000, 447822000, 466574400, 479271600, 498024000, 510721200, 529473600,
+            545194800, 560923200, 574225200, 592372800, 605674800, 624427200, 637124400, 653457600,
+            668574000, 687326400, 700628400, 718776000, 732078000, 750225600, 763527600, 781675200,
+            794977200, 813729600, 826426800, 845179200, 859690800, 876628800, 889930800, 906868800,
+            923194800, 939528000, 952830000, 971582400, 984279600, 1003032000, 1015729200, 1034481600,
+            1047178800, 1065931200, 1079233200, 1097380800, 1110682800, 1128830400, 1142132400, 1160884800,
+            1173582000, 1192334400, 1206846000, 1223784000, 1237086000, 1255233600, 1270350000, 1286683200,
+            1304823600, 1313899200, 1335668400, 1346558400, 1367118000, 1378612800, 1398567600, 1410062400,
+            1463281200, 1471147200, 1494730800, 1502596800, 1526180400, 1534046400, 1554606000, 1567915200,
+            1586055600, 1599364800, 1617505200, 1630814400, 1648954800, 1662868800, 1680404400, 1693713600,
+            1712458800, 1725768000, 1743908400, 1757217600, 1775358000, 1788667200, 1806807600, 1820116800,
+            1838257200, 1851566400, 1870311600, 1883016000, 1901761200, 1915070400, 1933210800, 1946520000,
+            1964660400, 1977969600, 1996110000, 2009419200, 2027559600, 2040868800, 2059614000, 2072318400,
+            2091063600, 2104372800, 2122513200, 2135822400, 2147483647, -1767214412, -1206957600, -1191362400,
+            -1175374800, -1159826400, -633819600, -622069200, -602283600, -591832800, -570747600, -560210400,
+            -539125200, -531352800, -195426000, -184197600, -155163600, -150069600, -128898000, -121125600,
+            -99954000, -89589600, -68418000, -57967200, 499748400, 511236000, 530593200, 540266400,
+            562129200, 571197600, 592974000, 602042400, 624423600, 634701600, 656478000, 666756000,
+            687927600, 697600800, 719982000, 728445600, 750826800, 761709600, 782276400, 793159200,
+            813726000, 824004000, 844570800, 856058400, 876106800, 888717600, 908074800, 919562400,
+            938919600, 951616800, 970974000, 982461600, 1003028400, 1013911200, 1036292400, 1045360800,
+            1066532400, 1076810400, 1099364400, 1108864800, 1129431600, 1140314400, 1162695600, 1172368800,
+            1192330800, 1203213600, 1224385200, 1234663200, 1255834800, 1266717600, 1287284400, 1298167200,
+            1318734000, 1330221600, 1350788400, 1361066400, 1382238000, 1392516000, 1413687600, 1424570400,
+            1445137200, 1456020000, 1476586800, 1487469600, 1508036400, 1518919200, 1541300400, 1550368800,
+            2147483647, -2713897748LL, -1664130548, -1650137348, -1632076148, -1615145348, -1598650148, -1590100148,
+            -1567286948, -1551565748, -1535837348, -1520116148, -1503782948, -1488666548, -1472333348, -1457216948,
+            -1440883748, -1425767348, -1409434148, -1394317748, -1377984548, -1362263348, -1346534948, -1330813748,
+            -1314480548, -1299364148, -1283030948, -1267914548, -1251581348, -1236464948, -1220131748, -1205015348,
+            -1188682148, -1172960948, -1156627748, -1141511348, -1125178148, -1110061748, -1096921748, -1093728600,
+            -1078612200, -1061670600, -1048973400, -1030221000, -1017523800, -998771400, -986074200, -966717000,
+            -954624600, -935267400, -922570200, -903817800, -891120600, -872368200, -769395600, -765401400,
+            -746044200, -733347000, -714594600, -701897400, -683145000, -670447800, -651695400, -638998200,
+            -619641000, -606943800, -589401000, -576099000, -557951400, -544649400, -526501800, -513199800,
+            -495052200, -481750200, -463602600, -450300600, -431548200, -418246200, -400098600, -386796600,
+            -368649000, -355347000, -337199400, -323897400, -305749800, -289423800, -273695400, -257974200,
+            -242245800, -226524600, -210796200, -195075000, -179346600, -163625400, -147897000, -131571000,
+            -116447400, -100121400, -84393000, -68671800, -52943400, -37222200, -21493800, -5772600,
+            9955800, 25677000, 41405400, 57731400, 73459800, 89181000, 104909400, 120630600,
+            136359000, 152080200, 167808600, 183529800, 199258200, 215584200, 230707800, 247033800,
+            262762200, 278483400, 294211800, 309933000, 325661400, 341382600, 357111000, 372832200,
+            388560600, 404886600, 420010200, 436336200, 452064600, 467785800, 483514200, 499235400,
+            514963800, 530685000, 544591860, 562127460, 576041460, 594178260, 607491060, 625631460,
+            638940660, 657081060, 670995060, 688530660, 702444660, 719980260, 733894260, 752034660,
+            765343860, 783484260, 796793460, 814933860, 828847860, 846383460, 860297460, 877833060,
+            891747060, 909282660, 923196660, 941337060, 954646260, 972786660, 986095860, 1004236260,
+            1018150260, 1035685860, 1049599860, 1067135460, 1081049460, 1099189860, 1112499060, 1130639460,
+            1143948660, 1162089060, 1173583860, 1194143460, 1205033460, 1225593060, 1236483060, 1257042660,
+            1268537460, 1289097060, 1299987060, 1320553800, -2366736148LL, -1632070800, -1615140000, -1601753400,
+            -1583697600, -1567357200, -1554667200, -1534698000, -1524074400, -1503248400, -1492365600, -1471798800,
+            -1460916000, -1440954000, -1428861600, -1409504400, -1397412000, -1378054800, -1365962400, -1346605200,
+            -1333908000, -1315155600, -1301853600, -1283706000, -1270404000, -1252256400, -1238954400, -1220806800,
+            -1207504800, -1188752400, -1176055200, -1157302800, -1144000800, -1125853200, -1112551200, -1094403600,
+            -1081101600, -1062954000, -1049652000, -1031504400, -1018202400, -1000054800, -986752800, -968000400,
+            -955303200, -936550800, -880218000, -769395600, -765396000, -747248400, -733946400, -715798800,
+            -702496800, -684349200, -671047200, -652899600, -634154400, -620845200, -602704800, -589395600,
+            -576093600, -557946000, -544644000, -526496400, -513194400, -495046800, -481744800, -463597200,
+            -450295200, -431542800, -418240800, -400093200, -384372000, -368643600, -352922400, -337194000,
+            -321472800, -305744400, -289418400, -273690000, -257968800, -242240400, -226519200, -210790800,
+            -195069600, -179341200, -163620000, -147891600, -131565600, -116442000, -100116000, -84387600,
+            -68666400, -52938000, -37216800, -21488400, -5767200, 9961200, 25682400, 41410800,
+            57736800, 73465200, 89186400, 104914800, 120636000, 136364400, 152085600, 167814000,
+            183535200, 199263600, 215589600, 230713200, 247039200, 262767600, 278488800, 294217200,
+            309938400, 325666800, 341388000, 357116400, 372837600, 388566000, 404892000, 420015600,
+            436341600, 452070000, 467791200, 483519600, 499240800, 514969200, 530690400, 544604400,
+            562140000, 576054000, 594194400, 607503600, 625644000, 638953200, 657093600, 671007600,
+            688543200, 702457200, 719992800, 733906800, 752047200, 765356400, 783496800, 796806000,
+            814946400, 828860400, 846396000, 860310000, 877845600, 891759600, 909295200, 923209200,
+            941349600, 954658800, 972799200, 986108400, 1004248800, 1018162800, 1035698400, 1049612400,
+            1067148000, 1081062000, 1099202400, 1112511600, 1130652000, 1143961200, 1162101600, 1173596400,
+            -2713880852LL, -1632060000, -1615129200, -880207200, -769395600, -765385200, -747237600, -733935600,
+            -715788000, -702486000, -684338400, -671036400, -652888800, -639586800, -620834400, -608137200,
+            -589384800, -576082800, -557935200, -544633200, -526485600, -513183600, -495036000, -481734000,
+            -463586400, -450284400, -431532000, -418230000, -400082400, -386780400, -368632800, -355330800,
+            -337183200, -323881200, -305733600, -292431600, -273679200, -260982000, -242229600, -226508400,
+            -210780000, -195058800, -179330400, -163609200, -147880800, -131554800, -116431200, -100105200,
+            -84376800, -68655600, -52927200, -37206000, -21477600, -5756400, 9972000, 25693200,
+            41421600, 57747600, 73476000, 89197200, 104925600, 120646800, 136375200, 152096400,
+            167824800, 183546000, 199274400, 215600400, 230724000, 247050000, 262778400, 278499600,
+            294228000, 309949200, 325677600, 341398800, 357127200, 372848400, 388576800, 404902800,
+            420026400, 436352400, 452080800, 467802000, 483530400, 499251600, 514980000, 530701200,
+            544615200, 562150800, 576064800, 594205200, 607514400, 625654800, 638964000, 657104400,
+            671018400, 688554000, 702468000, 720003600, 733917600, 752058000, 765367200, 783507600,
+            796816800, 814957200, 828871200, 846406800, 860320800, 877856400, 891770400, 909306000,
+            923220000, 941360400, 954669600, 972810000, 986119200, 1004259600, 1018173600, 1035709200,
+            1049623200, 1067158800, 1081072800, 1099213200, 1112522400, 1130662800, 1143972000, 1162112400,
+            1173607200, -2840164924LL, -1570084924, 2147483647, -2524543300LL, -891582800, -872058600, -862637400,
+            -576138600, 1245430800, 1262278800, 2147483647, -1577936472, 2147483647, -2056690800, -900910800,
+            -891579600, -884248200, -761209200, -747907200, -728541000, -717049800, -697091400, -683785800,
+            -668061000, -654755400, -636611400, -623305800, -605161800, -591856200, -573712200, -559801800,
+            -541657800, -528352200, -510211800, -498112200, -478762200, -466662600, -446707800, -435213000,
+            -415258200, -403158600, -383808600, -371709000, -352359000, -340259400, -320909400, -308809800,
+            -288855000, -277360200, -257405400, -245910600, -225955800, -213856200, -194506200, -182406600,
+            -163056600, -148537800, -132816600, -117088200, -101367000, -85638600, -69312600, -53584200,
+            -37863000, -22134600, -6413400, 9315000, 25036200, 40764600, 56485800, 72214200,
+            88540200, 104268600, 119989800, 126041400, 151439400, 167167800, 182889000, 198617400,
+            214338600, 295385400, 309292200, -3231299232LL, -1451719200, -1172906400, -876641400, -766054800,
+            -683883000, -620812800, -189415800, -2840149254LL, -1641003640, -933638400, -923097600, -919036800,
+            -857347200, -844300800, -825811200, -812678400, -794188800, -779846400, -762652800, -748310400,
+            -731116800, -681955200, -673228800, -667958400, -652320000, -636422400, -622080000, -608947200,
+            -591840000, -572486400, -558576000, -542851200, -527731200, -514425600, -490838400, -482976000,
+            -459388800, -451526400, -428544000, -418262400, -400118400, -387417600, 142380000, 150843600,
+            167176800, 178664400, 334101600, 337730400, 452642400, 462319200, 482277600, 494370000,
+            516751200, 526424400, 545436000, 558478800, 576626400, 589323600, 609890400, 620773200,
+            638316000, 651618000, 669765600, 683672400, 701820000, 715726800, 733701600, 747176400,
+            765151200, 778021200, 796600800, 810075600, 826840800, 842821200, 858895200, 874184400,
+            890344800, 905029200, 923011200, 936313200, 955670400, 970783200, 986770800, 1001282400,
+            1017356400, 1033941600, 1048806000, 1065132000, 1081292400, 1095804000, 1112313600, 1128812400,
+            1143763200, 1159657200, 1175212800, 1189897200, 1206662400, 1223161200, 1238112000, 1254006000,
+            1269561600, 1284246000, 1301616000, 1317510000, 1333065600, 1348354800, 1364515200, -1988166492,
+            -862637400, -764145000, -576135000, 38775600, 1018119600, 1033840800, 1212260400, 1225476000,
+            1239735600, 1257012000, -1577943676, 504901800, 2147483647, -3645237208LL, -3155694800LL, -2019705670,
+            -891581400, -872058600, -862637400, -764145000, -3944621032LL, -2219083200LL, -1046678400, -1040115600,
+            -885024000, -880016400, -783594000, -760093200, -496224000, -491562000, 228326400, 243702000,
+            643219200, 649177200, -1948782472, -1830414600, -767350800, -681210000, -672228000, -654771600,
+            -640864800, -623408400, -609415200, -588848400, -577965600, -498128400, -462702600, -451733400,
+            -429784200, -418296600, -399544200, -387451800, -368094600, -356002200, -336645000, -324552600,
+            -305195400, -293103000, -264933000, 547578000, 560883600, 579027600, 592333200, -2177481943LL,
+            -1600675200, -1585904400, -933667200, -922093200, -908870400, -888829200, -881049600, -767869200,
+            -745833600, -733827600, -716889600, -699613200, -683884800, -670669200, -652348800, -650019600,
+            515527200, 527014800, 545162400, 558464400, 577216800, 589914000, 608666400, 621968400,
+            640116000, 653418000, 671565600, 684867600, -2177477725LL, -2038200925, -1167634800, -1073028000,
+            -894180000, -879665400, -767005200, 378662400, 2147483647, -2335248360LL, -1017820800, -766224000,
+            -745833600, -733827600, -716889600, -699613200, -683884800, -670669200, -652348800, -639133200,
+            -620812800, -607597200, -589276800, -576061200, -562924800, -541760400, -528710400, -510224400,
+            -497174400, -478688400, -465638400, -449830800, -434016000, -418208400, -402480000, -386672400,
+            -370944000, -355136400, -339408000, -323600400, -302515200, -291978000, -270979200, -260442000,
+            133977600, 149785200, 165513600, 181321200, 299606400, 307551600, -1704165944, -1090466744,
+            227820600, 246223800, 259617600, 271108800, 279576000, 296598600, 306531000, 322432200,
+            338499000, 673216200, 685481400, 701209800, 717103800, 732745800, 748639800, 764281800,
+            780175800, 795817800, 811711800, 827353800, 843247800, 858976200, 874870200, 890512200,
+            906406200, 922048200, 937942200, 953584200, 969478200, 985206600, 1001100600, 1016742600,
+            1032636600, 1048278600, 1064172600, 1079814600, 1095708600, 1111437000, 1127331000, 1206045000,
+            1221939000, 1237667400, 1253561400, 1269203400, 1285097400, 1300739400, 1316633400, 1332275400,
+            1348169400, 1363897800, 1379791800, 1395433800, 1411327800, 1426969800, 1442863800, 1458505800,
+            1474399800, 1490128200, 1506022200, 1521664200, 1537558200, 1553200200, 1569094200, 1584736200,
+            1600630200, 1616358600, 1632252600, 1647894600, 1663788600, 2147483647, -2587712400LL, -683802000,
+            -672310800, -654771600, -640861200, -620298000, -609411600, -588848400, -577962000, -1956609120,
+            -1668211200, -1647212400, -1636675200, -1613430000, -1605139200, -1581894000, -1539561600, -1531350000,
+            -968025600, -952293600, -942008400, -920239200, -909957600, -888789600, -877903200, -857944800,
+            -846453600, -826495200, -815004000, -795045600, -783554400, -762991200, -752104800, -731541600,
+            -717631200, -700092000, -686181600, -668642400, -654732000, -636588000, -623282400, -605743200,
+            -591832800, -573688800, -559778400, -542239200, -528328800, -510789600, -496879200, -479340000,
+            -465429600, -447890400, -433980000, -415836000, -401925600, -384386400, -370476000, -352936800,
+            -339026400, -321487200, -307576800, -290037600, -276127200, -258588000, -244677600, -226533600,
+            -212623200, -195084000, -181173600, -163634400, -149724000, -132184800, -118274400, -100735200,
+            -86824800, -68680800, -54770400, -2364110060LL, -2230189200LL, -1672558200, -1665387000, -883639800,
+            -876123000, -860398200, -844673400, -828343800, -813223800, 57688200, 67969800, 89137800,
+            100024200, 120587400, 131473800, 152037000, 162923400, 183486600, 194977800, 215541000,
+            226427400, 246990600, 257877000, 278440200, 289326600, 309889800, 320776200, 341339400,
+            352225800, 372789000, 384280200, 404843400, 415729800, 436293000, 447179400, 467742600,
+            478629000, 499192200, 511288200, 530037000, 542737800, 562091400, 574792200, 594145800,
+            606241800, 625595400, 637691400, 657045000, 667931400, 688494600, 701195400, 719944200,
+            731435400, 751998600, 764094600, 783448200, 796149000, 814897800, 828203400, 846347400,
+            859653000, 877797000, 891102600, 909246600, 922552200, 941301000, 954001800, 972750600,
+            985451400, 1004200200, 1017505800, 1035649800, 1048955400, 1067099400, 1080405000, 1099153800,
+            1111854600, 1130603400, 1143909000, 1162053000, 1174753800, 1193502600, -2366791928LL, -1672560000,
+            -1665388800, -883641600, -876124800, -860400000, -844675200, -828345600, -813225600, 57686400,
+            67968000, 625593600, 636480000, 657043200, 667929600, 688492800, 699379200, -2337925404LL,
+            -1672552800, -1665381600, -883634400, -876117600, -860392800, -844668000, 152042400, 162928800,
+            436298400, 447184800, 690314400, 699386400, 1165082400, 1174759200, 1193508000, 1206813600,
+            1224957600, 1238263200, -2364113092LL, -1672560000, -1665388800, -883641600, -876124800, -860400000,
+            -844675200, -828345600, -813225600, 57686400, 67968000, 89136000, 100022400, 120585600,
+            131472000, 152035200, 162921600, 183484800, 194976000, 215539200, 226425600, 246988800,
+            257875200, 278438400, 289324800, 309888000, 320774400, 341337600, 352224000, 372787200,
+            386697600, 404841600, 415728000, 436291200, 447177600, 467740800, 478627200, 499190400,
+            511286400, 530035200, 542736000, 562089600, 574790400, 594144000, 606240000, 625593600,
+            636480000, 657043200, 667929600, 688492800, 699379200, 719942400, 731433600, 751996800,
+            762883200, 783446400, 794332800, 814896000, 828201600, 846345600, 859651200, 877795200,
+            891100800, 909244800, 922550400, 941299200, 954000000, 967305600, 985449600, 1004198400,
+            1017504000, 1035648000, 1048953600, 1067097600, 1080403200, 1099152000, 1111852800, 1130601600,
+            1143907200, 1162051200, 1174752000, 1193500800, -4260212372LL, -1693700372, -1680484772, -1663453172,
+            -1650147572, -1633213172, -1617488372, -1601158772, -1586038772, -1569709172, -1554589172, -1538259572,
+            -1523139572, -1507501172, -1490566772, -1470176372, -1459117172, -1443997172, -1427667572, -1406672372,
+            -1396217972, -1376950772, -1364768372, -1345414772, -1333318772, -1313792372, -1301264372, -1282256372,
+            -1269814772, -1250720372, -1238365172, -1219184372, -1206915572, -1186957172, -1175465972, -1156025972,
+            -1143411572, -1124489972, -1111961972, -1092953972, -1080512372, -1061331572, -1049062772, -1029190772,
+            -1025745572, -1017613200, -998259600, -986163600, -966723600, -954109200, -935022000, -857257200,
+            -844556400, -828226800, -812502000, -796777200, -781052400, -766623600, 228877200, 243997200,
+            260326800, 276051600, 291776400, 307501200, 323830800, 338950800, 354675600, 370400400,
+            386125200, 401850000, 417574800, 433299600, 449024400, 465354000, 481078800, 496803600,
+            512528400, 528253200, 543978000, 559702800, 575427600, 591152400, 606877200, 622602000,
+            638326800, 654656400, 670381200, 686106000, 701830800, 717555600, 733280400, 749005200,
+            764730000, 780454800, 796179600, 811904400, 828234000, -2344642492LL, -1686101632, -1182996000,
+            -1178161200, -906861600, -904878000, -857257200, -844477200, -828237600, -812422800, -552362400,
+            -541652400, 166485600, 186184800, 198028800, 213753600, 228873600, 244080000, 260323200,
+            275446800, 291798000, 307407600, 323388000, 338936400, 354675600, 370400400, 386125200,
+            401850000, 417574800, 433299600, 449024400, 465354000, 481078800, 496803600, 512528400,
+            528253200, 543978000, 559702800, 575427600, 591152400, 606877200, 622602000, 638326800,
+            654656400, 670381200, 686106000, 701830800, 717555600, 733280400, 749005200, 764730000,
+            780454800, 796179600, 811904400, 828234000, -2422054408LL, -1693706400, -1680483600, -1663455600,
+            -1650150000, -1632006000, -1618700400, -938905200, -857257200, -844556400, -828226800, -812502000,
+            -796777200, -781052400, -776563200, -765936000, -761180400, -748479600, -733273200, -717631200,
+            -714610800, -710380800, -701910000, -684975600, -670460400, -654130800, -639010800, 323830800,
+            338950800, 354675600, 370400400, 386125200, 401850000, 417574800, 433299600, 449024400,
+            465354000, 481078800, 496803600, 512528400, 528253200, 543978000, 559702800, 575427600,
+            591152400, 606877200, 622602000, 638326800, 654656400, 670381200, 686106000, 701830800,
+            717555600, 733280400, 749005200, 764730000, 780454800, 796179600, 811904400, 828234000,
+            -2821649679LL, -1691962479, -1680471279, -1664143200, -1650146400, -1633903200, -1617487200, -1601848800,
+            -1586037600, -1570399200, -1552168800, -1538344800, -1522533600, -1507500000, -1490565600, -1473631200,
+            -1460930400, -1442786400, -1428876000, -1410732000, -1396216800, -1379282400, -1364767200, -1348437600,
+            -1333317600, -1315778400, -1301263200, -1284328800, -1269813600, -1253484000, -1238364000, -1221429600,
+            -1206914400, -1189980000, -1175464800, -1159135200, -1143410400, -1126476000, -1111960800, -1095631200,
+            -1080511200, -1063576800, -1049061600, -1032127200, -1017612000, -1001282400, -986162400, -969228000,
+            -950479200, -942012000, -733356000, -719445600, -699487200, -684972000, -668037600, -654732000,
+            -636588000, -622072800, -605743200, -590623200, -574293600, -558568800, -542239200, -527119200,
+            -512604000, -496274400, -481154400, -464220000, -449704800, -432165600, -417650400, -401320800,
+            -386200800, -369266400, -354751200, -337816800, -323301600, -306972000, -291852000, -276732000,
+            -257983200, -245282400, -226533600, -213228000, -195084000, -182383200, -163634400, -150933600,
+            -132184800, -119484000, -100735200, -88034400, -68680800, -59004000, -37242000, 57722400,
+            69818400, 89172000, 101268000, 120621600, 132717600, 152071200, 164167200, 183520800,
+            196221600, 214970400, 227671200, 246420000, 259120800, 278474400, 290570400, 309924000,
+            322020000, 341373600, 354675600, 372819600, 386125200, 404269200, 417574800, 435718800,
+            449024400, 467773200, 481078800, 499222800, 512528400, 530672400, 543978000, 562122000,
+            575427600, 593571600, 606877200, 625626000, 638326800, 657075600, 670381200, 688525200,
+            701830800, 719974800, 733280400, 751424400, 764730000, 782874000, 796179600, 814323600,
+            828234000, -2840147752LL, -1869875816, -1693706400, -1680490800, -1570413600, -1552186800, -1538359200,
+            -1522551600, -1507514400, -1490583600, -1440208800, -1428030000, -1409709600, -1396494000, -931053600,
+            -922676400, -917834400, -892436400, -875844000, -764737200, -744343200, -733806000, -716436000,
+            -701924400, -684986400, -670474800, -654141600, -639025200, -622087200, -606970800, -590032800,
+            -575521200, -235620000, -194842800, -177732000, -165726000, 107910000, 121215600, 133920000,
+            152665200, 164678400, 184114800, 196214400, 215564400, 228873600, 245804400, 260323200,
+            267915600, 428454000, 433893600, 468111600, 482799600, 496710000, 512521200, 528246000,
+            543970800, 559695600, 575420400, 591145200, 606870000, 622594800, 638319600, 654649200,
+            670374000, 686098800, 701823600, 717548400, 733273200, 748998000, 764118000, 780447600,
+            796172400, 811897200, 828226800, 846370800, 859676400, 877820400, 891126000, 909270000,
+            922575600, 941324400, 954025200, 972774000, 985474800, 1004223600, 1017529200, 1035673200,
+            1048978800, 1067122800, 1080428400, 1099177200, 1111878000, 1130626800, 1143327600, 1162076400,
+            1174784400, 1193533200, 1206838800, 1224982800, 1238288400, 1256432400, 1269738000, 1288486800,
+            1301274000, 1319936400, 1332637200, 1351386000, 1364691600, 1382835600, 1396227600, 1414285200,
+            1427590800, 1446944400, 1459040400, 1473195600, 2147483647, -2713908195LL, -1830384000, -1689555600,
+            -1677801600, -1667433600, -1647738000, -1635897600, -1616202000, -1604361600, -1584666000, -1572739200,
+            -1553043600, -1541203200, -1521507600, -1442451600, -1427677200, -1379293200, -1364778000, -1348448400,
+            -1333328400, -1316394000, -1301274000, -1284339600, -1269824400, -1221440400, -1206925200, -1191200400,
+            -1175475600, -1127696400, -1111971600, -1096851600, -1080522000, -1063587600, -1049072400, -1033347600,
+            -1017622800, -1002502800, -986173200, -969238800, -950490000, -942022800, -922496400, -906944400,
+            -891133200, -877309200, -873684000, -864007200, -857955600, -845859600, -842839200, -831348000,
+            -825901200, -814410000, -810784800, -799898400, -794451600, -782960400, -779335200, -768448800,
+            -763002000, -749091600, -733366800, -717631200, -701906400, -686181600, -670456800, -654732000,
+            -639007200, -623282400, -607557600, -591832800, -575503200, -559778400, -544053600, -528328800,
+            -512604000, -496879200, -481154400, -465429600, -449704800, -433980000, -417650400, -401925600,
+            -386200800, -370476000, -354751200, -339026400, -323301600, -307576800, -291852000, -276127200,
+            -260402400, -244677600, -228348000, -212623200, -196898400, -181173600, -165448800, -149724000,
+            -133999200, -118274400, -102549600, 212544000, 228268800, 243993600, 260326800, 276051600,
+            291776400, 307501200, 323830800, 338950800, 354672000, 370396800, 386121600, 401846400,
+            417571200, 433296000, 449020800, 465350400, 481075200, 496800000, 512528400, 528253200,
+            543978000, 559702800, 575427600, 591152400, 606877200, 622602000, 638326800, 654656400,
+            670381200, 686106000, 701830800, 717555600, 733280400, 749005200, 764730000, 780454800,
+            796179600, 811904400, 828234000, -3852662325LL, -1691964000, -1680472800, -1664143200, -1650146400,
+            -1633903200, -1617487200, -1601848800, -1586037600, -1570399200, -1552168800, -1538344800, -1522533600,
+            -1507500000, -1490565600, -1473631200, -1460930400, -1442786400, -1428876000, -1410732000, -1396216800,
+            -1379282400, -1364767200, -1348437600, -1333317600, -1315778400, -1301263200, -1284328800, -1269813600,
+            -1253484000, -1238364000, -1221429600, -1206914400, -1189980000, -1175464800, -1159135200, -1143410400,
+            -1126476000, -1111960800, -1095631200, -1080511200, -1063576800, -1049061600, -1032127200, -1017612000,
+            -1001282400, -986162400, -969228000, -950479200, -942012000, -904518000, -896050800, -875487600,
+            -864601200, -844038000, -832546800, -812588400, -798073200, -781052400, -772066800, -764805600,
+            -748476000, -733356000, -719445600, -717030000, -706748400, -699487200, -687996000, -668037600,
+            -654732000, -636588000, -622072800, -605743200, -590623200, -574293600, -558568800, -542239200,
+            -527119200, -512604000, -496274400, -481154400, -464220000, -449704800, -432165600, -417650400,
+            -401320800, -386200800, -369266400, -354751200, -337816800, -323301600, -306972000, -291852000,
+            -276732000, -257983200, -245282400, -226533600, -213228000, -195084000, -182383200, -163634400,
+            -150933600, -132184800, -119484000, -100735200, -88034400, -68680800, -59004000, -37242000,
+            57722400, 69818400, 89172000, 101268000, 120621600, 132717600, 152071200, 164167200,
+            183520800, 196221600, 214970400, 227671200, 246420000, 259120800, 278474400, 290570400,
+            309924000, 322020000, 341373600, 354675600, 372819600, 386125200, 404269200, 417574800,
+            435718800, 449024400, 467773200, 481078800, 499222800, 512528400, 530672400, 543978000,
+            562122000, 575427600, 593571600, 606877200, 625626000, 638326800, 657075600, 670381200,
+            688525200, 701830800, 719974800, 733280400, 751424400, 764730000, 782874000, 796179600,
+            814323600, 828234000, -2177452800LL, -1631926800, -1616889600, -1601168400, -1585353600, -1442451600,
+            -1427673600, -1379293200, -1364774400, -1348448400, -1333324800, -1316390400, -1301270400, -1284339600,
+            -1269820800, -1026954000, -1017619200, -1001898000, -999482400, -986090400, -954115200, -940208400,
+            -873079200, -862621200, -842839200, -828320400, -811389600, -796870800, -779940000, -765421200,
+            -748490400, -733971600, -652327200, -639018000, 135122400, 150246000, 166572000, 181695600,
+            196812000, 212540400, 228866400, 243990000, 260326800, 276051600, 291776400, 307501200,
+            323830800, 338950800, 354675600, 370400400, 386125200, 401850000, 417574800, 433299600,
+            449024400, 465354000, 481078800, 496803600, 512528400, 528253200, 543978000, 559702800,
+            575427600, 591152400, 606877200, 622602000, 638326800, 654656400, 670381200, 686106000,
+            701830800, 717555600, 733280400, 749005200, 764730000, 780454800, 796179600, 811904400,
+            828234000, -2840149817LL, -1688265017, -1656819079, -1641353479, -1627965079, -1618716679, -1596429079,
+            -1593820800, -1589860800, -1542427200, -1539493200, -1525323600, -1522728000, -1491188400, -1247536800,
+            354920400, 370728000, 386456400, 402264000, 417992400, 433800000, 449614800, 465346800,
+            481071600, 496796400, 512521200, 528246000, 543970800, 559695600, 575420400, 591145200,
+            606870000, 622594800, 638319600, 654649200, 670374000, 686102400, 695779200, 701823600,
+            717548400, 733273200, 748998000, 764722800, 780447600, 796172400, 811897200, 828226800,
+            846370800, 859676400, 877820400, 891126000, 909270000, 922575600, 941324400, 954025200,
+            972774000, 985474800, 1004223600, 1017529200, 1035673200, 1048978800, 1067122800, 1080428400,
+            1099177200, 1111878000, 1130626800, 1143327600, 1162076400, 1174777200, 1193526000, 1206831600,
+            1224975600, 1238281200, 1256425200, 1269730800, 1288479600, 1301180400, 1414274400, -2486592561LL,
+            -1855958961, -1689814800, -1680397200, -1665363600, -1648342800, -1635123600, -1616893200, -1604278800,
+            -1585443600, -1574038800, -1552266000, -1539997200, -1520557200, -1507510800, -1490576400, -1470618000,
+            -1459126800, -1444006800, -1427677200, -1411952400, -1396227600, -1379293200, -1364778000, -1348448400,
+            -1333328400, -1316394000, -1301274000, -1284339600, -1269824400, -1253494800, -1238374800, -1221440400,
+            -1206925200, -1191200400, -1175475600, -1160355600, -1143421200, -1127696400, -1111971600, -1096851600,
+            -1080522000, -1063587600, -1049072400, -1033347600, -1017622800, -1002502800, -986173200, -969238800,
+            -950490000, -942012000, -932436000, -857257200, -844556400, -828226800, -812502000, -800071200,
+            -796266000, -781052400, -766623600, 196819200, 212540400, 228877200, 243997200, 260326800,
+            276051600, 291776400, 307501200, 323830800, 338950800, 354675600, 370400400, 386125200,
+            401850000, 417574800, 433299600, 449024400, 465354000, 481078800, 496803600, 512528400,
+            528253200, 543978000, 559702800, 575427600, 591152400, 606877200, 622602000, 638326800,
+            654656400, 670381200, 686106000, 701830800, 717555600, 733280400, 749005200, 764730000,
+            780454800, 796179600, 811904400, 828234000, -3252098996LL, -2403565200LL, -1690765200, -1680487200,
+            -1664758800, -1648951200, -1635123600, -1616896800, -1604278800, -1585533600, -1571014800, -1555293600,
+            -932432400, -857257200, -844556400, -828226800, -812502000, -798073200, -781052400, -766717200,
+            -750898800, -733359600, -719456400, -701917200, -689209200, -670460400, -114051600, -103168800,
+            -81997200, -71715600, -50547600, -40266000, -18493200, -8211600, 12956400, 23238000,
+            43801200, 54687600, 75855600, 86742000, 107910000, 118191600, 138754800, 149641200,
+            170809200, 181090800, 202258800, 212540400, 233103600, 243990000, 265158000, 276044400,
+            296607600, 307494000, 323830800, 338950800, 354675600, 370400400, 386125200, 401850000,
+            417574800, 433299600, 449024400, 465354000, 481078800, 496803600, 512528400, 528253200,
+            543978000, 559702800, 575427600, 591152400, 606877200, 622602000, 638326800, 654656400,
+            670381200, 686106000, 701830800, 717555600, 733280400, 749005200, 764730000, 780454800,
+            796179600, 811904400, 828234000, -2871681132LL, -2208992414LL, -1692496800, -1680483600, 323830800,
+            338950800, 354675600, 370400400, 386125200, 401850000, 417574800, 433299600, 449024400,
+            465354000, 481078800, 496803600, 512528400, 528253200, 543978000, 559702800, 575427600,
+            591152400, 606877200, 622602000, 638326800, 654656400, 670381200, 686106000, 701830800,
+            717555600, 733280400, 749005200, 764730000, 780454800, 796179600, 811904400, 828234000,
+            -2840145840LL, -1717032240, -1693706400, -1680483600, -1663455600, -1650150000, -1632006000, -1618700400,
+            -1600473600, -1587168000, -1501725600, -931734000, -857257200, -844556400, -828226800, -812502000,
+            -796608000, -778726800, -762660000, -748486800, -733273200, -715215600, -701910000, -684975600,
+            -670460400, -654130800, -639010800, -397094400, -386812800, -371088000, -355363200, -334195200,
+            -323308800, -307584000, -291859200, -271296000, -260409600, -239846400, -228960000, -208396800,
+            -197510400, -176342400, -166060800, 228873600, 243993600, 260323200, 276048000, 291772800,
+            307497600, 323827200, 338947200, 354672000, 370396800, 386121600, 401846400, 417571200,
+            433296000, 449020800, 465350400, 481075200, 496800000, 512524800, 528249600, 543974400,
+            559699200, 575427600, 591152400, 606877200, 622602000, 638326800, 654656400, 670381200,
+            686106000, 701830800, 717555600, 733280400, 749005200, 764730000, 780454800, 796179600,
+            811904400, 828234000, -3675198848LL, -2385246586LL, -904435200, -891129600, -872985600, -859680000,
+            354675600, 370400400, 386125200, 401850000, 417574800, 433299600, 449024400, 465354000,
+            481078800, 496803600, 512528400, 528253200, 543978000, 559702800, 575427600, 591152400,
+            606877200, 622602000, 638326800, 654656400, 670381200, 686106000, 701830800, 717555600,
+            733280400, 749005200, 764730000, 780454800, 796179600, 811904400, 828234000, -3192435544LL,
+            -1330335000, -1320057000, -1300699800, -1287396000, -1269250200, -1255946400, -1237800600, -1224496800,
+            -1206351000, -1192442400, -1174901400, -1160992800, -1143451800, -1125914400, -1112607000, -1094464800,
+            -1081157400, -1063015200, -1049707800, -1031565600, -1018258200, -1000116000, -986808600, -968061600,
+            -955359000, -936612000, -923304600, -757425600, 152632800, 162309600, 183477600, 194968800,
+            215532000, 226418400, 246981600, 257868000, 278431200, 289317600, 309880800, 320767200,
+            341330400, 352216800, 372780000, 384271200, 404834400, 415720800, 436284000, 447170400,
+            467733600, 478620000, 499183200, 510069600, 530632800, 541519200, 562082400, 573573600,
+            594136800, 605023200, 623772000, 637682400, 655221600, 669132000, 686671200, 700581600,
+            718120800, 732636000, 749570400, 764085600, 781020000, 795535200, 812469600, 826984800,
+            844524000, 858434400, 875973600, 889884000, 907423200, 921938400, 938872800, 953388000,
+            970322400, 984837600, 1002376800, 1016287200, 1033826400, 1047736800, 1065276000, 1079791200,
+            1096725600, 1111240800, 1128175200, 1142690400, 1159624800, 1174140000, 1191074400, -2334101314LL,
+            -1157283000, -1155436200, -880198200, -769395600, -765376200, -712150200,
+        };
+        static constexpr std::uint16_t transitionTypes[] = {
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            5, 6, 5, 6, 5, 6, 5, 6,
+            5, 6, 5, 6, 5, 6, 5, 6,
+            5, 7, 5, 6, 5, 6, 5, 6,
+            5, 6, 5, 6, 5, 6, 5, 6,
+            5, 6, 5, 6, 5, 6, 5, 6,
+            5, 6, 5, 6, 5, 6, 5, 6,
+            5, 6, 5, 6, 5, 6, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 8, 7, 8,
+            7, 8, 7, 8, 7, 10, 11, 12,
+            11, 12, 11, 1, 14, 15, 16, 17,
+            18, 17, 19, 18, 21, 22, 23, 24,
+            22, 25, 26, 25, 26, 25, 26, 25,
+            26, 25, 26, 25, 26, 25, 26, 25,
+            26, 25, 26, 25, 26, 25, 26, 25,
+            26, 25, 26, 25, 26, 25, 26, 27,
+            28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29,
+            28, 29, 28, 29, 28, 29, 28, 29,
+            31, 32, 33, 32, 33, 32, 33, 32,
+            33, 32, 33, 32, 33, 32, 33, 32,
+            33, 32, 33, 32, 33, 32, 33, 32,
+            33, 32, 33, 32, 33, 32, 33, 32,
+            33, 32, 33, 32, 33, 32, 33, 32,
+            33, 32, 34, 35, 34, 35, 34, 35,
+            34, 35, 34, 35, 34, 35, 34, 33,
+            34, 35, 34, 35, 34, 34, 37, 38,
+            39, 38, 38, 41, 42, 41, 42, 41,
+            42, 41, 42, 41, 42, 41, 42, 41,
+            42, 41, 42, 41, 42, 41, 42, 41,
+            42, 41, 42, 41, 42, 41, 42, 41,
+            42, 41, 42, 41, 42, 41, 42, 41,
+            43, 41, 42, 41, 42, 41, 42, 41,
+            42, 41, 42, 41, 44, 45, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 47, 48, 47, 48, 47, 48,
+            47, 48, 47, 49, 50, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 47, 48, 47, 48, 47,
+            48, 47, 48, 52, 53, 52, 53, 52,
+            53, 52, 53, 52, 53, 52, 53, 52,
+            53, 52, 53, 52, 53, 52, 53, 52,
+            53, 52, 53, 52, 53, 52, 53, 52,
+            53, 52, 53, 52, 53, 52, 53, 52,
+            53, 52, 53, 52, 53, 52, 53, 52,
+            53, 52, 53, 52, 54, 55, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 52, 53, 52, 53, 52, 53,
+            52, 53, 57, 58, 57, 58, 57, 59,
+            60, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 47,
+            41, 47, 48, 47, 41, 42, 41, 42,
+            41, 44, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 42, 41, 42, 41, 42,
+            41, 42, 41, 43, 63, 43, 63, 43,
+            63, 43, 63, 43, 63, 43, 63, 43,
+            63, 43, 63, 43, 63, 43, 63, 43,
+            63, 43, 63, 43, 63, 43, 63, 43,
+            63, 43, 63, 43, 63, 43, 63, 43,
+            63, 43, 63, 43, 63, 43, 63, 43,
+            63, 43, 63, 43, 64, 65, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 47, 48, 47, 48, 47, 49,
+            47, 49, 47, 48, 47, 68, 38, 68,
+            32, 68, 39, 38, 39, 38, 39, 38,
+            39, 38, 39, 38, 32, 38, 32, 33,
+            39, 38, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 32, 33, 32, 33,
+            32, 33, 32, 33, 33, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            35, 34, 35, 34, 35, 34, 35, 34,
+            34, 71, 72, 71, 72, 71, 72, 71,
+            72, 71, 72, 71, 72, 71, 72, 71,
+            72, 71, 72, 71, 72, 71, 72, 71,
+            72, 71, 72, 71, 72, 71, 72, 71,
+            72, 71, 72, 71, 72, 71, 73, 74,
+            73, 74, 73, 74, 73, 74, 73, 74,
+            73, 74, 73, 74, 73, 75, 76, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 77, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 74, 73, 74, 73,
+            74, 73, 74, 73, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 64, 65, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            43, 63, 43, 63, 43, 63, 43, 63,
+            57, 58, 57, 59, 60, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 57, 58, 57, 58, 57, 58, 57,
+            58, 81, 82, 82, 84, 85, 86, 85,
+            87, 88, 87, 87, 90, 90, 92, 93,
+            94, 95, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 93, 92, 93, 92, 93,
+            92, 93, 92, 97, 98, 99, 100, 99,
+            101, 99, 102, 104, 105, 106, 105, 106,
+            105, 106, 105, 106, 105, 106, 105, 106,
+            105, 107, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 105,
+            106, 105, 106, 105, 106, 105, 106, 86,
+            109, 86, 110, 111, 112, 111, 112, 111,
+            112, 111, 86, 114, 114, 84, 116, 117,
+            109, 117, 109, 117, 119, 120, 121, 120,
+            121, 95, 121, 120, 121, 120, 121, 120,
+            121, 120, 123, 95, 124, 125, 124, 125,
+            124, 125, 124, 125, 124, 123, 126, 123,
+            126, 123, 126, 123, 126, 123, 126, 123,
+            126, 123, 124, 125, 124, 125, 124, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 131, 82, 132, 98,
+            99, 100, 99, 101, 101, 128, 95, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 129, 128, 129, 128,
+            129, 128, 129, 128, 129, 128, 135, 136,
+            137, 90, 138, 90, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 137, 136, 137,
+            136, 137, 136, 137, 136, 136, 95, 140,
+            95, 140, 95, 140, 95, 140, 95, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 8, 142, 8, 142, 8, 142,
+            8, 142, 1, 144, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 145, 146,
+            145, 146, 145, 146, 145, 146, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 151,
+            152, 151, 152, 151, 152, 151, 152, 151,
+            152, 151, 152, 151, 152, 151, 152, 151,
+            152, 151, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 148, 149, 148, 149,
+            148, 149, 148, 149, 155, 156, 155, 156,
+            155, 156, 155, 156, 155, 156, 155, 156,
+            155, 156, 155, 156, 155, 156, 155, 156,
+            155, 156, 155, 156, 155, 156, 155, 156,
+            155, 156, 155, 156, 155, 156, 155, 156,
+            155, 156, 155, 156, 155, 156, 155, 156,
+            157, 158, 157, 158, 157, 158, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 162, 2, 3,
+            2, 3, 159, 160, 159, 160, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 164, 159, 160, 159, 160, 159,
+            164, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            166, 167, 1, 168, 1, 168, 1, 168,
+            1, 168, 1, 168, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 1, 169,
+            1, 169, 1, 169, 1, 169, 170, 171,
+            170, 171, 170, 171, 170, 171, 170, 171,
+            170, 171, 170, 171, 170, 171, 170, 171,
+            170, 171, 170, 171, 170, 171, 170, 171,
+            170, 171, 170, 171, 170, 171, 170, 171,
+            170, 171, 170, 171, 170, 171, 170, 171,
+            170, 171, 170, 171, 170, 171, 170, 171,
+            170, 173, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            2, 3, 2, 3, 2, 3, 2, 3,
+            174, 175, 174, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 2, 3, 2, 3, 2,
+            3, 2, 3, 174, 174, 177, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 180, 179, 178, 179, 180, 179,
+            178, 179, 180, 179, 178, 179, 180, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 160, 178, 179, 178, 179, 178,
+            179, 178, 179, 178, 179, 178, 179, 178,
+            179, 178, 179, 178, 179, 178, 179, 178,
+            179, 178, 179, 178, 179, 178, 179, 178,
+            179, 178, 179, 160, 159, 160, 159, 160,
+            159, 160, 179, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 181, 168, 181,
+            168, 181, 168, 181, 168, 181, 168, 1,
+            168, 1, 168, 181, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 1,
+            168, 1, 168, 1, 168, 1, 168, 182,
+            1, 168, 1, 168, 1, 168, 1, 168,
+            1, 168, 1, 168, 1, 168, 1, 168,
+            1, 168, 1, 168, 1, 168, 1, 168,
+            1, 168, 1, 168, 1, 168, 1, 168,
+            1, 168, 1, 168, 1, 168, 1, 168,
+            1, 168, 1, 168, 1, 168, 1, 168,
+            1, 168, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 180, 179, 178, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 185, 186, 187, 186, 188, 187, 188,
+            189, 190, 189, 138, 189, 190, 2, 190,
+            189, 190, 189, 190, 189, 190, 189, 190,
+            189, 190, 189, 190, 189, 190, 189, 190,
+            189, 190, 189, 190, 3, 2, 190, 189,
+            190, 189, 190, 189, 190, 189, 190, 189,
+            190, 189, 190, 189, 190, 189, 190, 189,
+            190, 189, 190, 189, 190, 189, 190, 189,
+            190, 189, 190, 189, 190, 189, 190, 189,
+            190, 189, 190, 189, 190, 191, 190, 193,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 178, 179, 178, 179, 178, 179,
+            178, 179, 159, 160, 159, 160, 159, 180,
+            179, 180, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 195, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 197, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            199, 160, 159, 160, 159, 160, 159, 2,
+            3, 2, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 160, 159, 160, 159, 160, 159,
+            160, 159, 201, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 160,
+            159, 160, 159, 160, 159, 160, 159, 203,
+            204, 203, 205, 203, 205, 203, 205, 203,
+            205, 203, 205, 203, 205, 203, 205, 203,
+            205, 203, 205, 203, 205, 203, 205, 203,
+            205, 203, 205, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 206,
+            207, 206, 207, 206, 207, 206, 207, 209,
+            210, 209, 211, 212, 209, 213,
+        };
+        static constexpr TimeZoneDatabase::Zone zones[] = {
+            { 2018, 2035, 4007, 96, 208 }, { 317, 348, 424, 62, 36 }, { 1287, 1258, 2341, 41, 134 }, { 1394, 1413, 2531, 83, 147 }, { 1053, 1068, 2139, 100, 108 }, { 1491, 1507, 2631, 19, 153 }, { 1938, 1602, 3764, 87, 196 }, { 1454, 1473, 2614, 17, 150 },
+            { 871, 884, 2049, 3, 83 }, { 912, 923, 2052, 8, 89 }, { 637, 654, 1123, 175, 66 }, { 1344, 1355, 2454, 9, 141 }, { 1748, 1764, 3089, 116, 176 }, { 833, 654, 1748, 172, 79 }, { 1264, 1279, 2332, 9, 133 }, { 1201, 1213, 2260, 14, 122 },
+            { 201, 216, 335, 5, 20 }, { 1514, 1531, 2650, 82, 154 }, { 1699, 1713, 2944, 145, 172 }, { 1831, 1845, 3347, 159, 183 }, { 2113, 577, 930, 125, 61 }, { 17, 25, 0, 0, 1 }, { 1108, 1121, 2239, 11, 113 }, { 972, 987, 2062, 69, 96 },
+            { 1975, 1602, 3888, 82, 200 }, { 1165, 1178, 2253, 7, 118 }, { 0, 4, 0, 0, 0 }, { 1921, 1602, 3663, 101, 194 }, { 1989, 1602, 3970, 37, 202 }, { 43, 56, 0, 128, 4 }, { 9, 4, 0, 0, 0 }, { 460, 475, 666, 97, 51 },
+            { 1365, 25, 2463, 68, 143 }, { 363, 378, 486, 5, 40 }, { 790, 807, 1561, 187, 78 }, { 1954, 1602, 3851, 37, 198 }, { 935, 946, 2060, 2, 91 }, { 129, 149, 325, 6, 13 }, { 1786, 1800, 3205, 142, 177 }, { 751, 348, 1469, 92, 70 },
+            { 1187, 1178, 2253, 7, 118 }, { 600, 620, 1055, 68, 62 }, { 1897, 1911, 3585, 78, 192 }, { 1677, 1602, 2884, 60, 165 }, { 557, 577, 930, 125, 61 }, { 1017, 1030, 2131, 8, 103 }, { 1629, 1643, 2829, 55, 163 }, { 677, 693, 1298, 11, 67 },
+            { 1244, 1258, 2303, 29, 130 }, { 1870, 1602, 3506, 79, 184 }, { 1315, 1327, 2382, 72, 139 }, { 2102, 654, 1123, 175, 66 }, { 258, 276, 340, 84, 30 }, { 98, 116, 128, 197, 9 }, { 1227, 1238, 2274, 29, 127 }, { 702, 719, 1309, 160, 69 },
+            { 166, 179, 331, 4, 14 }, { 1133, 1148, 2250, 3, 115 }, { 1585, 1602, 2732, 97, 161 }, { 502, 518, 763, 167, 56 }, { 405, 421, 491, 175, 46 }, { 849, 577, 1920, 129, 80 }, { 2079, 2096, 4103, 7, 214 },
+        };
+        static constexpr std::uint16_t displacements[] = {
+            3, 231, 3101, 2, 34, 2, 5, 2,
+            1, 37, 3, 64, 905, 1148, 11, 396,
+        };
+    };
+
+    template <typename T>
+    constexpr char Tables<T>::characters[];
+    template <typename T>
+    constexpr TimeZoneDatabase::Type Tables<T>::types[];
+    template <typename T>
+    constexpr std::int64_t Tables<T>::times[];
+    template <typename T>
+    constexpr std::uint16_t Tables<T>::transitionTypes[];
+    template <typename T>
+    constexpr TimeZoneDatabase::Zone Tables<T>::zones[];
+    template <typename T>
+    constexpr std::uint16_t Tables<T>::displacements[];
+
+    /**
+     * Returns the database of the time zones "UTC", "Etc/UTC", "Etc/GMT", "Africa/Cairo", "Africa/Casablanca", "Africa/Johannesburg", "Africa/Lagos", "Africa/Nairobi", "America/Anchorage", "America/Argentina/Buenos_Aires", "America/Bogota", "America/Chicago", "America/Denver", "America/Halifax", "America/Los_Angeles", "America/Mexico_City", "America/New_York", "America/Phoenix", "America/Santiago", "America/Sao_Paulo", "America/St_Johns", "America/Toronto", "America/Vancouver", "Asia/Bangkok", "Asia/Dhaka", "Asia/Dubai", "Asia/Hong_Kong", "Asia/Jakarta", "Asia/Jerusalem", "Asia/Karachi", "Asia/Kathmandu", "Asia/Kolkata", "Asia/Calcutta", "Asia/Manila", "Asia/Seoul", "Asia/Shanghai", "Asia/Singapore", "Asia/Taipei", "Asia/Tehran", "Asia/Tokyo", "Atlantic/Reykjavik", "Australia/Adelaide", "Australia/Brisbane", "Australia/Perth", "Australia/Sydney", "Europe/Amsterdam", "Europe/Athens", "Europe/Berlin", "Europe/Dublin", "Europe/Istanbul", "Europe/Lisbon", "Europe/London", "Europe/Madrid", "Europe/Moscow", "Europe/Paris", "Europe/Rome", "Europe/Stockholm", "Europe/Warsaw", "Europe/Zurich", "Pacific/Auckland", "Pacific/Honolulu", "US/Eastern", and "US/Pacific", from the version 2025b of the IANA time zone database.
+     * @see TimeZone::fromDatabase()
+     */
+    inline const TimeZoneDatabase& database()
+    {
+        static constexpr TimeZoneDatabase value = { "2025b", Tables<>::characters, Tables<>::types, Tables<>::times, Tables<>::transitionTypes, Tables<>::zones, 63, Tables<>::displacements, 16 };
+        return value;
+    }
+
+} // namespace tzdb
+
+} // namespace xclox
+
+#endif // XCLOX_TZDB_HPP
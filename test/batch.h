@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/batch.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+TEST_SUITE("BatchParser")
+{
+    TEST_CASE("constructible")
+    {
+        SUBCASE("default")
+        {
+            CHECK(BatchParser().format().toString() == "yyyy-MM-dd hh:mm:ss");
+        }
+        SUBCASE("format string")
+        {
+            CHECK(BatchParser("yyyy-MM-dd").format().toString() == "yyyy-MM-dd");
+        }
+        SUBCASE("precompiled format")
+        {
+            CHECK(BatchParser(Format("hh:mm")).format().toString() == "hh:mm");
+        }
+    }
+
+    TEST_CASE("parsing")
+    {
+        auto parse = [](const std::string& format, const std::vector<std::string>& inputs, std::vector<std::int64_t>& nanoseconds, std::vector<std::uint8_t>& validity) {
+            nanoseconds.assign(inputs.size(), -1);
+            validity.assign((inputs.size() + 7) / 8, 0xFF);
+            return BatchParser(format).parse(inputs.data(), inputs.size(), nanoseconds.data(), validity.data());
+        };
+        std::vector<std::int64_t> nanoseconds;
+        std::vector<std::uint8_t> validity;
+
+        SUBCASE("strings")
+        {
+            CHECK(parse("yyyy-MM-dd hh:mm:ss", { "1970-01-01 00:00:00", "2024-02-18 21:46:07", "bad", "1969-12-31 23:59:59" }, nanoseconds, validity) == 3);
+            CHECK(nanoseconds == std::vector<std::int64_t> { 0, 1708292767000000000, 0, -1000000000 });
+            CHECK(validity == std::vector<std::uint8_t> { 0x0B });
+        }
+        SUBCASE("buffer and offsets")
+        {
+            const std::string data = "2024-02-18T21:46:07.9872024-02-18T21:46:071970-01-01T00:00:00.000";
+            const std::int32_t offsets[] = { 0, 23, 42, 42, 65 };
+            std::int64_t values[4];
+            std::uint8_t bitmap[1];
+            CHECK(BatchParser("yyyy-MM-ddThh:mm:ss.fff").parse(data.data(), offsets, 4, values, bitmap) == 2);
+            CHECK(values[0] == 1708292767987000000);
+            CHECK(values[1] == 0);
+            CHECK(values[2] == 0);
+            CHECK(values[3] == 0);
+            CHECK(bitmap[0] == 0x09);
+        }
+        SUBCASE("validity bitmap spans multiple bytes")
+        {
+            std::vector<std::string> inputs(19, "2024-02-18");
+            inputs[3] = inputs[10] = inputs[18] = "2024-02-30";
+            CHECK(parse("yyyy-MM-dd", inputs, nanoseconds, validity) == 16);
+            CHECK(validity == std::vector<std::uint8_t> { 0xF7, 0xFB, 0x03 });
+        }
+        SUBCASE("empty batch")
+        {
+            CHECK(parse("yyyy-MM-dd", {}, nanoseconds, validity) == 0);
+        }
+        SUBCASE("same as DateTime::fromString")
+        {
+            const std::vector<std::string> formats = { "yyyy-MM-dd hh:mm:ss", "yyyy-MM-ddThh:mm:ss.fffffffff", "yyyy-MM-ddThh:mm:ss.f", "dd/MM/yyyy", "yyyy MMM d, H:mm a", "#yyyyMMdd" };
+            const std::vector<std::string> inputs = {
+                "2024-02-18 21:46:07", "2024-02-18T21:46:07", "2024-02-18T21:46:07.987654321", "2024-02-18T21:46:07.9", "2024-02-18 21:60:07", "2024-02-18 24:00:00",
+                "18/02/2024", "2024 Feb 18, 9:46 pm", "2024 feb 18, 12:00 am", "+20240218", "-00010101", "2262-04-11 23:47:16", "2262-04-11 23:47:17", "1677-09-21 00:12:44", "1677-09-21 00:12:43",
+                "", "2024", "0000-01-01 00:00:00"
+            };
+            for (const auto& format : formats) {
+                parse(format, inputs, nanoseconds, validity);
+                for (size_t i = 0; i < inputs.size(); ++i) {
+                    const auto& dt = DateTime::fromString(inputs[i], format);
+                    const bool isValid = (validity[i / 8] >> (i % 8) & 1) != 0;
+                    const auto& min = DateTime(Date(1677, 9, 21), Time(0, 12, 43, Time::Nanoseconds(145224192)));
+                    const auto& max = DateTime(Date(2262, 4, 11), Time(23, 47, 16, Time::Nanoseconds(854775807)));
+                    const bool isInRange = (dt.date() > min.date() || (dt.date() == min.date() && dt.time() >= min.time())) && (dt.date() < max.date() || (dt.date() == max.date() && dt.time() <= max.time()));
+                    CHECK(isValid == (dt.isValid() && isInRange));
+                    CHECK(nanoseconds[i] == (isValid ? dt.toNanosecondsSinceEpoch() : 0));
+                }
+            }
+        }
+    }
+} // TEST_SUITE
+
+TEST_SUITE("BatchFormatter")
+{
+    TEST_CASE("constructible")
+    {
+        SUBCASE("default")
+        {
+            CHECK(BatchFormatter().format().toString() == "yyyy-MM-dd hh:mm:ss");
+            CHECK(BatchFormatter().maxSize() == 19);
+        }
+        SUBCASE("format string")
+        {
+            CHECK(BatchFormatter("dddd, d MMMM y").format().toString() == "dddd, d MMMM y");
+            CHECK(BatchFormatter("dddd, d MMMM y").maxSize() == 28);
+        }
+        SUBCASE("precompiled format")
+        {
+            CHECK(BatchFormatter(Format("hh:mm")).format().toString() == "hh:mm");
+        }
+    }
+
+    TEST_CASE("formatting")
+    {
+        const std::vector<std::int64_t> nanoseconds = { 0, 1708292767987654321, 1708292767000000000, 1708300000000000000, -1, -86400000000000, -1000000000000000000, std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::max() };
+
+        SUBCASE("buffer and offsets")
+        {
+            std::string data;
+            std::vector<std::int32_t> offsets(4);
+            CHECK(BatchFormatter("yyyy-MM-ddThh:mm:ss.fff").format(nanoseconds.data(), 3, data, offsets.data()) == 69);
+            CHECK(data == "1970-01-01T00:00:00.0002024-02-18T21:46:07.9872024-02-18T21:46:07.000");
+            CHECK(offsets == std::vector<std::int32_t> { 0, 23, 46, 69 });
+        }
+        SUBCASE("appending")
+        {
+            std::string data = "abc";
+            std::int64_t offsets[3];
+            CHECK(BatchFormatter("yyyy").format(nanoseconds.data(), 2, data, offsets) == 8);
+            CHECK(data == "abc19702024");
+            CHECK(offsets[0] == 3);
+            CHECK(offsets[1] == 7);
+            CHECK(offsets[2] == 11);
+        }
+        SUBCASE("null values")
+        {
+            std::string data;
+            std::int32_t offsets[5];
+            const std::uint8_t validity[] = { 0x0A };
+            CHECK(BatchFormatter("yyyy").format(nanoseconds.data(), 4, data, offsets, validity) == 8);
+            CHECK(data == "20242024");
+            CHECK(offsets[0] == 0);
+            CHECK(offsets[1] == 0);
+            CHECK(offsets[2] == 4);
+            CHECK(offsets[3] == 4);
+            CHECK(offsets[4] == 8);
+        }
+        SUBCASE("empty batch")
+        {
+            std::string data;
+            std::int32_t offsets[1] = { -1 };
+            CHECK(BatchFormatter().format(nanoseconds.data(), 0, data, offsets) == 0);
+            CHECK(offsets[0] == 0);
+        }
+        SUBCASE("same as DateTime::toString")
+        {
+            for (const auto& format : { "yyyy-MM-dd hh:mm:ss", "yyyy-MM-ddThh:mm:ss.fffffffff", "dddd, d MMMM y, H:mm:ss.f A", "ddd MMM yy #E", "literal text" }) {
+                std::string data;
+                std::vector<std::int32_t> offsets(nanoseconds.size() + 1);
+                BatchFormatter(format).format(nanoseconds.data(), nanoseconds.size(), data, offsets.data());
+                for (size_t i = 0; i < nanoseconds.size(); ++i) {
+                    const auto& expected = DateTime(std::chrono::nanoseconds(nanoseconds[i])).toString(format);
+                    CHECK(data.substr(static_cast<size_t>(offsets[i]), static_cast<size_t>(offsets[i + 1] - offsets[i])) == expected);
+                    CHECK(static_cast<size_t>(offsets[i + 1] - offsets[i]) <= BatchFormatter(format).maxSize());
+                }
+            }
+        }
+    }
+} // TEST_SUITE
+
+TEST_SUITE("BatchBucketer")
+{
+    // Values from 1678 to 2261, about 2.3 days apart, in an order far from sorted, along with a sorted run.
+    std::vector<std::int64_t> getValues()
+    {
+        std::vector<std::int64_t> values;
+        for (std::int64_t i = -92000; i < 92000; ++i)
+            values.push_back(i * 99999999999937LL * (i % 2 == 0 ? 1 : -1));
+        for (std::int64_t i = 0; i < 1000; ++i)
+            values.push_back(1700000000000000000LL + i * 7000000000LL);
+        return values;
+    }
+
+    void checkBuckets(const BatchBucketer& bucketer, const std::function<DateTime(const DateTime&)>& floor)
+    {
+        const std::vector<std::int64_t> values = getValues();
+        std::vector<std::int64_t> ids(values.size());
+        bucketer.bucket(values.data(), values.size(), ids.data());
+        size_t mismatches = 0;
+        for (size_t i = 0; i < values.size(); ++i) {
+            const std::int64_t expected = CompactDateTime(floor(CompactDateTime(CompactDateTime::Nanoseconds(values[i])).toDateTime())).toNanosecondsSinceEpoch();
+            mismatches += bucketer.start(ids[i]) != expected || bucketer.start(ids[i] + 1) <= values[i] || bucketer.bucket(values[i]) != ids[i];
+        }
+        CHECK(mismatches == 0);
+    }
+
+    TEST_CASE("fixed widths")
+    {
+        CHECK(BatchBucketer(std::chrono::minutes(5)).bucket(0) == 0);
+        CHECK(BatchBucketer(std::chrono::minutes(5)).bucket(-1) == -1);
+        CHECK(BatchBucketer(std::chrono::minutes(5)).bucket(300000000000) == 1);
+        CHECK(BatchBucketer(std::chrono::minutes(5), std::chrono::minutes(1)).bucket(300000000000) == 0);
+        CHECK(BatchBucketer(std::chrono::minutes(5), std::chrono::minutes(1)).start(1) == 360000000000);
+        CHECK(BatchBucketer(std::chrono::nanoseconds(0)).bucket(42) == 42);
+        checkBuckets(BatchBucketer(std::chrono::minutes(5)), [](const DateTime& dt) { return dt.floor(std::chrono::minutes(5)); });
+        checkBuckets(BatchBucketer(std::chrono::hours(7)), [](const DateTime& dt) { return dt.floor(std::chrono::hours(7)); });
+        checkBuckets(BatchBucketer(std::chrono::hours(24 * 30)), [](const DateTime& dt) { return dt.floor(std::chrono::hours(24 * 30)); });
+    }
+
+    TEST_CASE("calendar units")
+    {
+        const BatchBucketer weeks(DateTime::CalendarUnit::Week);
+        CHECK(weeks.bucket(0) == 0);
+        CHECK(weeks.start(0) == -3 * 86400000000000LL);
+        CHECK(weeks.bucket(4 * 86400000000000LL) == 1);
+        const BatchBucketer months(DateTime::CalendarUnit::Month);
+        CHECK(months.bucket(-1) == -1);
+        CHECK(months.start(-1) == -31 * 86400000000000LL);
+        CHECK(months.bucket(CompactDateTime(DateTime(Date(2024, 8, 15))).toNanosecondsSinceEpoch()) == 54 * 12 + 7);
+        CHECK(BatchBucketer(DateTime::CalendarUnit::Quarter).bucket(CompactDateTime(DateTime(Date(2024, 8, 15))).toNanosecondsSinceEpoch()) == 54 * 4 + 2);
+        CHECK(BatchBucketer(DateTime::CalendarUnit::Year).bucket(-1) == -1);
+        for (const auto unit : { DateTime::CalendarUnit::Week, DateTime::CalendarUnit::Month, DateTime::CalendarUnit::Quarter, DateTime::CalendarUnit::Year })
+            checkBuckets(BatchBucketer(unit), [unit](const DateTime& dt) { return dt.floor(unit); });
+    }
+} // TEST_SUITE
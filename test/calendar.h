@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/calendar.hpp"
+
+#include <algorithm>
+#include <vector>
+
+using namespace xclox;
+
+namespace {
+
+// The business days of a calendar, found by stepping one day at a time.
+struct SteppingCalendar {
+    Date first;
+    Date last;
+    std::vector<Date> holidays;
+    std::vector<int> weekend;
+
+    bool isBusinessDay(const Date& date) const
+    {
+        if (std::find(weekend.begin(), weekend.end(), date.dayOfWeek()) != weekend.end())
+            return false;
+        return date < first || !(date < last) || std::find(holidays.begin(), holidays.end(), date) == holidays.end();
+    }
+
+    long businessDaysBetween(const Date& from, const Date& to) const
+    {
+        long count = 0;
+        for (Date date = from; date < to; date = date.addDays(1))
+            count += isBusinessDay(date);
+        for (Date date = to; date < from; date = date.addDays(1))
+            count -= isBusinessDay(date);
+        return count;
+    }
+
+    Date addBusinessDays(Date date, int days) const
+    {
+        for (; days > 0; --days) {
+            date = date.addDays(1);
+            while (!isBusinessDay(date))
+                date = date.addDays(1);
+        }
+        for (; days < 0; ++days) {
+            date = date.addDays(-1);
+            while (!isBusinessDay(date))
+                date = date.addDays(-1);
+        }
+        return date;
+    }
+};
+
+} // namespace
+
+TEST_SUITE("BusinessCalendar")
+{
+    const std::vector<Date> holidays2024 = { Date(2024, 1, 1), Date(2024, 3, 29), Date(2024, 4, 1), Date(2024, 5, 1), Date(2024, 12, 25), Date(2024, 12, 26) };
+
+    TEST_CASE("default")
+    {
+        const BusinessCalendar calendar;
+        CHECK_FALSE(calendar.first().isValid());
+        CHECK_FALSE(calendar.last().isValid());
+        CHECK(calendar.isWeekend(Date::Weekday::Saturday));
+        CHECK(calendar.isWeekend(Date::Weekday::Sunday));
+        CHECK_FALSE(calendar.isWeekend(Date::Weekday::Monday));
+        CHECK(calendar.isBusinessDay(Date(2024, 5, 3)));
+        CHECK_FALSE(calendar.isBusinessDay(Date(2024, 5, 4)));
+        CHECK_FALSE(calendar.isBusinessDay(Date()));
+        CHECK(calendar.businessDaysBetween(Date(2024, 5, 3), Date(2024, 5, 7)) == 2);
+        CHECK(calendar.businessDaysBetween(Date(2024, 5, 7), Date(2024, 5, 3)) == -2);
+        CHECK(calendar.businessDaysBetween(Date(1970, 1, 1), Date(2024, 1, 1)) == 14087);
+        CHECK(calendar.addBusinessDays(Date(2024, 5, 3), 1) == Date(2024, 5, 6));
+        CHECK(calendar.addBusinessDays(Date(2024, 5, 4), -1) == Date(2024, 5, 3));
+        CHECK(calendar.addBusinessDays(Date(2024, 5, 4), 0) == Date(2024, 5, 4));
+        CHECK(calendar.addBusinessDays(Date(1970, 1, 1), 14087) == Date(2024, 1, 1));
+        CHECK(calendar.addBusinessDays(Date(-1, 12, 29), 1) == Date(1, 1, 1));
+        CHECK(calendar.subtractBusinessDays(Date(2024, 5, 6), 1) == Date(2024, 5, 3));
+        CHECK_FALSE(calendar.addBusinessDays(Date(), 1).isValid());
+    }
+
+    TEST_CASE("window")
+    {
+        const BusinessCalendar calendar(Date(2024, 1, 1), Date(2025, 1, 1), holidays2024);
+        CHECK(calendar.first() == Date(2024, 1, 1));
+        CHECK(calendar.last() == Date(2025, 1, 1));
+        CHECK_FALSE(BusinessCalendar(Date(2024, 1, 1), Date(2024, 1, 1), holidays2024).first().isValid());
+        CHECK_FALSE(BusinessCalendar(Date(2025, 1, 1), Date(2024, 1, 1), holidays2024).first().isValid());
+        CHECK_FALSE(BusinessCalendar(Date(), Date(2024, 1, 1), holidays2024).first().isValid());
+        CHECK(BusinessCalendar(Date(2024, 6, 1), Date(2025, 1, 1), holidays2024).isBusinessDay(Date(2024, 5, 1)));
+    }
+
+    TEST_CASE("holidays")
+    {
+        const BusinessCalendar calendar(Date(2024, 1, 1), Date(2025, 1, 1), holidays2024);
+        CHECK_FALSE(calendar.isBusinessDay(Date(2024, 1, 1)));
+        CHECK(calendar.isBusinessDay(Date(2024, 1, 2)));
+        CHECK_FALSE(calendar.isBusinessDay(Date(2024, 3, 30)));
+        CHECK(calendar.isBusinessDay(Date(2025, 1, 1)));
+        CHECK(calendar.addBusinessDays(Date(2024, 3, 28), 1) == Date(2024, 4, 2));
+        CHECK(calendar.addBusinessDays(Date(2024, 4, 2), -1) == Date(2024, 3, 28));
+        CHECK(calendar.addBusinessDays(Date(2024, 12, 24), 1) == Date(2024, 12, 27));
+        CHECK(calendar.addBusinessDays(Date(2024, 12, 31), 1) == Date(2025, 1, 1));
+        CHECK(calendar.addBusinessDays(Date(2023, 12, 29), 1) == Date(2024, 1, 2));
+        CHECK(calendar.addBusinessDays(Date(2024, 1, 2), -1) == Date(2023, 12, 29));
+        CHECK(calendar.businessDaysBetween(Date(2024, 1, 1), Date(2025, 1, 1)) == 256);
+        CHECK(calendar.businessDaysBetween(Date(2024, 12, 23), Date(2024, 12, 30)) == 3);
+    }
+
+    TEST_CASE("weekend")
+    {
+        const BusinessCalendar calendar(Date(2024, 1, 1), Date(2025, 1, 1), {}, { Date::Weekday::Friday, Date::Weekday::Saturday });
+        CHECK(calendar.isBusinessDay(Date(2024, 5, 5)));
+        CHECK_FALSE(calendar.isBusinessDay(Date(2024, 5, 3)));
+        CHECK(calendar.addBusinessDays(Date(2024, 5, 2), 1) == Date(2024, 5, 5));
+        CHECK(calendar.addBusinessDays(Date(2030, 5, 2), 1) == Date(2030, 5, 5));
+
+        const BusinessCalendar closed(Date(2024, 1, 1), Date(2025, 1, 1), {}, { Date::Weekday::Monday, Date::Weekday::Tuesday, Date::Weekday::Wednesday, Date::Weekday::Thursday, Date::Weekday::Friday, Date::Weekday::Saturday, Date::Weekday::Sunday });
+        CHECK_FALSE(closed.isBusinessDay(Date(2024, 5, 2)));
+        CHECK(closed.businessDaysBetween(Date(2000, 1, 1), Date(2030, 1, 1)) == 0);
+        CHECK_FALSE(closed.addBusinessDays(Date(2024, 5, 2), 1).isValid());
+        CHECK_FALSE(closed.addBusinessDays(Date(2024, 5, 2), -1).isValid());
+    }
+
+    TEST_CASE("set operations")
+    {
+        const BusinessCalendar a(Date(2024, 1, 1), Date(2024, 7, 1), { Date(2024, 1, 1), Date(2024, 5, 1) });
+        const BusinessCalendar b(Date(2024, 4, 1), Date(2025, 1, 1), { Date(2024, 5, 1), Date(2024, 5, 9), Date(2024, 12, 25) }, { Date::Weekday::Friday, Date::Weekday::Saturday });
+        const BusinessCalendar either = a | b;
+        const BusinessCalendar both = a & b;
+        CHECK(either.first() == Date(2024, 1, 1));
+        CHECK(either.last() == Date(2025, 1, 1));
+        CHECK(either.isWeekend(Date::Weekday::Friday));
+        CHECK(either.isWeekend(Date::Weekday::Sunday));
+        CHECK(both.isWeekend(Date::Weekday::Saturday));
+        CHECK_FALSE(both.isWeekend(Date::Weekday::Sunday));
+        for (Date date(2023, 6, 1); date < Date(2025, 6, 1); date = date.addDays(1)) {
+            CHECK(either.isBusinessDay(date) == (a.isBusinessDay(date) && b.isBusinessDay(date)));
+            CHECK(both.isBusinessDay(date) == (a.isBusinessDay(date) || b.isBusinessDay(date)));
+        }
+        CHECK((BusinessCalendar() | BusinessCalendar()).isBusinessDay(Date(2024, 5, 3)));
+        CHECK((BusinessCalendar() | a).first() == Date(2024, 1, 1));
+    }
+
+    TEST_CASE("stepping")
+    {
+        std::vector<Date> holidays;
+        for (long seed = 12345, i = 0; i < 60; ++i) {
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+            holidays.push_back(Date(2019, 12, 1).addDays(static_cast<int>(seed % 800)));
+        }
+        const SteppingCalendar expected = { Date(2020, 1, 1), Date(2022, 1, 1), holidays, { 6, 7 } };
+        const BusinessCalendar calendar(expected.first, expected.last, holidays);
+        const Date origin(2019, 11, 1);
+        for (Date date(2019, 10, 1); date < Date(2022, 3, 1); date = date.addDays(1)) {
+            CHECK(calendar.isBusinessDay(date) == expected.isBusinessDay(date));
+            CHECK(calendar.businessDaysBetween(origin, date) == expected.businessDaysBetween(origin, date));
+            for (int days : { 1, 3, 10, 70, -1, -4, -25, -130 })
+                CHECK(calendar.addBusinessDays(date, days) == expected.addBusinessDays(date, days));
+        }
+    }
+}
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/column.hpp"
+
+#include <vector>
+
+using namespace xclox;
+
+TEST_SUITE("DateTimeColumn")
+{
+    TEST_CASE("constructible")
+    {
+        SUBCASE("default")
+        {
+            CHECK(DateTimeColumn().empty());
+            CHECK(DateTimeColumn().size() == 0);
+            CHECK(DateTimeColumn().data() == nullptr);
+        }
+        SUBCASE("nanoseconds")
+        {
+            const DateTimeColumn column(std::vector<std::int64_t> { 0, 1708292767987000000, -1 });
+            CHECK(column.size() == 3);
+            CHECK(column.nullCount() == 0);
+            CHECK(column[1] == 1708292767987000000);
+            CHECK(column.at(2).toDateTime() == DateTime(Date(1969, 12, 31), Time(23, 59, 59, CompactDateTime::Nanoseconds(999999999))));
+        }
+        SUBCASE("nanoseconds and validity")
+        {
+            const DateTimeColumn column(std::vector<std::int64_t> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, { 0xF7, 0x02 });
+            CHECK(column.nullCount() == 2);
+            CHECK(column.isNull(3));
+            CHECK(column.isNull(8));
+            CHECK_FALSE(column.isNull(9));
+            CHECK(column.at(3).isValid() == false);
+            CHECK(column.at(9) == CompactDateTime(CompactDateTime::Nanoseconds(9)));
+        }
+        SUBCASE("datetimes")
+        {
+            const DateTimeColumn column(std::vector<DateTime> { DateTime(Date(2024, 2, 18)), DateTime(), DateTime(Date(3000, 1, 1)) });
+            CHECK(column.size() == 3);
+            CHECK(column.nullCount() == 2);
+            CHECK(column.at(0).toDateTime() == DateTime(Date(2024, 2, 18)));
+        }
+        SUBCASE("copies share the values")
+        {
+            const DateTimeColumn column(std::vector<std::int64_t> { 1, 2, 3 });
+            const DateTimeColumn copy(column);
+            CHECK(copy.data() == column.data());
+        }
+    }
+
+    TEST_CASE("slicing")
+    {
+        const DateTimeColumn column(std::vector<std::int64_t> { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9 }, { 0xF7, 0x02 });
+        SUBCASE("zero-copy")
+        {
+            const DateTimeColumn slice = column.slice(2, 5);
+            CHECK(slice.size() == 5);
+            CHECK(slice.data() == column.data() + 2);
+            CHECK(slice[0] == 2);
+            CHECK(slice.isNull(1));
+            CHECK(slice.nullCount() == 1);
+        }
+        SUBCASE("slice of slice")
+        {
+            const DateTimeColumn slice = column.slice(3, 7).slice(5, 2);
+            CHECK(slice.size() == 2);
+            CHECK(slice[0] == 8);
+            CHECK(slice.isNull(0));
+            CHECK_FALSE(slice.isNull(1));
+        }
+        SUBCASE("out of range")
+        {
+            CHECK(column.slice(8, 5).size() == 2);
+            CHECK(column.slice(12, 5).empty());
+        }
+    }
+
+    TEST_CASE("field extraction")
+    {
+        SUBCASE("nulls yield zero")
+        {
+            const DateTimeColumn column(std::vector<std::int64_t> { 1708292767987654321, 1708292767987654321 }, { 0x01 });
+            std::vector<int> years(2, -1), hours(2, -1);
+            std::vector<long> nanoseconds(2, -1);
+            column.getYears(years.data());
+            column.getHours(hours.data());
+            column.getNanoseconds(nanoseconds.data());
+            CHECK(years == std::vector<int> { 2024, 0 });
+            CHECK(hours == std::vector<int> { 21, 0 });
+            CHECK(nanoseconds == std::vector<long> { 987654321, 0 });
+        }
+        SUBCASE("null pointers are ignored")
+        {
+            const DateTimeColumn column(std::vector<std::int64_t> { 1708292767987654321 });
+            int month = 0;
+            column.getYearMonthDay(nullptr, &month, nullptr);
+            CHECK(month == 2);
+        }
+        SUBCASE("same fields as DateTime")
+        {
+            // More than one block of values, spanning the whole range, with a slice that starts within a block.
+            std::vector<std::int64_t> values;
+            for (int i = 0; i < 2000; ++i)
+                values.push_back((i - 1000) * 9223372036854775LL + i * 7919LL);
+            const DateTimeColumn column = DateTimeColumn(values).slice(3, 1997);
+            const size_t size = column.size();
+            std::vector<int> years(size), months(size), days(size), hours(size), minutes(size), seconds(size), milliseconds(size), daysOfWeek(size), daysOfYear(size);
+            std::vector<long> microseconds(size), nanoseconds(size), daysSinceEpoch(size);
+            column.getYearMonthDay(years.data(), months.data(), days.data());
+            column.getHours(hours.data());
+            column.getMinutes(minutes.data());
+            column.getSeconds(seconds.data());
+            column.getMilliseconds(milliseconds.data());
+            column.getMicroseconds(microseconds.data());
+            column.getNanoseconds(nanoseconds.data());
+            column.getDaysOfWeek(daysOfWeek.data());
+            column.getDaysOfYear(daysOfYear.data());
+            column.getDaysSinceEpoch(daysSinceEpoch.data());
+            std::vector<int> singleYears(size);
+            column.getYears(singleYears.data());
+            CHECK(singleYears == years);
+            for (size_t i = 0; i < size; ++i) {
+                const DateTime dt = column.at(i).toDateTime();
+                CHECK(years[i] == dt.year());
+                CHECK(months[i] == dt.month());
+                CHECK(days[i] == dt.day());
+                CHECK(hours[i] == dt.hour());
+                CHECK(minutes[i] == dt.minute());
+                CHECK(seconds[i] == dt.second());
+                CHECK(milliseconds[i] == dt.millisecond());
+                CHECK(microseconds[i] == dt.microsecond());
+                CHECK(nanoseconds[i] == dt.nanosecond());
+                CHECK(daysOfWeek[i] == dt.dayOfWeek());
+                CHECK(daysOfYear[i] == dt.dayOfYear());
+                CHECK(daysSinceEpoch[i] == dt.toDaysSinceEpoch());
+            }
+        }
+    }
+}
@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/compact.hpp"
+
+#include <algorithm>
+#include <unordered_set>
+#include <vector>
+
+using namespace xclox;
+
+TEST_SUITE("CompactDate")
+{
+    TEST_CASE("constructible")
+    {
+        SUBCASE("compact")
+        {
+            CHECK(sizeof(CompactDate) == 4);
+        }
+        SUBCASE("default")
+        {
+            CHECK(CompactDate().isValid() == false);
+        }
+        SUBCASE("days")
+        {
+            CHECK(CompactDate(CompactDate::Days(0)) == CompactDate::epoch());
+            CHECK(CompactDate(CompactDate::Days(-1)).toDate() == Date(1969, 12, 31));
+            CHECK(CompactDate(CompactDate::Days(2147483648L)).isValid() == false);
+        }
+        SUBCASE("date")
+        {
+            CHECK(CompactDate(Date(2024, 2, 29)).toDate() == Date(2024, 2, 29));
+            CHECK(CompactDate(2024, 2, 29) == CompactDate(Date(2024, 2, 29)));
+            CHECK(CompactDate(Date(2023, 2, 29)).isValid() == false);
+            CHECK(CompactDate(Date()).isValid() == false);
+            CHECK(CompactDate().toDate().isValid() == false);
+        }
+    }
+
+    TEST_CASE("comparable")
+    {
+        const CompactDate a(1969, 12, 31);
+        const CompactDate b(1970, 1, 1);
+        CHECK(a < b);
+        CHECK(a <= b);
+        CHECK(b > a);
+        CHECK(b >= a);
+        CHECK(a != b);
+        CHECK(a == a);
+        CHECK(b - a == 1);
+        CHECK(a - CompactDate(2024, 2, 18) == -19772);
+        std::unordered_set<CompactDate> set = { a, b, CompactDate::epoch() };
+        CHECK(set.size() == 2);
+    }
+
+    TEST_CASE("same fields as Date")
+    {
+        for (long days = -800000; days < 800000; days += 997) {
+            const CompactDate compact { CompactDate::Days(days) };
+            const Date date(CompactDate::Days { days });
+            int year, month, day;
+            compact.getYearMonthDay(&year, &month, &day);
+            CHECK(CompactDate(date) == compact);
+            CHECK(compact.toDate() == date);
+            CHECK(compact.toDaysSinceEpoch() == days);
+            CHECK(compact.year() == date.year());
+            CHECK(compact.month() == date.month());
+            CHECK(compact.day() == date.day());
+            CHECK(year == date.year());
+            CHECK(month == date.month());
+            CHECK(day == date.day());
+            CHECK(compact.dayOfWeek() == date.dayOfWeek());
+            CHECK(compact.dayOfYear() == date.dayOfYear());
+        }
+    }
+
+    TEST_CASE("addition/subtraction")
+    {
+        const CompactDate date(2024, 1, 31);
+        CHECK(date.addDays(1) == CompactDate(2024, 2, 1));
+        CHECK(date.subtractDays(31) == CompactDate(2023, 12, 31));
+        CHECK(date.addWeeks(-1) == date.subtractDays(7));
+        CHECK(date.subtractWeeks(1) == date.subtractDays(7));
+        CHECK(date.addMonths(1) == CompactDate(2024, 2, 29));
+        CHECK(date.subtractMonths(2) == CompactDate(2023, 11, 30));
+        CHECK(date.addYears(1) == CompactDate(2025, 1, 31));
+        CHECK(CompactDate(1, 3, 1).subtractYears(1) == CompactDate(-1, 3, 1));
+        CHECK(CompactDate().addDays(1).isValid() == false);
+        CHECK(CompactDate().addMonths(1).isValid() == false);
+    }
+
+    TEST_CASE("formatting and parsing")
+    {
+        const CompactDate date(2024, 2, 18);
+        CHECK(date.toString("dddd, d MMMM yyyy") == "Sunday, 18 February 2024");
+        CHECK(date.toString(Format("yyyy-MM-dd")) == "2024-02-18");
+        CHECK(CompactDate().toString("yyyy-MM-dd") == "");
+        char buffer[10];
+        CHECK(date.toChars(buffer, buffer + sizeof(buffer), Format("yyyy-MM-dd")) == 10);
+        CHECK(std::string(buffer, 10) == "2024-02-18");
+        CHECK(CompactDate::fromString("2024-02-18", "yyyy-MM-dd") == date);
+        CHECK(CompactDate::fromString("2024-02-30", "yyyy-MM-dd").isValid() == false);
+        CompactDate parsed;
+        CHECK(CompactDate::fromChars("18.02.2024", "18.02.2024" + 10, Format("dd.MM.yyyy"), parsed));
+        CHECK(parsed == date);
+        CHECK(CompactDate::fromChars("2024-02-30", "2024-02-30" + 10, Format("yyyy-MM-dd"), parsed).error == ParseError::InvalidValue);
+        CHECK(parsed.isValid() == false);
+    }
+}
+
+TEST_SUITE("CompactDateTime")
+{
+    TEST_CASE("constructible")
+    {
+        SUBCASE("compact")
+        {
+            CHECK(sizeof(CompactDateTime) == 8);
+        }
+        SUBCASE("default")
+        {
+            CHECK(CompactDateTime().isValid() == false);
+        }
+        SUBCASE("duration")
+        {
+            CHECK(CompactDateTime(CompactDateTime::Nanoseconds(0)) == CompactDateTime::epoch());
+            CHECK(CompactDateTime(CompactDateTime::Days(1)).toDateTime() == DateTime(Date(1970, 1, 2)));
+            CHECK(CompactDateTime(CompactDateTime::Nanoseconds(-1)).toDateTime() == DateTime(Date(1969, 12, 31), Time(23, 59, 59, CompactDateTime::Nanoseconds(999999999))));
+        }
+        SUBCASE("datetime")
+        {
+            const DateTime dt(Date(2024, 2, 18), Time(21, 46, 7, CompactDateTime::Nanoseconds(987654321)));
+            CHECK(CompactDateTime(dt).toDateTime() == dt);
+            CHECK(CompactDateTime(dt.date(), dt.time()).toDateTime() == dt);
+            CHECK(CompactDateTime(DateTime()).isValid() == false);
+        }
+        SUBCASE("range")
+        {
+            const DateTime min(Date(1677, 9, 21), Time(0, 12, 43, CompactDateTime::Nanoseconds(145224193)));
+            const DateTime max(Date(2262, 4, 11), Time(23, 47, 16, CompactDateTime::Nanoseconds(854775807)));
+            CHECK(CompactDateTime(min).toDateTime() == min);
+            CHECK(CompactDateTime(max).toDateTime() == max);
+            CHECK(CompactDateTime(min.subtractNanoseconds(2)).isValid() == false);
+            CHECK(CompactDateTime(max.addNanoseconds(1)).isValid() == false);
+        }
+    }
+
+    TEST_CASE("comparable")
+    {
+        const CompactDateTime a(DateTime(Date(1969, 12, 31), Time(23, 59, 59)));
+        const CompactDateTime b(DateTime(Date(1970, 1, 1), Time(0, 0, 0)));
+        CHECK(a < b);
+        CHECK(a <= b);
+        CHECK(b > a);
+        CHECK(b >= a);
+        CHECK(a != b);
+        CHECK(a == a);
+        CHECK_FALSE(b < a);
+        CHECK(b - a == CompactDateTime::Seconds(1));
+        std::vector<CompactDateTime> values = { b, a, CompactDateTime::epoch() };
+        std::sort(values.begin(), values.end());
+        CHECK(values == std::vector<CompactDateTime>({ a, b, b }));
+    }
+
+    TEST_CASE("hashable")
+    {
+        std::unordered_set<CompactDateTime> set = { CompactDateTime::epoch(), CompactDateTime::epoch(), CompactDateTime::epoch().addNanoseconds(1) };
+        CHECK(set.size() == 2);
+        CHECK(set.count(CompactDateTime(CompactDateTime::Nanoseconds(1))) == 1);
+    }
+
+    TEST_CASE("same fields as DateTime")
+    {
+        for (int i = 0; i < 2000; ++i) {
+            const long long value = (i - 1000) * 9223372036854775LL + i * 7919LL;
+            const CompactDateTime compact(CompactDateTime::Nanoseconds { value });
+            const DateTime dt = compact.toDateTime();
+            CHECK(compact.toNanosecondsSinceEpoch() == value);
+            CHECK(CompactDateTime(dt) == compact);
+            CHECK(compact.year() == dt.year());
+            CHECK(compact.month() == dt.month());
+            CHECK(compact.day() == dt.day());
+            CHECK(compact.hour() == dt.hour());
+            CHECK(compact.minute() == dt.minute());
+            CHECK(compact.second() == dt.second());
+            CHECK(compact.millisecond() == dt.millisecond());
+            CHECK(compact.microsecond() == dt.microsecond());
+            CHECK(compact.nanosecond() == dt.nanosecond());
+            CHECK(compact.dayOfWeek() == dt.dayOfWeek());
+            CHECK(compact.dayOfYear() == dt.dayOfYear());
+            CHECK(compact.toDaysSinceEpoch() == dt.toDaysSinceEpoch());
+        }
+    }
+
+    TEST_CASE("addition/subtraction")
+    {
+        const CompactDateTime dt(DateTime(Date(2024, 1, 31), Time(23, 59, 59)));
+        CHECK(dt.addSeconds(1).toDateTime() == DateTime(Date(2024, 2, 1)));
+        CHECK(dt.addNanoseconds(1).nanosecond() == 1);
+        CHECK(dt.subtractDays(31).toDateTime() == DateTime(Date(2023, 12, 31), Time(23, 59, 59)));
+        CHECK(dt.addHours(-24) == dt.subtractDays(1));
+        CHECK(dt.addMonths(1).toDateTime() == DateTime(Date(2024, 1, 31), Time(23, 59, 59)).addMonths(1));
+        CHECK(dt.subtractYears(1).year() == 2023);
+        CHECK(dt + CompactDateTime::Minutes(1) == dt.addMinutes(1));
+        CHECK(dt - CompactDateTime::Minutes(1) == dt.subtractMinutes(1));
+        CHECK(CompactDateTime().addDays(1).isValid() == false);
+    }
+
+    TEST_CASE("formatting and parsing")
+    {
+        const CompactDateTime dt(DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)));
+        CHECK(dt.toString() == "2024-02-18 21:46:07");
+        CHECK(dt.toString("dddd, d MMMM yyyy hh:mm:ss.fff a") == "Sunday, 18 February 2024 21:46:07.987 pm");
+        CHECK(CompactDateTime().toString() == "");
+        CHECK(CompactDateTime::fromString("2024-02-18 21:46:07.987", "yyyy-MM-dd hh:mm:ss.fff") == dt);
+        CHECK(CompactDateTime::fromString("2024-02-30 21:46:07").isValid() == false);
+        CompactDateTime parsed;
+        CHECK(CompactDateTime::fromChars("3024-02-18", "3024-02-18" + 10, Format("yyyy-MM-dd"), parsed).error == ParseError::InvalidValue);
+        CHECK(parsed.isValid() == false);
+    }
+}
+
+TEST_SUITE("BasicDateTime")
+{
+    using SecondDateTime = BasicDateTime<std::int32_t, std::ratio<1>>;
+    using MillisecondDateTime = BasicDateTime<std::int64_t, std::milli>;
+    using MinuteDateTime = BasicDateTime<std::int32_t, std::ratio<60>>;
+
+    TEST_CASE("constructible")
+    {
+        SUBCASE("compact")
+        {
+            CHECK(sizeof(SecondDateTime) == 4);
+            CHECK(sizeof(MillisecondDateTime) == 8);
+            CHECK(sizeof(BasicDateTime<std::int16_t, std::ratio<86400>>) == 2);
+        }
+        SUBCASE("range")
+        {
+            const DateTime min(Date(1901, 12, 13), Time(20, 45, 53));
+            const DateTime max(Date(2038, 1, 19), Time(3, 14, 7));
+            CHECK(SecondDateTime(min).toDateTime() == min);
+            CHECK(SecondDateTime(max).toDateTime() == max);
+            CHECK(SecondDateTime(min.subtractSeconds(1)).isValid() == false);
+            CHECK(SecondDateTime(max.addSeconds(1)).isValid() == false);
+            CHECK(MillisecondDateTime(DateTime(Date(-100000, 1, 1))).toDateTime() == DateTime(Date(-100000, 1, 1)));
+        }
+        SUBCASE("truncation")
+        {
+            const DateTime dt(Date(1969, 12, 31), Time(23, 59, 59, 999));
+            CHECK(SecondDateTime(dt).toDateTime() == DateTime(Date(1969, 12, 31), Time(23, 59, 59)));
+            CHECK(SecondDateTime(dt).toStdDurationSinceEpoch().count() == -1);
+            CHECK(MillisecondDateTime(dt).toStdDurationSinceEpoch().count() == -1);
+            CHECK(MinuteDateTime(dt).toDateTime() == DateTime(Date(1969, 12, 31), Time(23, 59, 0)));
+            CHECK(SecondDateTime(std::chrono::system_clock::time_point(std::chrono::milliseconds(-1500))).toStdDurationSinceEpoch().count() == -2);
+        }
+    }
+
+    TEST_CASE("conversion between instantiations")
+    {
+        const CompactDateTime precise(DateTime(Date(2024, 2, 18), Time(21, 46, 7, CompactDateTime::Nanoseconds(987654321))));
+        const MillisecondDateTime milli(precise);
+        const SecondDateTime second(milli);
+        CHECK(milli.toDateTime() == DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)));
+        CHECK(second.toDateTime() == DateTime(Date(2024, 2, 18), Time(21, 46, 7)));
+        CHECK(CompactDateTime(second).toDateTime() == second.toDateTime());
+        CHECK(MillisecondDateTime(CompactDateTime(CompactDateTime::Nanoseconds(-1))).toStdDurationSinceEpoch().count() == -1);
+        CHECK(SecondDateTime(MillisecondDateTime(DateTime(Date(2100, 1, 1)))).isValid() == false);
+        CHECK(CompactDateTime(MillisecondDateTime(DateTime(Date(2300, 1, 1)))).isValid() == false);
+        CHECK(SecondDateTime(CompactDateTime()).isValid() == false);
+    }
+
+    TEST_CASE("querying")
+    {
+        const SecondDateTime dt(DateTime(Date(2024, 2, 29), Time(13, 14, 15, 678)));
+        CHECK(dt.year() == 2024);
+        CHECK(dt.month() == 2);
+        CHECK(dt.day() == 29);
+        CHECK(dt.hour() == 13);
+        CHECK(dt.minute() == 14);
+        CHECK(dt.second() == 15);
+        CHECK(dt.millisecond() == 0);
+        CHECK(dt.dayOfWeek() == static_cast<int>(DateTime::Weekday::Thursday));
+        CHECK(dt.dayOfYear() == 60);
+        CHECK(dt.toNanosecondsSinceEpoch() == 1709212455000000000LL);
+        CHECK(dt.toStdTimePoint() == std::chrono::system_clock::time_point(std::chrono::seconds(1709212455)));
+    }
+
+    TEST_CASE("addition/subtraction")
+    {
+        const SecondDateTime dt(DateTime(Date(2024, 1, 31), Time(23, 59, 59)));
+        CHECK(dt.addSeconds(1).toDateTime() == DateTime(Date(2024, 2, 1)));
+        CHECK(dt.addMilliseconds(1999) == dt.addSeconds(1));
+        CHECK(dt.subtractMilliseconds(1999) == dt.subtractSeconds(1));
+        CHECK(dt.subtractMonths(2).toDateTime() == DateTime(Date(2023, 11, 30), Time(23, 59, 59)));
+        CHECK(dt + std::chrono::hours(1) == dt.addHours(1));
+        CHECK(dt.addDays(1) - dt == SecondDateTime::Difference(86400));
+        CHECK(SecondDateTime(DateTime(Date(2038, 1, 1))).addDays(30).isValid() == false);
+        CHECK(SecondDateTime(DateTime(Date(1902, 1, 1))).subtractDays(30).isValid() == false);
+        CHECK(SecondDateTime(DateTime(Date(2038, 1, 19))) - SecondDateTime(DateTime(Date(1902, 1, 1))) == std::chrono::seconds(4293388800LL));
+    }
+
+    TEST_CASE("formatting and parsing")
+    {
+        const MillisecondDateTime dt(DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)));
+        CHECK(dt.toString("yyyy-MM-dd hh:mm:ss.fffffffff") == "2024-02-18 21:46:07.987000000");
+        CHECK(MillisecondDateTime::fromString("2024-02-18 21:46:07.987654321", "yyyy-MM-dd hh:mm:ss.fffffffff") == dt);
+        SecondDateTime parsed;
+        CHECK(SecondDateTime::fromChars("2040-01-01", "2040-01-01" + 10, Format("yyyy-MM-dd"), parsed).error == ParseError::InvalidValue);
+        CHECK(parsed.isValid() == false);
+    }
+
+    TEST_CASE("hashing")
+    {
+        CHECK(std::hash<SecondDateTime>()(SecondDateTime(SecondDateTime::Duration(42))) == std::hash<long long>()(42));
+    }
+}
@@ -7,6 +7,9 @@
 
 #include "xclox/date.hpp"
 
+#include <limits>
+#include <vector>
+
 using namespace xclox;
 using namespace std::chrono;
 
@@ -278,6 +281,13 @@ TEST_SUITE("Date")
             CHECK(Date(2010, 1, 1).dayOfWeek() == 5);
             CHECK(Date(2005, 1, 1).dayOfWeek() == 6);
             CHECK(Date(2006, 1, 1).dayOfWeek() == 7);
+            SUBCASE("before the epoch")
+            {
+                CHECK(Date(1969, 12, 31).dayOfWeek() == 3);
+                CHECK(Date(1969, 12, 28).dayOfWeek() == 7);
+                CHECK(Date(1969, 12, 26).dayOfWeek() == 5);
+                CHECK(Date(-2017, 12, 16).dayOfWeek() == 7);
+            }
         }
         SUBCASE("day of year")
         {
@@ -442,6 +452,30 @@ TEST_SUITE("Date")
             CHECK(Date(-2017, 12, 16).toString("#yyyy.MM.dd") == "-2017.12.16");
             CHECK(Date(2017, 12, 19).toString("yyyyMMdd") == "20171219");
         }
+        SUBCASE("character buffer")
+        {
+            char buffer[32];
+            CHECK(Date(2017, 12, 15).toChars(buffer, buffer + sizeof(buffer), "dddd dd MMMM yyyy") == 23);
+            CHECK(std::string(buffer, 23) == "Friday 15 December 2017");
+            CHECK(Date(-2017, 12, 16).toChars(buffer, buffer + sizeof(buffer), std::string("#yyyy.MM.dd")) == 11);
+            CHECK(std::string(buffer, 11) == "-2017.12.16");
+            CHECK(Date(2007, 5, 11).toChars(buffer, buffer + sizeof(buffer), Format("yy.MMM.dd")) == 9);
+            CHECK(std::string(buffer, 9) == "07.May.11");
+            CHECK(Date().toChars(buffer, buffer + sizeof(buffer), "yyyy-MM-dd") == 0);
+            SUBCASE("too small")
+            {
+                CHECK(Date(2017, 12, 15).toChars(buffer, buffer + 4, "yyyy-MM-dd") == 10);
+                CHECK(std::string(buffer, 4) == "2017");
+                CHECK(Date(2017, 12, 15).toChars(nullptr, nullptr, "yyyy-MM-dd E") == 13);
+            }
+        }
+        SUBCASE("precompiled format")
+        {
+            const Format format("ddd, dd MMM yyyy E");
+            CHECK(Date(2017, 12, 10).toString(format) == "Sun, 10 Dec 2017 CE");
+            CHECK(Date(1795, 7, 23).toString(format) == "Thu, 23 Jul 1795 CE");
+            CHECK(Date().toString(format) == "");
+        }
     }
 
     TEST_CASE("parsing")
@@ -466,6 +500,9 @@ TEST_SUITE("Date")
             CHECK(Date::fromString("02", "MM") == Date(1, 2, 1));
             CHECK(Date::fromString("Aug", "MMM") == Date(1, 8, 1));
             CHECK(Date::fromString("September", "MMMM") == Date(1, 9, 1));
+            CHECK(Date::fromString("aUG", "MMM") == Date(1, 8, 1));
+            CHECK(Date::fromString("SEPTEMBER", "MMMM") == Date(1, 9, 1));
+            CHECK(Date::fromString("Septembe", "MMMM").isValid() == false);
             CHECK(Date::fromString("January, 2009", "MMMM, yyyy") == Date(2009, 1, 1));
             CHECK(Date::fromString("December, 2011", "MMMM, yyyy") == Date(2011, 12, 1));
         }
@@ -488,7 +525,274 @@ TEST_SUITE("Date")
             CHECK(Date::fromString("20171219", "yyyyMMdd") == Date(2017, 12, 19));
             CHECK(Date::fromString("ieee 20171219", "ieee yyyyMMdd") == Date(2017, 12, 19));
         }
+        SUBCASE("precompiled format")
+        {
+            const Format format("dddd dd MMMM yyyy");
+            CHECK(Date::fromString("Friday 15 December 2017", format) == Date(2017, 12, 15));
+            CHECK(Date::fromString("Monday 01 January 2018", format) == Date(2018, 1, 1));
+        }
+    }
+
+    TEST_CASE("parsing without exceptions")
+    {
+        const auto parse = [](const std::string& input, const std::string& format, Date& date) {
+            return Date::fromChars(input.data(), input.data() + input.size(), Format(format), date);
+        };
+        Date date;
+        SUBCASE("success")
+        {
+            const ParseResult result = parse("Friday 15 December 2017", "dddd dd MMMM yyyy", date);
+            CHECK(bool(result));
+            CHECK(result.error == ParseError::None);
+            CHECK(result.position == 23);
+            CHECK(date == Date(2017, 12, 15));
+        }
+        SUBCASE("missing value")
+        {
+            ParseResult result = parse("2017-1x-15", "yyyy-MM-dd", date);
+            CHECK(result.error == ParseError::None);
+            result = parse("2017-x1-15", "yyyy-MM-dd", date);
+            CHECK(result.error == ParseError::MissingValue);
+            CHECK(result.position == 5);
+            CHECK(date.isValid() == false);
+            result = parse("15 Decembre 2017", "dd MMMM yyyy", date);
+            CHECK(result.error == ParseError::MissingValue);
+            CHECK(result.position == 3);
+            CHECK(parse("15 De", "dd MMM", date).error == ParseError::MissingValue);
+        }
+        SUBCASE("invalid value")
+        {
+            const ParseResult result = parse("2023-02-29", "yyyy-MM-dd", date);
+            CHECK(result.error == ParseError::InvalidValue);
+            CHECK(result.position == 10);
+            CHECK(date.isValid() == false);
+        }
+        SUBCASE("malformed input does not throw")
+        {
+            CHECK(Date::fromString("abcd-ef-gh", "yyyy-MM-dd").isValid() == false);
+            CHECK(Date::fromString("2017-", "yyyy-MM-dd") == Date(2017, 1, 1));
+            CHECK(Date::fromString("ABC", "y").isValid() == false);
+        }
+#ifdef XCLOX_HAS_STRING_VIEW
+        SUBCASE("string view")
+        {
+            CHECK(bool(Date::fromChars(std::string_view("2024-02-29"), Format("yyyy-MM-dd"), date)));
+            CHECK(date == Date(2024, 2, 29));
+        }
+#endif
+    }
+
+    TEST_CASE("civil table")
+    {
+        auto check = [](long first, long last, bool (*daysToYmd)(long, int*, int*, int*), bool (*ymdToDays)(int, int, int, long&)) {
+            long mismatches = 0;
+            for (long day = first; day <= last; ++day) {
+                int year, month, monthDay, expectedYear, expectedMonth, expectedDay;
+                long roundTrip = 0;
+                internal::daysToYmdByFormula(internal::Days(day), &expectedYear, &expectedMonth, &expectedDay);
+                const bool isFound = daysToYmd(day, &year, &month, &monthDay);
+                if (isFound != ymdToDays(expectedYear, expectedMonth, expectedDay, roundTrip))
+                    ++mismatches;
+                else if (isFound)
+                    mismatches += year != expectedYear || month != expectedMonth || monthDay != expectedDay || roundTrip != day;
+            }
+            return mismatches;
+        };
+        SUBCASE("default window")
+        {
+            using Table = internal::CivilTable<1900, 2200>;
+            auto daysToYmd = [](long day, int* year, int* month, int* monthDay) { return Table::get().daysToYmd(day, year, month, monthDay); };
+            auto ymdToDays = [](int year, int month, int monthDay, long& day) { return Table::get().ymdToDays(year, month, monthDay, day); };
+            CHECK(check(-30000, 90000, daysToYmd, ymdToDays) == 0);
+            int year = 0;
+            long day = 0;
+            CHECK(daysToYmd(Date(1899, 12, 31).toDaysSinceEpoch(), &year, nullptr, nullptr) == false);
+            CHECK(daysToYmd(Date(1900, 1, 1).toDaysSinceEpoch(), &year, nullptr, nullptr));
+            CHECK(year == 1900);
+            CHECK(daysToYmd(Date(2200, 12, 31).toDaysSinceEpoch(), &year, nullptr, nullptr));
+            CHECK(year == 2200);
+            CHECK(daysToYmd(Date(2201, 1, 1).toDaysSinceEpoch(), &year, nullptr, nullptr) == false);
+            CHECK(ymdToDays(2024, 13, 1, day) == false);
+            CHECK(ymdToDays(2024, 2, 30, day));
+            CHECK(day == internal::ymdToDaysByFormula(2024, 2, 30).count());
+        }
+        SUBCASE("single year")
+        {
+            using Table = internal::CivilTable<2000, 2000>;
+            auto daysToYmd = [](long day, int* year, int* month, int* monthDay) { return Table::get().daysToYmd(day, year, month, monthDay); };
+            auto ymdToDays = [](int year, int month, int monthDay, long& day) { return Table::get().ymdToDays(year, month, monthDay, day); };
+            CHECK(check(10000, 12000, daysToYmd, ymdToDays) == 0);
+        }
+        SUBCASE("first years of the common era")
+        {
+            using Table = internal::CivilTable<1, 500>;
+            auto daysToYmd = [](long day, int* year, int* month, int* monthDay) { return Table::get().daysToYmd(day, year, month, monthDay); };
+            auto ymdToDays = [](int year, int month, int monthDay, long& day) { return Table::get().ymdToDays(year, month, monthDay, day); };
+            CHECK(check(-720000, -530000, daysToYmd, ymdToDays) == 0);
+        }
+    }
+
+    TEST_CASE("civil conversion of whole arrays")
+    {
+        // Days spread over the whole supported range, along with every day of its edges and around the epoch.
+        std::vector<std::int32_t> days;
+        const std::int32_t first = -static_cast<std::int32_t>(internal::CivilDaysOffset);
+        const std::int32_t last = std::numeric_limits<std::int32_t>::max();
+        for (std::int32_t i = 0; i < 3000; ++i) {
+            days.push_back(first + i);
+            days.push_back(last - i);
+            days.push_back(i - 1500);
+        }
+        for (long long day = first; day <= last; day += 65521)
+            days.push_back(static_cast<std::int32_t>(day));
+        days.resize(days.size() / 16 * 16 + 5); // leaves a few days to the scalar loop.
+
+        const size_t size = days.size();
+        std::vector<int> expectedYears(size), expectedMonths(size), expectedDays(size);
+        for (size_t i = 0; i < size; ++i)
+            internal::daysToYmd(internal::Days(days[i]), &expectedYears[i], &expectedMonths[i], &expectedDays[i]);
+
+        using DaysToYmd = size_t (*)(const std::int32_t*, size_t, int*, int*, int*);
+        using YmdToDays = size_t (*)(const int*, const int*, const int*, size_t, std::int32_t*);
+        auto check = [&](DaysToYmd daysToYmd, YmdToDays ymdToDays) {
+            std::vector<int> years(size), months(size), monthDays(size);
+            std::vector<std::int32_t> roundTrip(size);
+            const size_t count = daysToYmd(days.data(), size, years.data(), months.data(), monthDays.data());
+            CHECK(ymdToDays(expectedYears.data(), expectedMonths.data(), expectedDays.data(), size, roundTrip.data()) == count);
+            CHECK(std::equal(years.begin(), years.begin() + count, expectedYears.begin()));
+            CHECK(std::equal(months.begin(), months.begin() + count, expectedMonths.begin()));
+            CHECK(std::equal(monthDays.begin(), monthDays.begin() + count, expectedDays.begin()));
+            CHECK(std::equal(roundTrip.begin(), roundTrip.begin() + count, days.begin()));
+        };
+
+        SUBCASE("dispatched")
+        {
+            check(
+                [](const std::int32_t* dys, size_t count, int* year, int* month, int* day) {
+                    internal::daysToYmd(dys, count, year, month, day);
+                    return count;
+                },
+                [](const int* year, const int* month, const int* day, size_t count, std::int32_t* dys) {
+                    internal::ymdToDays(year, month, day, count, dys);
+                    return count;
+                });
+        }
+#ifdef XCLOX_HAS_AVX
+        SUBCASE("AVX2")
+        {
+            if (internal::getSimdLevel() >= internal::SimdLevel::Avx2)
+                check(internal::daysToYmdAvx2, internal::ymdToDaysAvx2);
+        }
+        SUBCASE("AVX-512")
+        {
+            if (internal::getSimdLevel() >= internal::SimdLevel::Avx512)
+                check(internal::daysToYmdAvx512, internal::ymdToDaysAvx512);
+        }
+#endif
+        SUBCASE("range")
+        {
+            int year, month, day;
+            internal::daysToYmd(&first, 1, &year, &month, &day);
+            CHECK(Date(year, month, day) == Date(-5877601, 3, 1));
+            internal::daysToYmd(&last, 1, &year, &month, &day);
+            CHECK(Date(year, month, day) == Date(5881580, 7, 11));
+        }
+    }
+
+    TEST_CASE("rounding")
+    {
+        SUBCASE("calendar units")
+        {
+            const Date d(2024, 8, 15); // Thursday
+            CHECK(d.floor(Date::CalendarUnit::Week) == Date(2024, 8, 12));
+            CHECK(d.ceil(Date::CalendarUnit::Week) == Date(2024, 8, 19));
+            CHECK(d.round(Date::CalendarUnit::Week) == Date(2024, 8, 12));
+            CHECK(Date(2024, 8, 16).round(Date::CalendarUnit::Week) == Date(2024, 8, 19));
+            CHECK(d.floor(Date::CalendarUnit::Month) == Date(2024, 8, 1));
+            CHECK(d.ceil(Date::CalendarUnit::Month) == Date(2024, 9, 1));
+            CHECK(d.round(Date::CalendarUnit::Month) == Date(2024, 8, 1));
+            CHECK(Date(2024, 8, 17).round(Date::CalendarUnit::Month) == Date(2024, 9, 1));
+            CHECK(d.floor(Date::CalendarUnit::Quarter) == Date(2024, 7, 1));
+            CHECK(d.ceil(Date::CalendarUnit::Quarter) == Date(2024, 10, 1));
+            CHECK(d.round(Date::CalendarUnit::Quarter) == Date(2024, 7, 1));
+            CHECK(d.floor(Date::CalendarUnit::Year) == Date(2024, 1, 1));
+            CHECK(d.ceil(Date::CalendarUnit::Year) == Date(2025, 1, 1));
+            CHECK(d.round(Date::CalendarUnit::Year) == Date(2025, 1, 1));
+            CHECK(Date(2024, 10, 1).ceil(Date::CalendarUnit::Quarter) == Date(2024, 10, 1));
+            CHECK(Date(2024, 12, 2).ceil(Date::CalendarUnit::Month) == Date(2025, 1, 1));
+            CHECK(Date(2024, 11, 2).ceil(Date::CalendarUnit::Quarter) == Date(2025, 1, 1));
+            CHECK(Date(2025, 1, 1).floor(Date::CalendarUnit::Week) == Date(2024, 12, 30));
+        }
+        SUBCASE("before the common era")
+        {
+            CHECK(Date(-1, 12, 31).ceil(Date::CalendarUnit::Month) == Date(1, 1, 1));
+            CHECK(Date(-1, 11, 30).ceil(Date::CalendarUnit::Quarter) == Date(1, 1, 1));
+            CHECK(Date(-1, 7, 2).ceil(Date::CalendarUnit::Year) == Date(1, 1, 1));
+            CHECK(Date(1, 1, 3).floor(Date::CalendarUnit::Week) == Date(1, 1, 1));
+            CHECK(Date(-1, 12, 31).floor(Date::CalendarUnit::Week) == Date(-1, 12, 25));
+        }
+        SUBCASE("fixed units")
+        {
+            CHECK(Date(1970, 1, 10).floor(Date::Days(7)) == Date(1970, 1, 8));
+            CHECK(Date(1970, 1, 10).ceil(Date::Weeks(1)) == Date(1970, 1, 15));
+            CHECK(Date(1970, 1, 10).round(Date::Days(4)) == Date(1970, 1, 9));
+            CHECK(Date(1970, 1, 11).round(Date::Days(4)) == Date(1970, 1, 13));
+            CHECK(Date(1970, 1, 9).round(Date::Days(4)) == Date(1970, 1, 9));
+            CHECK(Date(1969, 12, 31).floor(Date::Days(10)) == Date(1969, 12, 22));
+            CHECK(Date(1969, 12, 22).ceil(Date::Days(10)) == Date(1969, 12, 22));
+        }
+        SUBCASE("invalid")
+        {
+            CHECK(Date().floor(Date::CalendarUnit::Month).isValid() == false);
+            CHECK(Date().ceil(Date::Days(1)).isValid() == false);
+            CHECK(Date(2024, 1, 1).round(Date::Days(0)).isValid() == false);
+        }
+    }
+
+    TEST_CASE("literals")
+    {
+        using namespace xclox::literals;
+
+        CHECK(2024_y / 3 / 1 == Date(2024, 3, 1));
+        CHECK(2024_y / Date::Month::February / 29 == Date(2024, 2, 29));
+        CHECK((2024_y / 2 / 29).isValid());
+        CHECK_FALSE((2023_y / 2 / 29).isValid());
+    }
+
+#ifdef XCLOX_HAS_CONSTEXPR14
+    TEST_CASE("constant expressions")
+    {
+        using namespace xclox::literals;
+
+        static_assert(internal::ymdToDays(1970, 1, 1).count() == 0, "");
+        static_assert(internal::ymdToDays(2024, 3, 1).count() == 19783, "");
+        static_assert(internal::ymdToDays(-1, 12, 31).count() == -719163, "");
+        static_assert(Date(Date::Days(19783)) == 2024_y / 3 / 1, "");
+        static_assert(Date(Date::Days(-719163)) == Date(-1, 12, 31), "");
+        static_assert(Date::epoch() == Date(1970, 1, 1), "");
+        static_assert(Date(2024, 2, 29).isValid() && !Date(2023, 2, 29).isValid(), "");
+        static_assert(Date(2024, 3, 1) > Date(2024, 2, 29) && Date(2024, 2, 29) <= Date(2024, 2, 29), "");
+        static_assert(Date(2024, 1, 31).addMonths(1) == Date(2024, 2, 29), "");
+        static_assert(Date(2024, 3, 31).subtractMonths(13) == Date(2023, 2, 28), "");
+        static_assert(Date(2024, 12, 31).addDays(1) == Date(2025, 1, 1), "");
+        static_assert(Date(1, 1, 1).subtractYears(1) == Date(-1, 1, 1), "");
+        static_assert(Date(2024, 3, 1).dayOfWeek() == static_cast<int>(Date::Weekday::Friday), "");
+        static_assert(Date(2024, 12, 31).dayOfYear() == 366, "");
+        static_assert(Date::daysBetween(Date(2000, 1, 1), 2024_y / 1 / 1) == 8766, "");
+        static_assert(Date::fromJulianDay(2460371).toJulianDay() == 2460371, "");
+        static_assert((2024_y / 8 / 15).floor(Date::CalendarUnit::Quarter) == 2024_y / 7 / 1, "");
+        static_assert((2024_y / 8 / 15).ceil(Date::Weeks(1)) == 2024_y / 8 / 15, "");
+
+        constexpr long Cutover = (2024_y / 7 / 1).toDaysSinceEpoch();
+        bool matched = false;
+        switch (Date(2024, 7, 1).toDaysSinceEpoch()) {
+        case Cutover:
+            matched = true;
+            break;
+        }
+        CHECK(matched);
     }
+#endif
 
     TEST_CASE("serialization & deserialization")
     {
@@ -121,6 +121,12 @@ TEST_SUITE("DateTime")
                 CHECK(compare(dt2, 1900, 1, 1, 0, 0, 0, 0, 0, 1));
                 CHECK(compare(dt3, 1900, 1, 1, 0, 0, 0, 0, 1, 1000));
             }
+            SUBCASE("least duration")
+            {
+                DateTime dt1(nanoseconds::min());
+
+                CHECK(compare(dt1, 1677, 9, 21, 0, 12, 43, 145, 145224, 145224192));
+            }
         }
     }
 
@@ -152,6 +158,8 @@ TEST_SUITE("DateTime")
         CHECK(DateTime(Date(2015, 3, 27), Time(1, 55, 21, Time::Nanoseconds(123456789))) >= DateTime(Date(2015, 3, 27), Time(1, 55, 21, Time::Nanoseconds(123456789))));
         CHECK(DateTime(Date(2012, 3, 27), Time(8, 55, 21, Time::Nanoseconds(123456789))) == DateTime(Date(2012, 3, 27), Time(8, 55, 21, Time::Nanoseconds(123456789))));
         CHECK(DateTime(Date(2017, 12, 6), Time(16, 32, 4, Time::Nanoseconds(987654321))) != DateTime(Date(2012, 3, 27), Time(8, 55, 21, Time::Nanoseconds(123456789))));
+        CHECK_FALSE(DateTime(Date(2012, 3, 27), Time(9, 55, 21)) <= DateTime(Date(2012, 3, 27), Time(8, 55, 21)));
+        CHECK_FALSE(DateTime(Date(2012, 3, 27), Time(8, 55, 21)) >= DateTime(Date(2012, 3, 27), Time(9, 55, 21)));
     }
 
     TEST_CASE("copyable")
@@ -217,6 +225,9 @@ TEST_SUITE("DateTime")
             CHECK(DateTime(Date(2045, 3, 27), Time(1, 2, 3, 4)).subtractDuration(DateTime::Days(3)) == DateTime(Date(2045, 3, 24), Time(1, 2, 3, 4)));
             // Subtracting a negative duration
             CHECK(DateTime(Date(2045, 3, 27), Time(1, 2, 3, 4)).subtractDuration(-DateTime::Days(3)) == DateTime(Date(2045, 3, 30), Time(1, 2, 3, 4)));
+            // Subtracting whole days from midnight.
+            CHECK(DateTime(Date(1970, 1, 1)).subtractDuration(DateTime::Days(1)) == DateTime(Date(1969, 12, 31)));
+            CHECK(DateTime(Date(1970, 1, 1)).subtractDuration(DateTime::Hours(48)) == DateTime(Date(1969, 12, 30)));
         }
         SUBCASE("operators")
         {
@@ -411,6 +422,36 @@ TEST_SUITE("DateTime")
         {
             CHECK(DateTime(Date(2024, 2, 18), Time(21, 46, 7, DateTime::Nanoseconds(987654321))).toString() == "2024-02-18 21:46:07");
         }
+        SUBCASE("character buffer")
+        {
+            const DateTime dt(Date(2024, 5, 18), Time(21, 46, 7, DateTime::Nanoseconds(987654321)));
+            char buffer[64];
+            CHECK(dt.toChars(buffer, buffer + sizeof(buffer), "yyyy-MM-ddThh:mm:ss.fffffffff") == 29);
+            CHECK(std::string(buffer, 29) == "2024-05-18T21:46:07.987654321");
+            CHECK(dt.toChars(buffer, buffer + sizeof(buffer), std::string("dddd, d MMMM y, H:mm A")) == 30);
+            CHECK(std::string(buffer, 30) == "Saturday, 18 May 2024, 9:46 PM");
+            CHECK(dt.toChars(buffer, buffer + sizeof(buffer), Format("E yyy")) == 6);
+            CHECK(std::string(buffer, 6) == "CE yyy");
+            CHECK(DateTime().toChars(buffer, buffer + sizeof(buffer), "yyyy") == 0);
+            SUBCASE("too small")
+            {
+                CHECK(dt.toChars(buffer, buffer + 10, "yyyy-MM-dd hh:mm:ss") == 19);
+                CHECK(std::string(buffer, 10) == "2024-05-18");
+            }
+            SUBCASE("longer than the internal buffer of toString()")
+            {
+                const std::string format(100, '-');
+                CHECK(dt.toString(format + "yyyy") == format + "2024");
+            }
+        }
+        SUBCASE("precompiled format")
+        {
+            const Format format("yyyy-MM-dd hh:mm:ss.fff");
+            CHECK(DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)).toString(format) == "2024-02-18 21:46:07.987");
+            CHECK(DateTime(Date(1999, 8, 7), Time(1, 2, 3, 4)).toString(format) == "1999-08-07 01:02:03.004");
+            CHECK(DateTime().toString(format) == "");
+            CHECK(DateTime(Date(1999, 8, 7), Time(1, 2, 3, 4)).toString(Format()) == "");
+        }
         SUBCASE("invalid date or time")
         {
             CHECK(DateTime().toString("d/M/yyyy, hh:mm:ss.fffffffff") == "");
@@ -447,6 +488,59 @@ TEST_SUITE("DateTime")
         CHECK(DateTime(UnixRolloverSeconds + seconds(1)).toString(format) == "2038-01-19 03:14:08.000000000");
     }
 
+    TEST_CASE("ISO formatting")
+    {
+        const DateTime dt(Date(2024, 2, 18), Time(21, 46, 7, DateTime::Nanoseconds(987654321)));
+
+        SUBCASE("size")
+        {
+            static_assert(IsoSecondFormat::Size == 19, "");
+            static_assert(IsoMillisecondFormat::Size == 23, "");
+            static_assert(IsoMicrosecondFormat::Size == 26, "");
+            static_assert(IsoNanosecondFormat::Size == 29, "");
+            static_assert(IsoFormat<1, true>::Size == 22, "");
+        }
+        SUBCASE("precision")
+        {
+            CHECK(IsoSecondFormat::toString(dt) == "2024-02-18T21:46:07");
+            CHECK(IsoFormat<1>::toString(dt) == "2024-02-18T21:46:07.9");
+            CHECK(IsoMillisecondFormat::toString(dt) == "2024-02-18T21:46:07.987");
+            CHECK(IsoMicrosecondFormat::toString(dt) == "2024-02-18T21:46:07.987654");
+            CHECK(IsoNanosecondFormat::toString(dt) == "2024-02-18T21:46:07.987654321");
+        }
+        SUBCASE("UTC designator")
+        {
+            CHECK(IsoFormat<0, true>::toString(dt) == "2024-02-18T21:46:07Z");
+            CHECK(IsoFormat<3, true>::toString(dt) == "2024-02-18T21:46:07.987Z");
+        }
+        SUBCASE("same as the generic format")
+        {
+            const auto& format = "yyyy-MM-ddThh:mm:ss.fffffffff";
+            for (const auto& other : { DateTime(-NtpDeltaSeconds - nanoseconds(1)), DateTime(-nanoseconds(1)), DateTime(UnixRolloverSeconds), DateTime(Date(-1, 2, 3), Time(4, 5, 6)), DateTime(Date(12345, 12, 31), Time(23, 59, 59)) }) {
+                CHECK(IsoNanosecondFormat::toString(other) == other.toString(format));
+                CHECK(IsoMillisecondFormat::toString(other) == other.toString("yyyy-MM-ddThh:mm:ss.fff"));
+            }
+        }
+        SUBCASE("character buffer")
+        {
+            char buffer[IsoMillisecondFormat::Size + 1] = {};
+            CHECK(IsoMillisecondFormat::toChars(buffer, buffer + sizeof(buffer), dt) == 23);
+            CHECK(std::string(buffer) == "2024-02-18T21:46:07.987");
+            SUBCASE("too small")
+            {
+                char small[11] = {};
+                CHECK(IsoMillisecondFormat::toChars(small, small + 10, dt) == 23);
+                CHECK(std::string(small) == "2024-02-18");
+            }
+        }
+        SUBCASE("invalid datetime")
+        {
+            char buffer[IsoMillisecondFormat::Size];
+            CHECK(IsoMillisecondFormat::toChars(buffer, buffer + sizeof(buffer), DateTime()) == 0);
+            CHECK(IsoMillisecondFormat::toString(DateTime()) == "");
+        }
+    }
+
     TEST_CASE("parsing")
     {
         SUBCASE("year")
@@ -541,6 +635,34 @@ TEST_SUITE("DateTime")
                     CHECK(DateTime::fromString("deCEmber BCE 9", "MMMM E y") == DateTime(Date(-9, 12, 1), Time(0, 0, 0)));
                 }
             }
+            SUBCASE("perfect hash of the first three letters")
+            {
+                for (size_t i = 0; i < 12; ++i) {
+                    std::string name = internal::getLongMonthNameArray()[i];
+                    CHECK(internal::lookup(internal::getShortMonthNameArray(), name.data(), name.data() + 3) == i);
+                    CHECK(internal::lookup(internal::getLongMonthNameArray(), name.data(), name.data() + name.size()) == i);
+                    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+                    CHECK(internal::lookup(internal::getLongMonthNameArray(), name.data(), name.data() + name.size()) == i);
+                    CHECK(internal::lookup(internal::getLongMonthNameArray(), name.data(), name.data() + name.size() - 1) == 12);
+                }
+                for (size_t i = 0; i < 7; ++i) {
+                    const std::string& name = internal::getLongWeekdayNameArray()[i];
+                    CHECK(internal::lookup(internal::getShortWeekdayNameArray(), name.data(), name.data() + 3) == i);
+                    CHECK(internal::lookup(internal::getLongWeekdayNameArray(), name.data(), name.data() + name.size()) == i);
+                }
+                int falseMatchCount = 0;
+                char prefix[3];
+                for (int c = 0; c < 128 * 128 * 128; ++c) {
+                    prefix[0] = static_cast<char>(c % 128);
+                    prefix[1] = static_cast<char>(c / 128 % 128);
+                    prefix[2] = static_cast<char>(c / 128 / 128);
+                    const size_t month = internal::lookup(internal::getShortMonthNameArray(), prefix, prefix + 3);
+                    const size_t weekday = internal::lookup(internal::getShortWeekdayNameArray(), prefix, prefix + 3);
+                    falseMatchCount += month != 12 && !std::equal(prefix, prefix + 3, internal::getShortMonthNameArray()[month].cbegin(), [](char a, char b) { return std::tolower(a) == std::tolower(b); });
+                    falseMatchCount += weekday != 7 && !std::equal(prefix, prefix + 3, internal::getShortWeekdayNameArray()[weekday].cbegin(), [](char a, char b) { return std::tolower(a) == std::tolower(b); });
+                }
+                CHECK(falseMatchCount == 0);
+            }
         }
         SUBCASE("day")
         {
@@ -639,6 +761,131 @@ TEST_SUITE("DateTime")
         {
             CHECK(DateTime::fromString("2024-02-02 01:33:06", "").isValid() == false);
         }
+        SUBCASE("precompiled format")
+        {
+            const Format format("yyyy-MM-dd hh:mm:ss.fff");
+            CHECK(DateTime::fromString("2024-02-18 21:46:07.987", format) == DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)));
+            CHECK(DateTime::fromString("1999-08-07 01:02:03.004", format) == DateTime(Date(1999, 8, 7), Time(1, 2, 3, 4)));
+            CHECK(DateTime::fromString("1999-08-07 01:02:03", Format("yyyy-MM-dd hhh:mm:ss")).isValid() == false);
+        }
+    }
+
+    TEST_CASE("parsing without exceptions")
+    {
+        const auto parse = [](const std::string& input, const std::string& format, DateTime& datetime) {
+            return DateTime::fromChars(input.data(), input.data() + input.size(), Format(format), datetime);
+        };
+        DateTime datetime;
+        SUBCASE("success")
+        {
+            const ParseResult result = parse("2024-02-18 09:46:07 pm", "yyyy-MM-dd hh:mm:ss a", datetime);
+            CHECK(bool(result));
+            CHECK(result.error == ParseError::None);
+            CHECK(result.position == 22);
+            CHECK(datetime == DateTime(Date(2024, 2, 18), Time(21, 46, 7)));
+        }
+        SUBCASE("missing value")
+        {
+            ParseResult result = parse("2024-02-18 21:x6:07", "yyyy-MM-dd hh:mm:ss", datetime);
+            CHECK(result.error == ParseError::MissingValue);
+            CHECK(result.position == 14);
+            CHECK(datetime.isValid() == false);
+            result = parse("2024-02-18", "yyyy-MM-dd hh:mm:ss", datetime);
+            CHECK(result.error == ParseError::MissingValue);
+            CHECK(result.position == 10);
+        }
+        SUBCASE("invalid pattern")
+        {
+            const ParseResult result = parse("2024-02-18 21:46:07", "yyyy-MM-dd hhh:mm:ss", datetime);
+            CHECK(result.error == ParseError::InvalidPattern);
+            CHECK(result.position == 11);
+        }
+        SUBCASE("invalid value")
+        {
+            const ParseResult result = parse("2024-02-30 21:46:07", "yyyy-MM-dd hh:mm:ss", datetime);
+            CHECK(result.error == ParseError::InvalidValue);
+            CHECK(result.position == 19);
+            CHECK(datetime.isValid() == false);
+        }
+#ifdef XCLOX_HAS_STRING_VIEW
+        SUBCASE("string view")
+        {
+            CHECK(bool(DateTime::fromChars(std::string_view("2024-02-18 21:46:07"), Format("yyyy-MM-dd hh:mm:ss"), datetime)));
+            CHECK(datetime == DateTime(Date(2024, 2, 18), Time(21, 46, 7)));
+        }
+#endif
+    }
+
+    TEST_CASE("ISO parsing")
+    {
+        const DateTime dt(Date(2024, 2, 18), Time(21, 46, 7, DateTime::Nanoseconds(987654321)));
+
+        SUBCASE("precision")
+        {
+            CHECK(IsoSecondFormat::fromString("2024-02-18T21:46:07") == DateTime(Date(2024, 2, 18), Time(21, 46, 7)));
+            CHECK(IsoFormat<1>::fromString("2024-02-18T21:46:07.9") == DateTime(Date(2024, 2, 18), Time(21, 46, 7, 900)));
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18T21:46:07.987") == DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)));
+            CHECK(IsoMicrosecondFormat::fromString("2024-02-18T21:46:07.987654") == DateTime(Date(2024, 2, 18), Time(21, 46, 7, DateTime::Microseconds(987654))));
+            CHECK(IsoNanosecondFormat::fromString("2024-02-18T21:46:07.987654321") == dt);
+            CHECK(IsoFormat<3, true>::fromString("2024-02-18T21:46:07.987Z") == DateTime(Date(2024, 2, 18), Time(21, 46, 7, 987)));
+        }
+        SUBCASE("round trip")
+        {
+            for (const auto& other : { DateTime(Date(1, 1, 1)), DateTime(-nanoseconds(1)), DateTime(UnixRolloverSeconds), DateTime(Date(2000, 2, 29), Time(23, 59, 59, 999)), DateTime(Date(9999, 12, 31), Time(23, 59, 59, DateTime::Nanoseconds(999999999))) }) {
+                CHECK(IsoNanosecondFormat::fromString(IsoNanosecondFormat::toString(other)) == other);
+                CHECK(IsoFormat<9, true>::fromString(IsoFormat<9, true>::toString(other)) == other);
+            }
+        }
+        SUBCASE("same as the generic format")
+        {
+            for (const auto& input : { "1970-01-01T00:00:00.000", "2017-12-31T23:59:59.999", "0001-01-01T00:00:00.001", "2024-02-29T12:34:56.789" })
+                CHECK(IsoMillisecondFormat::fromString(input) == DateTime::fromString(input, "yyyy-MM-ddThh:mm:ss.fff"));
+        }
+        SUBCASE("malformed")
+        {
+            CHECK(IsoMillisecondFormat::fromString("").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18T21:46:07").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18T21:46:07.9876").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18 21:46:07.987").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024/02/18T21:46:07.987").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18T21:46:07,987").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18T21:46:07.98a").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-0/-18T21:46:07.987").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("2024-02-18T21:46::7.987").isValid() == false);
+            CHECK(IsoMillisecondFormat::fromString("+024-02-18T21:46:07.987").isValid() == false);
+            CHECK(IsoFormat<3, true>::fromString("2024-02-18T21:46:07.987").isValid() == false);
+            CHECK(IsoFormat<3, true>::fromString("2024-02-18T21:46:07.9870").isValid() == false);
+        }
+        SUBCASE("out of range")
+        {
+            CHECK(IsoSecondFormat::fromString("0000-01-01T00:00:00").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2024-00-18T21:46:07").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2024-13-18T21:46:07").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2024-02-00T21:46:07").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2023-02-29T21:46:07").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2024-02-18T24:00:00").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2024-02-18T21:60:07").isValid() == false);
+            CHECK(IsoSecondFormat::fromString("2024-02-18T21:46:60").isValid() == false);
+        }
+        SUBCASE("vector and scalar parsers agree")
+        {
+            const std::string alphabet = "0123456789-T:.Z /";
+            unsigned state = 12345;
+            for (int i = 0; i < 10000; ++i) {
+                const size_t size = i % 2 == 0 ? internal::IsoLayoutSize : 21 + static_cast<size_t>(i) % 9;
+                std::string input(internal::getIsoTemplate(), size);
+                for (int j = 0; j < 3; ++j) {
+                    state = state * 1103515245 + 12345;
+                    input[(state >> 8) % size] = alphabet[(state >> 20) % alphabet.size()];
+                }
+                internal::DateTimeFields scalar = {}, vector = {};
+                const bool isScalarValid = internal::parseIsoScalar(input.data(), size, 'T', scalar);
+                REQUIRE(internal::parseIso(input.data(), size, 'T', vector) == isScalarValid);
+                if (isScalarValid) {
+                    CHECK(std::memcmp(&scalar, &vector, sizeof(scalar)) == 0);
+                }
+            }
+        }
     }
 
     TEST_CASE("Julian day conversion")
@@ -668,6 +915,85 @@ TEST_SUITE("DateTime")
         CHECK(DateTime::daysBetween(DateTime(Date(1970, 1, 1), Time(23, 2, 36)), DateTime(Date(1971, 1, 1), Time(23, 2, 36))) == 365);
     }
 
+    TEST_CASE("rounding")
+    {
+        SUBCASE("fixed units")
+        {
+            const DateTime dt(Date(2024, 8, 15), Time(13, 47, 31, 500));
+            CHECK(dt.floor(minutes(5)) == DateTime(Date(2024, 8, 15), Time(13, 45, 0)));
+            CHECK(dt.ceil(minutes(5)) == DateTime(Date(2024, 8, 15), Time(13, 50, 0)));
+            CHECK(dt.round(minutes(5)) == DateTime(Date(2024, 8, 15), Time(13, 50, 0)));
+            CHECK(dt.round(minutes(10)) == DateTime(Date(2024, 8, 15), Time(13, 50, 0)));
+            CHECK(dt.round(minutes(30)) == DateTime(Date(2024, 8, 15), Time(14, 0, 0)));
+            CHECK(dt.round(seconds(1)) == DateTime(Date(2024, 8, 15), Time(13, 47, 32)));
+            CHECK(dt.floor(hours(1)) == DateTime(Date(2024, 8, 15), Time(13, 0, 0)));
+            CHECK(dt.ceil(hours(24)) == DateTime(Date(2024, 8, 16)));
+            CHECK(dt.floor(hours(48)) == DateTime(Date(2024, 8, 15)));
+            CHECK(dt.floor(hours(7)) == DateTime(Date(2024, 8, 15), Time(7, 0, 0)));
+            CHECK(DateTime(Date(2024, 8, 15), Time(13, 45, 0)).ceil(minutes(5)) == DateTime(Date(2024, 8, 15), Time(13, 45, 0)));
+        }
+        SUBCASE("before the epoch")
+        {
+            const DateTime dt(Date(1969, 12, 31), Time(23, 58, 0));
+            CHECK(dt.floor(minutes(5)) == DateTime(Date(1969, 12, 31), Time(23, 55, 0)));
+            CHECK(dt.round(minutes(5)) == DateTime(Date(1970, 1, 1)));
+            CHECK(dt.floor(hours(7)) == DateTime(Date(1969, 12, 31), Time(17, 0, 0)));
+            CHECK(DateTime(Date(1969, 12, 31), Time(23, 59, 59, 999)).floor(milliseconds(1)) == DateTime(Date(1969, 12, 31), Time(23, 59, 59, 999)));
+        }
+        SUBCASE("far from the epoch")
+        {
+            // Beyond the range of 64-bit nanoseconds, the remainders are computed from the days and the time of day.
+            const DateTime dt(Date(5000, 3, 1), Time(12, 34, 56));
+            for (const auto unit : { nanoseconds(7), nanoseconds(hours(7)) + nanoseconds(1), nanoseconds(hours(24 * 365)) + seconds(1) }) {
+                const DateTime floored = dt.floor(unit);
+                CHECK(floored <= dt);
+                CHECK(dt < floored.addDuration(unit));
+                CHECK(floored.floor(unit) == floored);
+                CHECK(dt.ceil(unit) == floored.addDuration(unit));
+            }
+            const auto hoursSinceEpoch = [](const DateTime& dt) { return dt.toDaysSinceEpoch() * 24 + dt.hour(); };
+            CHECK(hoursSinceEpoch(dt.floor(hours(7))) % 7 == 0);
+            CHECK(hoursSinceEpoch(dt) - hoursSinceEpoch(dt.floor(hours(7))) < 7);
+            CHECK(hoursSinceEpoch(DateTime(Date(-5000, 3, 1), Time(12, 34, 56)).floor(hours(7))) % 7 == 0);
+        }
+        SUBCASE("calendar units")
+        {
+            const DateTime dt(Date(2024, 8, 15), Time(13, 47, 31));
+            CHECK(dt.floor(DateTime::CalendarUnit::Week) == DateTime(Date(2024, 8, 12)));
+            CHECK(dt.ceil(DateTime::CalendarUnit::Week) == DateTime(Date(2024, 8, 19)));
+            CHECK(dt.round(DateTime::CalendarUnit::Week) == DateTime(Date(2024, 8, 19)));
+            CHECK(dt.floor(DateTime::CalendarUnit::Month) == DateTime(Date(2024, 8, 1)));
+            CHECK(dt.round(DateTime::CalendarUnit::Month) == DateTime(Date(2024, 8, 1)));
+            CHECK(dt.floor(DateTime::CalendarUnit::Quarter) == DateTime(Date(2024, 7, 1)));
+            CHECK(dt.ceil(DateTime::CalendarUnit::Year) == DateTime(Date(2025, 1, 1)));
+            CHECK(DateTime(Date(2024, 8, 1)).ceil(DateTime::CalendarUnit::Month) == DateTime(Date(2024, 8, 1)));
+            CHECK(DateTime(Date(2024, 8, 31), Time(0, 0, 1)).ceil(DateTime::CalendarUnit::Month) == DateTime(Date(2024, 9, 1)));
+            CHECK(DateTime(Date(2024, 8, 16), Time(12, 0, 0)).round(DateTime::CalendarUnit::Month) == DateTime(Date(2024, 9, 1)));
+            CHECK(DateTime(Date(2024, 8, 16), Time(11, 59, 59)).round(DateTime::CalendarUnit::Month) == DateTime(Date(2024, 8, 1)));
+        }
+        SUBCASE("invalid")
+        {
+            CHECK(DateTime().floor(hours(1)).isValid() == false);
+            CHECK(DateTime().round(DateTime::CalendarUnit::Year).isValid() == false);
+            CHECK(DateTime(Date(2024, 1, 1)).ceil(nanoseconds(0)).isValid() == false);
+        }
+    }
+
+#ifdef XCLOX_HAS_CONSTEXPR14
+    TEST_CASE("constant expressions")
+    {
+        using namespace xclox::literals;
+
+        static_assert(DateTime::epoch() == DateTime(nanoseconds::zero()), "");
+        static_assert(DateTime(seconds(-1)) == DateTime(Date(1969, 12, 31), Time(23, 59, 59)), "");
+        static_assert(DateTime(2024_y / 3 / 1, Time(12, 0, 0)).toSecondsSinceEpoch() == 1709294400, "");
+        static_assert(DateTime(2024_y / 12 / 31, Time(23, 0, 0)).addHours(1) == DateTime(2025_y / 1 / 1), "");
+        static_assert(DateTime(2024_y / 1 / 1).subtractNanoseconds(1).year() == 2023, "");
+        static_assert(DateTime(2024_y / 3 / 1) - DateTime(2024_y / 2 / 1) == hours(29 * 24), "");
+        static_assert(DateTime(2024_y / 3 / 1) > DateTime(2024_y / 2 / 29, Time(23, 59, 59)), "");
+    }
+#endif
+
     TEST_CASE("serialization & deserialization")
     {
         DateTime dt;
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/format.hpp"
+
+using namespace xclox;
+
+TEST_SUITE("Format")
+{
+    auto compare = [](const Format::Token& token, char flag, int count, bool isFlag, bool isPattern) {
+        return token.flag == flag && token.count == count && token.isFlag == isFlag && token.isPattern == isPattern;
+    };
+
+    TEST_CASE("constructible")
+    {
+        SUBCASE("default")
+        {
+            Format f;
+
+            CHECK(f.isEmpty() == true);
+            CHECK(f.tokens().empty() == true);
+            CHECK(f.toString() == "");
+        }
+        SUBCASE("format string")
+        {
+            Format f("yyyy-MM-dd hh:mm:ss.fff");
+
+            CHECK(f.isEmpty() == false);
+            CHECK(f.toString() == "yyyy-MM-dd hh:mm:ss.fff");
+            CHECK(f.tokens().size() == 13);
+        }
+    }
+
+    TEST_CASE("copyable")
+    {
+        Format f1("hh:mm");
+
+        SUBCASE("construction")
+        {
+            Format f2(f1);
+            Format f3(std::move(f1));
+
+            CHECK(f2.toString() == "hh:mm");
+            CHECK(f3.tokens().size() == 3);
+        }
+        SUBCASE("assignment")
+        {
+            Format f2 = f1;
+            Format f3 = std::move(f1);
+
+            CHECK(f2.toString() == "hh:mm");
+            CHECK(f3.tokens().size() == 3);
+        }
+    }
+
+    TEST_CASE("tokenization")
+    {
+        SUBCASE("runs of identical characters")
+        {
+            const Format format("yyyy-MM-dd");
+            const auto& tokens = format.tokens();
+
+            REQUIRE(tokens.size() == 5);
+            CHECK(compare(tokens[0], 'y', 4, true, true));
+            CHECK(compare(tokens[1], '-', 1, false, false));
+            CHECK(compare(tokens[2], 'M', 2, true, true));
+            CHECK(compare(tokens[3], '-', 1, false, false));
+            CHECK(compare(tokens[4], 'd', 2, true, true));
+        }
+        SUBCASE("literal runs")
+        {
+            const Format format("hh -- mm");
+            const auto& tokens = format.tokens();
+
+            REQUIRE(tokens.size() == 5);
+            CHECK(compare(tokens[2], '-', 2, false, false));
+        }
+        SUBCASE("flags with unrecognized length")
+        {
+            const Format format("yyy ffffffffff aa");
+            const auto& tokens = format.tokens();
+
+            REQUIRE(tokens.size() == 5);
+            CHECK(compare(tokens[0], 'y', 3, true, false));
+            CHECK(compare(tokens[2], 'f', 10, true, false));
+            CHECK(compare(tokens[4], 'a', 2, true, false));
+        }
+    }
+} // TEST_SUITE
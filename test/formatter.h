@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/formatter.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace xclox;
+
+TEST_SUITE("CachedFormatter")
+{
+    TEST_CASE("constructible")
+    {
+        SUBCASE("default")
+        {
+            CHECK(CachedFormatter().format().toString() == "yyyy-MM-dd hh:mm:ss.fff");
+        }
+        SUBCASE("format string")
+        {
+            CHECK(CachedFormatter("hh:mm").format().toString() == "hh:mm");
+        }
+        SUBCASE("precompiled format")
+        {
+            CHECK(CachedFormatter(Format("yyyy-MM-dd")).format().toString() == "yyyy-MM-dd");
+        }
+    }
+
+    TEST_CASE("formatting")
+    {
+        const CachedFormatter formatter("dddd, d MMMM yyyy hh:mm:ss.fff (ffffff) a");
+        const DateTime dt(Date(2024, 2, 18), Time(21, 46, 7, 987));
+        SUBCASE("same second")
+        {
+            CHECK(formatter.toString(dt) == "Sunday, 18 February 2024 21:46:07.987 (987000) pm");
+            CHECK(formatter.toString(dt.addMicroseconds(12)) == "Sunday, 18 February 2024 21:46:07.987 (987012) pm");
+            CHECK(formatter.toString(dt.subtractMilliseconds(987)) == "Sunday, 18 February 2024 21:46:07.000 (000000) pm");
+        }
+        SUBCASE("next second")
+        {
+            CHECK(formatter.toString(dt) == "Sunday, 18 February 2024 21:46:07.987 (987000) pm");
+            CHECK(formatter.toString(dt.addMilliseconds(13)) == "Sunday, 18 February 2024 21:46:08.000 (000000) pm");
+        }
+        SUBCASE("next day")
+        {
+            CHECK(formatter.toString(dt) == "Sunday, 18 February 2024 21:46:07.987 (987000) pm");
+            CHECK(formatter.toString(dt.addHours(3)) == "Monday, 19 February 2024 00:46:07.987 (987000) am");
+        }
+        SUBCASE("alternating formatters")
+        {
+            const CachedFormatter other("yyyy-MM-dd hh:mm:ss.fff");
+            CHECK(formatter.toString(dt) == "Sunday, 18 February 2024 21:46:07.987 (987000) pm");
+            CHECK(other.toString(dt) == "2024-02-18 21:46:07.987");
+            CHECK(formatter.toString(dt) == "Sunday, 18 February 2024 21:46:07.987 (987000) pm");
+        }
+        SUBCASE("characters")
+        {
+            char buffer[16];
+            CHECK(CachedFormatter("hh:mm:ss.fff").toChars(buffer, buffer + sizeof(buffer), dt) == 12);
+            CHECK(std::string(buffer, 12) == "21:46:07.987");
+        }
+        SUBCASE("too small range")
+        {
+            char buffer[10] = { 0 };
+            CHECK(CachedFormatter("hh:mm:ss.fff").toChars(buffer, buffer + 10, dt) == 12);
+            CHECK(std::string(buffer, 10) == "21:46:07.9");
+        }
+        SUBCASE("length only")
+        {
+            CHECK(CachedFormatter("hh:mm:ss.fff").toChars(nullptr, nullptr, dt) == 12);
+        }
+        SUBCASE("invalid datetime")
+        {
+            CHECK(formatter.toString(DateTime()) == "");
+        }
+        SUBCASE("same as DateTime::toString")
+        {
+            const Format format("yyyy-MM-dd hh:mm:ss.fffffffff");
+            const CachedFormatter cached(format);
+            DateTime value(Date(1999, 12, 31), Time(23, 59, 58));
+            for (int i = 0; i < 1000; ++i) {
+                value = value.addNanoseconds(i * 7919LL * 1000 + 13);
+                CHECK(cached.toString(value) == value.toString(format));
+            }
+        }
+    }
+
+    TEST_CASE("thread safety")
+    {
+        const CachedFormatter formatter("yyyy-MM-dd hh:mm:ss.ffffff");
+        std::vector<int> mismatches(4, 0);
+        std::vector<std::thread> threads;
+        for (size_t t = 0; t < mismatches.size(); ++t) {
+            threads.emplace_back([&formatter, &mismatches, t]() {
+                DateTime value(Date(2000 + static_cast<int>(t), 1, 1), Time(0, 0, 0));
+                for (int i = 0; i < 2000; ++i) {
+                    value = value.addMicroseconds(997);
+                    if (formatter.toString(value) != value.toString("yyyy-MM-dd hh:mm:ss.ffffff"))
+                        ++mismatches[t];
+                }
+            });
+        }
+        for (auto& thread : threads)
+            thread.join();
+        CHECK(mismatches == std::vector<int>(mismatches.size(), 0));
+    }
+}
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/http.hpp"
+
+#include <thread>
+#include <vector>
+
+using namespace xclox;
+
+TEST_SUITE("HttpFormat")
+{
+    TEST_CASE("formatting")
+    {
+        const DateTime dt(Date(1994, 11, 6), Time(8, 49, 37, 987));
+        SUBCASE("IMF-fixdate")
+        {
+            CHECK(HttpFormat::toString(dt) == "Sun, 06 Nov 1994 08:49:37 GMT");
+            CHECK(HttpFormat::toString(DateTime(Date(2024, 2, 29), Time(23, 0, 1))) == "Thu, 29 Feb 2024 23:00:01 GMT");
+            CHECK(HttpFormat::toString(dt) == dt.toString("ddd, dd MMM yyyy hh:mm:ss") + " GMT");
+        }
+        SUBCASE("characters")
+        {
+            char buffer[HttpFormat::Size];
+            CHECK(HttpFormat::toChars(buffer, buffer + sizeof(buffer), dt) == 29);
+            CHECK(std::string(buffer, sizeof(buffer)) == "Sun, 06 Nov 1994 08:49:37 GMT");
+        }
+        SUBCASE("too small range")
+        {
+            char buffer[10] = { 0 };
+            CHECK(HttpFormat::toChars(buffer, buffer + 10, dt) == 29);
+            CHECK(std::string(buffer, 10) == "Sun, 06 No");
+        }
+        SUBCASE("invalid datetime")
+        {
+            CHECK(HttpFormat::toString(DateTime()) == "");
+        }
+    }
+
+    TEST_CASE("parsing")
+    {
+        const DateTime dt(Date(1994, 11, 6), Time(8, 49, 37));
+        SUBCASE("IMF-fixdate")
+        {
+            CHECK(HttpFormat::fromString("Sun, 06 Nov 1994 08:49:37 GMT") == dt);
+            CHECK(HttpFormat::fromString("sun, 06 nov 1994 08:49:37 GMT") == dt);
+        }
+        SUBCASE("RFC 850")
+        {
+            CHECK(HttpFormat::fromString("Sunday, 06-Nov-94 08:49:37 GMT") == dt);
+            CHECK(HttpFormat::fromString("Wednesday, 09-Nov-94 08:49:37 GMT") == DateTime(Date(1994, 11, 9), Time(8, 49, 37)));
+            CHECK(internal::expandHttpYear(94, 2024) == 1994);
+            CHECK(internal::expandHttpYear(74, 2024) == 2074);
+            CHECK(internal::expandHttpYear(75, 2024) == 1975);
+            CHECK(internal::expandHttpYear(1, 2099) == 2101);
+            CHECK(internal::expandHttpYear(99, 2101) == 2099);
+        }
+        SUBCASE("asctime")
+        {
+            CHECK(HttpFormat::fromString("Sun Nov  6 08:49:37 1994") == dt);
+            CHECK(HttpFormat::fromString("Sun Nov 16 08:49:37 1994") == DateTime(Date(1994, 11, 16), Time(8, 49, 37)));
+        }
+        SUBCASE("malformed")
+        {
+            CHECK(HttpFormat::fromString("").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun, 06 Nov 1994 08:49:37 UTC").isValid() == false);
+            CHECK(HttpFormat::fromString("Abc, 06 Nov 1994 08:49:37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun, 06 Nob 1994 08:49:37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun, 31 Nov 1994 08:49:37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun, 06 Nov 1994 24:49:37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun, 06 Nov 1994 08-49-37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun, 06-Nov-94 08:49:37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sundae, 06-Nov-94 08:49:37 GMT").isValid() == false);
+            CHECK(HttpFormat::fromString("Sun Nov  x 08:49:37 1994").isValid() == false);
+        }
+        SUBCASE("round trip")
+        {
+            DateTime value(Date(1970, 1, 1), Time(0, 0, 0));
+            for (int i = 0; i < 500; ++i, value = value.addSeconds(7919 * 3607)) {
+                CHECK(HttpFormat::fromString(HttpFormat::toString(value)) == value);
+            }
+        }
+    }
+
+    TEST_CASE("current datetime")
+    {
+        SUBCASE("same as DateTime::current")
+        {
+            const DateTime before = DateTime::current().subtractSeconds(1);
+            const DateTime current = HttpFormat::fromString(HttpFormat::current());
+            const DateTime after = DateTime::current().addSeconds(1);
+            CHECK(before <= current);
+            CHECK(current <= after);
+        }
+        SUBCASE("cache")
+        {
+            internal::HttpDateCache cache;
+            char buffer[HttpFormat::Size];
+            CHECK(cache.read(784111777, buffer) == false);
+            cache.write(784111777, "Sun, 06 Nov 1994 08:49:37 GMT");
+            CHECK(cache.read(784111777, buffer));
+            CHECK(std::string(buffer, sizeof(buffer)) == "Sun, 06 Nov 1994 08:49:37 GMT");
+            CHECK(cache.read(784111778, buffer) == false);
+            cache.write(784111776, "Sun, 06 Nov 1994 08:49:36 GMT");
+            CHECK(cache.read(784111776, buffer) == false);
+            CHECK(cache.read(784111777, buffer));
+        }
+        SUBCASE("shared by threads")
+        {
+            std::vector<int> invalidCounts(4, 0);
+            std::vector<std::thread> threads;
+            for (size_t t = 0; t < invalidCounts.size(); ++t) {
+                threads.emplace_back([&invalidCounts, t]() {
+                    for (int i = 0; i < 10000; ++i) {
+                        if (!HttpFormat::fromString(HttpFormat::current()).isValid())
+                            ++invalidCounts[t];
+                    }
+                });
+            }
+            for (auto& thread : threads)
+                thread.join();
+            CHECK(invalidCounts == std::vector<int>(invalidCounts.size(), 0));
+        }
+    }
+}
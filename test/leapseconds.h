@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/leapseconds.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+using namespace xclox;
+
+namespace {
+
+const std::string leapSecondsList = "#\tleap-seconds.list\n"
+                                    "#$\t 3676924800\n"
+                                    "#@\t 3707596800\n"
+                                    "3439756800\t34\t# 1 Jan 2009\n"
+                                    "3550089600\t35\t# 1 Jul 2012\n"
+                                    "\n"
+                                    "3644697600\t36\t# 1 Jul 2015\n"
+                                    "3692217600\t37\t# 1 Jan 2017\n"
+                                    "#h\t16edd0f0 3666784f 37db6bdd e74ced87 59af48f1\n";
+
+DateTime utcDateTime(int year, int month, int day, int hour, int minute = 0, int second = 0)
+{
+    return DateTime(Date(year, month, day), Time(hour, minute, second));
+}
+
+} // namespace
+
+TEST_SUITE("LeapSeconds")
+{
+    TEST_CASE("invalid")
+    {
+        const LeapSeconds table;
+        CHECK_FALSE(table.isValid());
+        CHECK(table.size() == 0);
+        CHECK_FALSE(table.expiration().isValid());
+        CHECK(table.offset(utcDateTime(2024, 1, 1, 0)) == LeapSeconds::Seconds(0));
+        CHECK(table.leapSecond(Date(2016, 12, 31)) == 0);
+        CHECK_FALSE(table.toTai(utcDateTime(2024, 1, 1, 0)).isValid());
+        CHECK_FALSE(table.fromGps(utcDateTime(2024, 1, 1, 0)).isValid());
+        CHECK_FALSE(LeapSeconds::builtIn().toTai(DateTime()).isValid());
+        CHECK_FALSE(LeapSeconds::fromList("").isValid());
+        CHECK_FALSE(LeapSeconds::fromList("# comment only\n").isValid());
+        CHECK_FALSE(LeapSeconds::fromList("2272060800 10\n2272060800 11\n").isValid());
+        CHECK_FALSE(LeapSeconds::fromList("2272060800 10\n2287785600 12\n").isValid());
+        CHECK_FALSE(LeapSeconds::fromList("2272060800 ten\n").isValid());
+        CHECK_FALSE(LeapSeconds::fromList("#@ never\n2272060800 10\n").isValid());
+        CHECK_FALSE(LeapSeconds::fromFile("").isValid());
+        std::vector<std::int64_t> values = { -1, 0, 1000000000 }, output(3);
+        table.toGps(values.data(), values.size(), output.data());
+        CHECK(output == values);
+    }
+
+    TEST_CASE("built-in table")
+    {
+        const LeapSeconds table = LeapSeconds::builtIn();
+        CHECK(table.isValid());
+        CHECK(table.size() == 28);
+        CHECK(table.expiration() == utcDateTime(2026, 6, 28, 0));
+        CHECK(table.offset(utcDateTime(1960, 1, 1, 0)) == LeapSeconds::Seconds(10));
+        CHECK(table.offset(utcDateTime(1972, 6, 30, 23, 59, 59)) == LeapSeconds::Seconds(10));
+        CHECK(table.offset(utcDateTime(1972, 7, 1, 0)) == LeapSeconds::Seconds(11));
+        CHECK(table.offset(utcDateTime(2024, 7, 1, 12)) == LeapSeconds::Seconds(37));
+        CHECK(table.toTai(utcDateTime(2024, 7, 1, 12)) == utcDateTime(2024, 7, 1, 12, 0, 37));
+        CHECK(table.toGps(utcDateTime(2024, 7, 1, 12)) == utcDateTime(2024, 7, 1, 12, 0, 18));
+        CHECK(table.fromGps(utcDateTime(2024, 7, 1, 12, 0, 18)) == utcDateTime(2024, 7, 1, 12));
+        CHECK(table.fromTai(utcDateTime(2024, 7, 1, 12, 0, 37)) == utcDateTime(2024, 7, 1, 12));
+        CHECK(table.toGps(utcDateTime(1980, 1, 6, 0)) == utcDateTime(1980, 1, 6, 0));
+        CHECK(table.leapSecond(Date(1972, 6, 30)) == 1);
+        CHECK(table.leapSecond(Date(2016, 12, 31)) == 1);
+        CHECK(table.leapSecond(Date(2017, 1, 1)) == 0);
+        CHECK(table.leapSecond(Date(1971, 12, 31)) == 0);
+        CHECK(table.leapSecond(Date(2024, 6, 30)) == 0);
+    }
+
+    TEST_CASE("leap seconds")
+    {
+        const LeapSeconds table = LeapSeconds::builtIn();
+        CHECK(table.toTai(utcDateTime(2016, 12, 31, 23, 59, 59)) == utcDateTime(2017, 1, 1, 0, 0, 35));
+        CHECK(table.toTai(utcDateTime(2017, 1, 1, 0)) == utcDateTime(2017, 1, 1, 0, 0, 37));
+        CHECK(table.fromTai(utcDateTime(2017, 1, 1, 0, 0, 35)) == utcDateTime(2016, 12, 31, 23, 59, 59));
+        CHECK(table.fromTai(utcDateTime(2017, 1, 1, 0, 0, 36)) == utcDateTime(2016, 12, 31, 23, 59, 59));
+        CHECK(table.fromTai(utcDateTime(2017, 1, 1, 0, 0, 37)) == utcDateTime(2017, 1, 1, 0));
+        CHECK(table.fromGps(utcDateTime(2017, 1, 1, 0, 0, 17)) == utcDateTime(2016, 12, 31, 23, 59, 59));
+        CHECK(table.fromGps(utcDateTime(2017, 1, 1, 0, 0, 18)) == utcDateTime(2017, 1, 1, 0));
+
+        const LeapSeconds deleted = LeapSeconds::fromList("3692217600 37\n3723753600 36\n");
+        REQUIRE(deleted.isValid());
+        CHECK(deleted.leapSecond(Date(2017, 12, 31)) == -1);
+        CHECK(deleted.toTai(utcDateTime(2017, 12, 31, 23, 59, 58)) == utcDateTime(2018, 1, 1, 0, 0, 35));
+        CHECK(deleted.toTai(utcDateTime(2018, 1, 1, 0)) == utcDateTime(2018, 1, 1, 0, 0, 36));
+        CHECK(deleted.fromTai(utcDateTime(2018, 1, 1, 0, 0, 35)) == utcDateTime(2017, 12, 31, 23, 59, 58));
+        CHECK(deleted.fromTai(utcDateTime(2018, 1, 1, 0, 0, 36)) == utcDateTime(2018, 1, 1, 0));
+    }
+
+    TEST_CASE("list")
+    {
+        const LeapSeconds table = LeapSeconds::fromList(leapSecondsList);
+        REQUIRE(table.isValid());
+        CHECK(table.size() == 4);
+        CHECK(table.expiration() == utcDateTime(2017, 6, 28, 0));
+        CHECK(table.offset(utcDateTime(1972, 7, 1, 0)) == LeapSeconds::Seconds(34));
+        CHECK(table.offset(utcDateTime(2012, 7, 1, 0)) == LeapSeconds::Seconds(35));
+        CHECK(table.offset(utcDateTime(2015, 7, 1, 0)) == LeapSeconds::Seconds(36));
+        CHECK(table.leapSecond(Date(2015, 6, 30)) == 1);
+
+        const LeapSeconds system = LeapSeconds::fromFile();
+        if (system.isValid()) {
+            const LeapSeconds builtIn = LeapSeconds::builtIn();
+            CHECK(system.size() >= builtIn.size());
+            for (DateTime utc = utcDateTime(1970, 1, 1, 0); utc < builtIn.expiration() && utc < system.expiration(); utc = utc.addDays(13))
+                CHECK(system.offset(utc) == builtIn.offset(utc));
+        }
+    }
+
+    TEST_CASE("batch conversions")
+    {
+        const LeapSeconds table = LeapSeconds::builtIn();
+        const std::int64_t second = 1000000000;
+        std::vector<std::int64_t> values;
+        for (long seed = 5, i = 0; i < 1000; ++i) {
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+            values.push_back(((static_cast<std::int64_t>(seed) << 1) % 2524608000LL - 315619200LL) * second + seed % second); // 1960 through 2039
+        }
+        for (std::int64_t time : { 1483228800LL, 78796800LL })
+            for (std::int64_t offset : { -38 * second, -37 * second, -second, std::int64_t(-1), std::int64_t(0), second, 18 * second })
+                values.push_back(time * second + offset);
+        const auto check = [&](const std::vector<std::int64_t>& input) {
+            std::vector<std::int64_t> tai(input.size()), gps(input.size()), utc(input.size()), inPlace = input;
+            table.toTai(input.data(), input.size(), tai.data());
+            table.toGps(input.data(), input.size(), gps.data());
+            table.toGps(inPlace.data(), inPlace.size(), inPlace.data());
+            long mismatches = 0;
+            for (size_t i = 0; i < input.size(); ++i) {
+                const DateTime datetime = DateTime(DateTime::Nanoseconds(input[i]));
+                mismatches += DateTime(DateTime::Nanoseconds(tai[i])) != table.toTai(datetime);
+                mismatches += DateTime(DateTime::Nanoseconds(gps[i])) != table.toGps(datetime);
+                mismatches += inPlace[i] != gps[i];
+            }
+            table.fromTai(input.data(), input.size(), tai.data());
+            table.fromGps(input.data(), input.size(), gps.data());
+            for (size_t i = 0; i < input.size(); ++i) {
+                const DateTime datetime = DateTime(DateTime::Nanoseconds(input[i]));
+                mismatches += DateTime(DateTime::Nanoseconds(tai[i])) != table.fromTai(datetime);
+                mismatches += DateTime(DateTime::Nanoseconds(gps[i])) != table.fromGps(datetime);
+            }
+            CHECK(mismatches == 0);
+        };
+        check(values);
+        std::sort(values.begin(), values.end());
+        check(values);
+    }
+}
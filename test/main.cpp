@@ -10,12 +10,36 @@
 
 #include "version.h"
 
+#include "format.h"
+
 #include "time.h"
 
 #include "date.h"
 
 #include "datetime.h"
 
+#include "compact.h"
+
+#include "column.h"
+
+#include "batch.h"
+
+#include "range.h"
+
+#include "recurrence.h"
+
+#include "calendar.h"
+
+#include "timezone.h"
+
+#include "tzdb.h"
+
+#include "leapseconds.h"
+
+#include "formatter.h"
+
+#include "http.h"
+
 #include "ntp/timestamp.h"
 
 #include "ntp/coder.h"
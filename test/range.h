@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/range.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+using namespace xclox;
+
+TEST_SUITE("DateRange")
+{
+    TEST_CASE("empty")
+    {
+        CHECK(DateRange().empty());
+        CHECK(DateRange().begin() == DateRange().end());
+        CHECK(DateRange(Date(2024, 1, 1), Date(2024, 1, 1)).empty());
+        CHECK(DateRange(Date(2024, 1, 2), Date(2024, 1, 1)).empty());
+        CHECK(DateRange(Date(2024, 1, 1), Date(2024, 2, 1), Date::Days(0)).empty());
+        CHECK(DateRange(Date(2024, 1, 1), Date(2024, 2, 1), Date::Days(-1)).empty());
+        CHECK(DateRange(Date(), Date(2024, 2, 1)).empty());
+        CHECK(DateRange(Date(2024, 1, 1), Date()).empty());
+    }
+
+    TEST_CASE("size")
+    {
+        CHECK(DateRange(Date(2024, 1, 1), Date(2025, 1, 1)).size() == 366);
+        CHECK(DateRange(Date(2024, 1, 1), Date(2025, 1, 1), Date::Weeks(1)).size() == 53);
+        CHECK(DateRange(Date(2024, 1, 1), Date(2024, 1, 8), Date::Weeks(1)).size() == 1);
+        CHECK(DateRange(Date(2024, 1, 1), Date(2024, 1, 9), Date::Weeks(1)).size() == 2);
+    }
+
+    TEST_CASE("every day")
+    {
+        SUBCASE("leap year")
+        {
+            Date expected(2024, 1, 1);
+            for (const Date& date : DateRange(Date(2024, 1, 1), Date(2025, 1, 1))) {
+                CHECK(date == expected);
+                expected = expected.addDays(1);
+            }
+            CHECK(expected == Date(2025, 1, 1));
+        }
+        SUBCASE("across the common era")
+        {
+            const DateRange range(Date(-1, 12, 25), Date(1, 1, 8));
+            CHECK(range.size() == 14);
+            CHECK(*std::next(range.begin(), 6) == Date(-1, 12, 31));
+            CHECK(*std::next(range.begin(), 7) == Date(1, 1, 1));
+            CHECK(*std::prev(std::next(range.begin(), 7)) == Date(-1, 12, 31));
+        }
+        SUBCASE("backwards")
+        {
+            const DateRange range(Date(2023, 2, 20), Date(2023, 3, 10));
+            std::vector<Date> dates(range.begin(), range.end());
+            std::vector<Date> reversed;
+            for (auto it = range.end(); it != range.begin();)
+                reversed.push_back(*--it);
+            std::reverse(reversed.begin(), reversed.end());
+            CHECK(reversed == dates);
+        }
+        SUBCASE("reverse iterators")
+        {
+            const DateRange range(Date(2023, 2, 20), Date(2023, 3, 10));
+            std::vector<Date> dates(range.begin(), range.end());
+            std::reverse(dates.begin(), dates.end());
+            const std::vector<Date> reversed(std::reverse_iterator<DateRange::Iterator>(range.end()), std::reverse_iterator<DateRange::Iterator>(range.begin()));
+            CHECK(reversed == dates);
+            std::vector<Date> copied;
+            std::reverse_copy(range.begin(), range.end(), std::back_inserter(copied));
+            CHECK(copied == dates);
+            CHECK(std::reverse_iterator<DateRange::Iterator>(range.end())->day() == 9);
+        }
+    }
+
+    TEST_CASE("steps")
+    {
+        for (long step : { 2, 7, 30, 31, 32, 365, 1000 }) {
+            const DateRange range(Date(1899, 6, 1), Date(2101, 3, 1), Date::Days(step));
+            Date expected(1899, 6, 1);
+            std::size_t count = 0;
+            for (const Date& date : range) {
+                CHECK(date == expected);
+                expected = expected.addDays(step);
+                ++count;
+            }
+            CHECK(count == range.size());
+            CHECK(range[range.size() - 1] < Date(2101, 3, 1));
+        }
+    }
+
+    TEST_CASE("random access")
+    {
+        const DateRange range(Date(2000, 1, 1), Date(2100, 1, 1), Date::Weeks(1));
+        auto it = range.begin();
+        CHECK(it[0] == Date(2000, 1, 1));
+        CHECK(it[52] == Date(2000, 12, 30));
+        CHECK(*(it + 52) == Date(2000, 12, 30));
+        CHECK(*(52 + it) == Date(2000, 12, 30));
+        it += 100;
+        CHECK(*it == Date(2001, 12, 1));
+        it -= 48;
+        CHECK(*it == Date(2000, 12, 30));
+        CHECK(it - range.begin() == 52);
+        CHECK(range.begin() < it);
+        CHECK(it >= range.begin());
+        CHECK(std::distance(range.begin(), range.end()) == static_cast<std::ptrdiff_t>(range.size()));
+        CHECK(*std::find(range.begin(), range.end(), Date(2024, 2, 24)) == Date(2024, 2, 24));
+        CHECK(std::find(range.begin(), range.end(), Date(2024, 2, 25)) == range.end());
+        CHECK(*std::lower_bound(range.begin(), range.end(), Date(2024, 2, 25)) == Date(2024, 3, 2));
+        CHECK(range[1] == Date(2000, 1, 8));
+    }
+
+    TEST_CASE("long steps")
+    {
+        const DateRange range(Date(2024, 1, 1), Date(2025, 1, 1), Date::Days(std::numeric_limits<long>::max()));
+        CHECK(range.size() == 1);
+        CHECK(range.end() - range.begin() == 1);
+        CHECK(*(range.end() - 1) == Date(2024, 1, 1));
+        CHECK(*std::prev(range.end()) == Date(2024, 1, 1));
+        CHECK(range.step() == Date::Days(std::numeric_limits<long>::max()));
+    }
+}
+
+TEST_SUITE("DateTimeRange")
+{
+    TEST_CASE("empty")
+    {
+        const DateTime first(Date(2024, 1, 1), Time(9, 0, 0));
+        CHECK(DateTimeRange().empty());
+        CHECK(DateTimeRange(first, first, std::chrono::minutes(1)).empty());
+        CHECK(DateTimeRange(first, first.addHours(1), std::chrono::minutes(0)).empty());
+        CHECK(DateTimeRange(first, first.subtractHours(1), std::chrono::minutes(1)).empty());
+        CHECK(DateTimeRange(DateTime(), first, std::chrono::minutes(1)).empty());
+    }
+
+    TEST_CASE("quarter hours")
+    {
+        const DateTime first(Date(2023, 12, 31), Time(22, 10, 0));
+        const DateTimeRange range(first, DateTime(Date(2024, 3, 2), Time(0, 0, 0)), std::chrono::minutes(15));
+        DateTime expected = first;
+        std::size_t count = 0;
+        for (const DateTime& datetime : range) {
+            CHECK(datetime == expected);
+            expected = expected.addMinutes(15);
+            ++count;
+        }
+        CHECK(count == range.size());
+        CHECK(expected == DateTime(Date(2024, 3, 2), Time(0, 10, 0)));
+    }
+
+    TEST_CASE("steps")
+    {
+        const DateTime first(Date(-1, 11, 30), Time(23, 59, 59, std::chrono::nanoseconds(999999999)));
+        for (DateTime::Nanoseconds step : { DateTime::Nanoseconds(1), DateTime::Nanoseconds(std::chrono::hours(25)), DateTime::Nanoseconds(std::chrono::hours(24 * 40) + std::chrono::nanoseconds(7)) }) {
+            const DateTimeRange range(first, first.addDays(400), step);
+            const std::size_t count = std::min<std::size_t>(range.size(), 5000);
+            DateTime expected = first;
+            auto it = range.begin();
+            for (std::size_t i = 0; i < count; ++i, ++it) {
+                CHECK(*it == expected);
+                CHECK(range[i] == expected);
+                expected = expected.addDuration(step);
+            }
+            for (std::size_t i = count; i-- > 0;) {
+                --it;
+                expected = expected.subtractDuration(step);
+                CHECK(*it == expected);
+            }
+        }
+    }
+
+    TEST_CASE("long spans")
+    {
+        const DateTime first(Date(1800, 1, 1), Time(0, 0, 0));
+        SUBCASE("centuries")
+        {
+            const DateTimeRange range(first, DateTime(Date(2090, 1, 1), Time(0, 0, 0)), std::chrono::hours(24 * 365 * 100));
+            CHECK(range.size() == 3);
+            CHECK(*(range.end() - 1) == DateTime(first.date().addDays(73000), first.time()));
+            CHECK(*std::prev(range.end()) == range[2]);
+        }
+        SUBCASE("longer than 64-bit nanoseconds")
+        {
+            const DateTimeRange range(first, DateTime(Date(2200, 1, 1), Time(0, 0, 0)), std::chrono::hours(24 * 365));
+            CHECK(range.size() == 401);
+            CHECK(*(range.end() - 1) == DateTime(Date(2199, 9, 26), first.time()));
+            CHECK(range[400] == DateTime(first.date().addDays(365 * 400), first.time()));
+            CHECK(std::distance(range.begin(), range.end()) == 401);
+        }
+        SUBCASE("offsets longer than 64-bit nanoseconds")
+        {
+            const DateTimeRange range(first, DateTime(Date(2800, 1, 1), Time(0, 0, 0)), std::chrono::hours(23));
+            for (long i : { 0L, 100000L, 381000L, static_cast<long>(range.size()) - 1 })
+                CHECK(range[static_cast<std::size_t>(i)] == DateTime(first.date().addDays(static_cast<int>(23 * i / 24)), Time(static_cast<int>(23 * i % 24), 0, 0)));
+            CHECK(*(range.end() - 1) == range[range.size() - 1]);
+        }
+        SUBCASE("too many datetimes")
+        {
+            CHECK(DateTimeRange(first, DateTime(Date(2200, 1, 1), Time(0, 0, 0)), std::chrono::nanoseconds(1)).empty());
+            CHECK(DateTimeRange(first, DateTime(Date(2090, 1, 1), Time(0, 0, 0)), std::chrono::nanoseconds(1)).size() > 9000000000000000000ULL);
+        }
+    }
+
+    TEST_CASE("reverse iterators")
+    {
+        const DateTimeRange range(DateTime(Date(2024, 1, 1), Time(0, 0, 0)), DateTime(Date(2024, 1, 2), Time(0, 0, 0)), std::chrono::hours(6));
+        std::vector<int> hours;
+        for (auto it = std::reverse_iterator<DateTimeRange::Iterator>(range.end()); it != std::reverse_iterator<DateTimeRange::Iterator>(range.begin()); ++it)
+            hours.push_back(it->hour());
+        CHECK(hours == std::vector<int>({ 18, 12, 6, 0 }));
+        std::vector<DateTime> copied;
+        std::reverse_copy(range.begin(), range.end(), std::back_inserter(copied));
+        CHECK(copied == std::vector<DateTime>({ DateTime(Date(2024, 1, 1), Time(18, 0, 0)), DateTime(Date(2024, 1, 1), Time(12, 0, 0)), DateTime(Date(2024, 1, 1), Time(6, 0, 0)), DateTime(Date(2024, 1, 1), Time(0, 0, 0)) }));
+    }
+
+    TEST_CASE("random access")
+    {
+        const DateTime first(Date(1970, 1, 1), Time(12, 0, 0));
+        const DateTimeRange range(first, DateTime(Date(2200, 1, 1), Time(0, 0, 0)), std::chrono::hours(7));
+        CHECK(range.size() == 288019);
+        CHECK(range.begin()[4] == DateTime(Date(1970, 1, 2), Time(16, 0, 0)));
+        CHECK(*(range.end() - 1) == DateTime(Date(2199, 12, 31), Time(18, 0, 0)));
+        CHECK(std::prev(range.end()) - range.begin() == 288018);
+        CHECK(std::distance(range.begin(), range.end()) == 288019);
+        const std::vector<DateTime> datetimes(range.begin(), range.begin() + 10);
+        CHECK(datetimes.back() == DateTime(Date(1970, 1, 4), Time(3, 0, 0)));
+        CHECK(*std::lower_bound(range.begin(), range.end(), DateTime(Date(2024, 1, 1), Time(0, 0, 0))) >= DateTime(Date(2024, 1, 1), Time(0, 0, 0)));
+    }
+}
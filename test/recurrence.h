@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/recurrence.hpp"
+
+#include <limits>
+#include <vector>
+
+using namespace xclox;
+
+namespace {
+
+// Returns the first limit occurrences of the rule, starting at start.
+std::vector<DateTime> occurrencesOf(const std::string& rule, const DateTime& start, size_t limit = 20)
+{
+    const Recurrence recurrence = Recurrence::fromString(rule);
+    Recurrence::Cursor cursor = recurrence.occurrences(start);
+    std::vector<DateTime> result;
+    DateTime occurrence;
+    while (result.size() < limit && cursor.next(occurrence))
+        result.push_back(occurrence);
+    return result;
+}
+
+DateTime at(int year, int month, int day, int hour = 9, int minute = 0)
+{
+    return DateTime(Date(year, month, day), Time(hour, minute, 0));
+}
+
+} // namespace
+
+TEST_SUITE("Recurrence")
+{
+    TEST_CASE("parsing")
+    {
+        SUBCASE("valid")
+        {
+            const Recurrence rule = Recurrence::fromString("FREQ=WEEKLY;INTERVAL=2;COUNT=8;WKST=SU;BYDAY=TU,TH");
+            CHECK(rule.isValid());
+            CHECK(rule.frequency() == Recurrence::Frequency::Weekly);
+            CHECK(rule.interval() == 2);
+            CHECK(rule.count() == 8);
+            CHECK_FALSE(rule.until().isValid());
+            CHECK(Recurrence::fromString("RRULE:freq=monthly;byday=-1fr").isValid());
+            CHECK(Recurrence::fromString("FREQ=DAILY;UNTIL=19971224T000000Z").until() == at(1997, 12, 24, 0));
+            CHECK(Recurrence::fromString("FREQ=DAILY;UNTIL=19971224T000000").until() == at(1997, 12, 24, 0));
+            CHECK(Recurrence::fromString("FREQ=DAILY;UNTIL=19971224").until() == DateTime(Date(1997, 12, 24), Time(23, 59, 59, Time::Nanoseconds(999999999))));
+            CHECK(Recurrence::fromString("FREQ=YEARLY;BYWEEKNO=-1;BYYEARDAY=+100;BYSECOND=0,60").isValid());
+        }
+        SUBCASE("invalid")
+        {
+            CHECK_FALSE(Recurrence().isValid());
+            CHECK_FALSE(Recurrence::fromString("").isValid());
+            CHECK_FALSE(Recurrence::fromString("INTERVAL=2").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=FORTNIGHTLY").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;FREQ=DAILY").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;COUNT=2;UNTIL=19971224").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;INTERVAL=0").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;COUNT=-1").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;UNTIL=19970230").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;UNTIL=1997122").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYHOUR=24").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYMINUTE=1,").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYMONTH=0").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYMONTHDAY=32").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYDAY=XX").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYDAY=-MO").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;WKST=MON").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYFOO=1").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=MONTHLY;BYDAY=0MO").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=MONTHLY;BYDAY=54MO").isValid());
+            // constraints of RFC 5545 on the parts of each frequency.
+            CHECK_FALSE(Recurrence::fromString("FREQ=MONTHLY;BYWEEKNO=1").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;BYYEARDAY=1").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=WEEKLY;BYMONTHDAY=1").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=WEEKLY;BYDAY=1MO").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=YEARLY;BYWEEKNO=1;BYDAY=1MO").isValid());
+            CHECK(Recurrence::fromString("FREQ=HOURLY;BYYEARDAY=1").isValid());
+        }
+        SUBCASE("large numbers")
+        {
+            const Recurrence rule = Recurrence::fromString("FREQ=DAILY;COUNT=10000");
+            CHECK(rule.isValid());
+            CHECK(rule.count() == 10000);
+            const std::vector<DateTime> daily = occurrencesOf("FREQ=DAILY;COUNT=10000", at(2024, 1, 1), 20000);
+            CHECK(daily.size() == 10000);
+            CHECK(daily.back() == DateTime(Date(2024, 1, 1).addDays(9999), Time(9, 0, 0)));
+            CHECK(Recurrence::fromString("FREQ=HOURLY;INTERVAL=100000").interval() == 100000);
+            const std::string longest = std::to_string(std::numeric_limits<long>::max());
+            CHECK(Recurrence::fromString("FREQ=DAILY;COUNT=" + longest).count() == std::numeric_limits<long>::max());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;COUNT=" + longest + "0").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;INTERVAL=99999999999999999999").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;COUNT=1,2").isValid());
+            CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;INTERVAL=+2").isValid());
+            CHECK(occurrencesOf("FREQ=HOURLY;INTERVAL=100000;COUNT=3", at(2024, 1, 1)) == std::vector<DateTime> { at(2024, 1, 1), at(2024, 1, 1).addHours(100000), at(2024, 1, 1).addHours(200000) });
+            for (const char* frequency : { "YEARLY", "MONTHLY", "WEEKLY", "DAILY", "SECONDLY" }) {
+                const Recurrence sparse = Recurrence::fromString(std::string("FREQ=") + frequency + ";INTERVAL=" + longest);
+                CHECK(occurrencesOf(std::string("FREQ=") + frequency + ";INTERVAL=" + longest, at(2024, 1, 1)) == std::vector<DateTime> { at(2024, 1, 1) });
+                CHECK(occurrencesOf(std::string("FREQ=") + frequency + ";INTERVAL=" + longest, at(-5000, 1, 1)) == std::vector<DateTime> { at(-5000, 1, 1) });
+                CHECK_FALSE(sparse.next(at(2024, 1, 1), at(2030, 1, 1)).isValid());
+            }
+        }
+        SUBCASE("invalid rules and starts generate nothing")
+        {
+            CHECK(occurrencesOf("FREQ=SOMETIMES", at(1997, 9, 2)).empty());
+            CHECK(occurrencesOf("FREQ=DAILY", DateTime()).empty());
+            DateTime occurrence;
+            CHECK_FALSE(Recurrence::Cursor().next(occurrence));
+        }
+    }
+
+    // The examples of section 3.8.5.3 of RFC 5545.
+    TEST_CASE("RFC 5545 examples")
+    {
+        SUBCASE("daily for 10 occurrences")
+        {
+            const auto result = occurrencesOf("FREQ=DAILY;COUNT=10", at(1997, 9, 2));
+            REQUIRE(result.size() == 10);
+            CHECK(result.front() == at(1997, 9, 2));
+            CHECK(result.back() == at(1997, 9, 11));
+        }
+        SUBCASE("daily until December 24, 1997")
+        {
+            const auto result = occurrencesOf("FREQ=DAILY;UNTIL=19971224T000000Z", at(1997, 9, 2), 1000);
+            REQUIRE(result.size() == 113);
+            CHECK(result.back() == at(1997, 12, 23));
+        }
+        SUBCASE("every 10 days, 5 occurrences")
+        {
+            CHECK(occurrencesOf("FREQ=DAILY;INTERVAL=10;COUNT=5", at(1997, 9, 2)) == std::vector<DateTime> { at(1997, 9, 2), at(1997, 9, 12), at(1997, 9, 22), at(1997, 10, 2), at(1997, 10, 12) });
+        }
+        SUBCASE("every day in January, for 3 years")
+        {
+            const auto yearly = occurrencesOf("FREQ=YEARLY;UNTIL=20000131T140000Z;BYMONTH=1;BYDAY=SU,MO,TU,WE,TH,FR,SA", at(1998, 1, 1), 1000);
+            const auto daily = occurrencesOf("FREQ=DAILY;UNTIL=20000131T140000Z;BYMONTH=1", at(1998, 1, 1), 1000);
+            CHECK(yearly.size() == 93);
+            CHECK(yearly == daily);
+            CHECK(yearly[31] == at(1999, 1, 1));
+        }
+        SUBCASE("weekly for 10 occurrences")
+        {
+            const auto result = occurrencesOf("FREQ=WEEKLY;COUNT=10", at(1997, 9, 2));
+            REQUIRE(result.size() == 10);
+            CHECK(result[4] == at(1997, 9, 30));
+            CHECK(result.back() == at(1997, 11, 4));
+        }
+        SUBCASE("every other week on Tuesday and Sunday, depending on the start of the week")
+        {
+            CHECK(occurrencesOf("FREQ=WEEKLY;INTERVAL=2;COUNT=4;BYDAY=TU,SU;WKST=MO", at(1997, 8, 5)) == std::vector<DateTime> { at(1997, 8, 5), at(1997, 8, 10), at(1997, 8, 19), at(1997, 8, 24) });
+            CHECK(occurrencesOf("FREQ=WEEKLY;INTERVAL=2;COUNT=4;BYDAY=TU,SU;WKST=SU", at(1997, 8, 5)) == std::vector<DateTime> { at(1997, 8, 5), at(1997, 8, 17), at(1997, 8, 19), at(1997, 8, 31) });
+        }
+        SUBCASE("monthly on the first Friday for 10 occurrences")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;COUNT=10;BYDAY=1FR", at(1997, 9, 5)) == std::vector<DateTime> { at(1997, 9, 5), at(1997, 10, 3), at(1997, 11, 7), at(1997, 12, 5), at(1998, 1, 2), at(1998, 2, 6), at(1998, 3, 6), at(1998, 4, 3), at(1998, 5, 1), at(1998, 6, 5) });
+        }
+        SUBCASE("every other month on the first and last Sunday")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;INTERVAL=2;COUNT=10;BYDAY=1SU,-1SU", at(1997, 9, 7)) == std::vector<DateTime> { at(1997, 9, 7), at(1997, 9, 28), at(1997, 11, 2), at(1997, 11, 30), at(1998, 1, 4), at(1998, 1, 25), at(1998, 3, 1), at(1998, 3, 29), at(1998, 5, 3), at(1998, 5, 31) });
+        }
+        SUBCASE("monthly on the third-to-the-last day")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;BYMONTHDAY=-3", at(1997, 9, 28), 6) == std::vector<DateTime> { at(1997, 9, 28), at(1997, 10, 29), at(1997, 11, 28), at(1997, 12, 29), at(1998, 1, 29), at(1998, 2, 26) });
+        }
+        SUBCASE("every 18 months on the 10th through the 15th")
+        {
+            const auto result = occurrencesOf("FREQ=MONTHLY;INTERVAL=18;COUNT=10;BYMONTHDAY=10,11,12,13,14,15", at(1997, 9, 10));
+            REQUIRE(result.size() == 10);
+            CHECK(result[5] == at(1997, 9, 15));
+            CHECK(result[6] == at(1999, 3, 10));
+            CHECK(result.back() == at(1999, 3, 13));
+        }
+        SUBCASE("every other year on January, February, and March for 10 occurrences")
+        {
+            CHECK(occurrencesOf("FREQ=YEARLY;INTERVAL=2;COUNT=10;BYMONTH=1,2,3", at(1997, 3, 10)) == std::vector<DateTime> { at(1997, 3, 10), at(1999, 1, 10), at(1999, 2, 10), at(1999, 3, 10), at(2001, 1, 10), at(2001, 2, 10), at(2001, 3, 10), at(2003, 1, 10), at(2003, 2, 10), at(2003, 3, 10) });
+        }
+        SUBCASE("every third year on the 1st, 100th, and 200th day")
+        {
+            CHECK(occurrencesOf("FREQ=YEARLY;INTERVAL=3;COUNT=10;BYYEARDAY=1,100,200", at(1997, 1, 1)) == std::vector<DateTime> { at(1997, 1, 1), at(1997, 4, 10), at(1997, 7, 19), at(2000, 1, 1), at(2000, 4, 9), at(2000, 7, 18), at(2003, 1, 1), at(2003, 4, 10), at(2003, 7, 19), at(2006, 1, 1) });
+        }
+        SUBCASE("every 20th Monday of the year")
+        {
+            CHECK(occurrencesOf("FREQ=YEARLY;BYDAY=20MO", at(1997, 5, 19), 3) == std::vector<DateTime> { at(1997, 5, 19), at(1998, 5, 18), at(1999, 5, 17) });
+        }
+        SUBCASE("Monday of week number 20")
+        {
+            CHECK(occurrencesOf("FREQ=YEARLY;BYWEEKNO=20;BYDAY=MO", at(1997, 5, 12), 3) == std::vector<DateTime> { at(1997, 5, 12), at(1998, 5, 11), at(1999, 5, 17) });
+        }
+        SUBCASE("every Thursday in March")
+        {
+            CHECK(occurrencesOf("FREQ=YEARLY;BYMONTH=3;BYDAY=TH", at(1997, 3, 13), 7) == std::vector<DateTime> { at(1997, 3, 13), at(1997, 3, 20), at(1997, 3, 27), at(1998, 3, 5), at(1998, 3, 12), at(1998, 3, 19), at(1998, 3, 26) });
+        }
+        SUBCASE("every Friday the 13th")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;BYDAY=FR;BYMONTHDAY=13", at(1997, 9, 2), 5) == std::vector<DateTime> { at(1998, 2, 13), at(1998, 3, 13), at(1998, 11, 13), at(1999, 8, 13), at(2000, 10, 13) });
+        }
+        SUBCASE("U.S. Presidential Election Day")
+        {
+            CHECK(occurrencesOf("FREQ=YEARLY;INTERVAL=4;BYMONTH=11;BYDAY=TU;BYMONTHDAY=2,3,4,5,6,7,8", at(1996, 11, 5), 3) == std::vector<DateTime> { at(1996, 11, 5), at(2000, 11, 7), at(2004, 11, 2) });
+        }
+        SUBCASE("the third instance of Tuesday, Wednesday, or Thursday")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;COUNT=3;BYDAY=TU,WE,TH;BYSETPOS=3", at(1997, 9, 4)) == std::vector<DateTime> { at(1997, 9, 4), at(1997, 10, 7), at(1997, 11, 6) });
+        }
+        SUBCASE("the last work day of the month")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=-1", at(1997, 9, 29), 7) == std::vector<DateTime> { at(1997, 9, 30), at(1997, 10, 31), at(1997, 11, 28), at(1997, 12, 31), at(1998, 1, 30), at(1998, 2, 27), at(1998, 3, 31) });
+        }
+        SUBCASE("every 3 hours")
+        {
+            CHECK(occurrencesOf("FREQ=HOURLY;INTERVAL=3;UNTIL=19970902T170000Z", at(1997, 9, 2)) == std::vector<DateTime> { at(1997, 9, 2, 9), at(1997, 9, 2, 12), at(1997, 9, 2, 15) });
+        }
+        SUBCASE("every 15 minutes for 6 occurrences")
+        {
+            CHECK(occurrencesOf("FREQ=MINUTELY;INTERVAL=15;COUNT=6", at(1997, 9, 2)) == std::vector<DateTime> { at(1997, 9, 2, 9), at(1997, 9, 2, 9, 15), at(1997, 9, 2, 9, 30), at(1997, 9, 2, 9, 45), at(1997, 9, 2, 10), at(1997, 9, 2, 10, 15) });
+        }
+        SUBCASE("every 20 minutes from 9:00 to 16:40")
+        {
+            const auto minutely = occurrencesOf("FREQ=MINUTELY;INTERVAL=20;BYHOUR=9,10,11,12,13,14,15,16", at(1997, 9, 2), 48);
+            const auto daily = occurrencesOf("FREQ=DAILY;BYHOUR=9,10,11,12,13,14,15,16;BYMINUTE=0,20,40", at(1997, 9, 2), 48);
+            REQUIRE(minutely.size() == 48);
+            CHECK(minutely == daily);
+            CHECK(minutely[23] == at(1997, 9, 2, 16, 40));
+            CHECK(minutely[24] == at(1997, 9, 3, 9));
+        }
+        SUBCASE("invalid dates are skipped")
+        {
+            CHECK(occurrencesOf("FREQ=MONTHLY;BYMONTHDAY=15,30;COUNT=5", at(2007, 1, 15)) == std::vector<DateTime> { at(2007, 1, 15), at(2007, 1, 30), at(2007, 2, 15), at(2007, 3, 15), at(2007, 3, 30) });
+            CHECK(occurrencesOf("FREQ=MONTHLY;COUNT=3", at(2024, 1, 31)) == std::vector<DateTime> { at(2024, 1, 31), at(2024, 3, 31), at(2024, 5, 31) });
+        }
+    }
+
+    TEST_CASE("week numbers")
+    {
+        // With weeks starting on Monday, the week numbers are those of Date::weekOfYear().
+        const Recurrence rule = Recurrence::fromString("FREQ=YEARLY;BYWEEKNO=1,-1");
+        Recurrence::Cursor cursor = rule.occurrences(at(1990, 1, 1));
+        DateTime occurrence;
+        for (Date date(1990, 1, 1); date.year() < 2040; date = date.addDays(1)) {
+            if (date.weekOfYear() == 1 || date.addDays(7).weekOfYear() == 1) {
+                REQUIRE(cursor.next(occurrence));
+                CHECK(occurrence.date() == date);
+            }
+        }
+        REQUIRE(cursor.next(occurrence));
+        CHECK(occurrence.year() == 2040);
+    }
+
+    TEST_CASE("weekdays across months and years")
+    {
+        const Recurrence weekends = Recurrence::fromString("FREQ=DAILY;BYDAY=SA,SU");
+        const Recurrence mondays = Recurrence::fromString("FREQ=YEARLY;BYMONTH=1,12;BYDAY=MO");
+        Recurrence::Cursor weekendCursor = weekends.occurrences(at(1999, 12, 1));
+        Recurrence::Cursor mondayCursor = mondays.occurrences(at(1999, 12, 1));
+        DateTime occurrence;
+        for (Date date(1999, 12, 1); date < Date(2004, 1, 1); date = date.addDays(1)) {
+            if (date.dayOfWeek() >= 6) {
+                REQUIRE(weekendCursor.next(occurrence));
+                CHECK(occurrence == DateTime(date, Time(9, 0, 0)));
+            }
+            if (date.dayOfWeek() == 1 && (date.month() == 1 || date.month() == 12)) {
+                REQUIRE(mondayCursor.next(occurrence));
+                CHECK(occurrence == DateTime(date, Time(9, 0, 0)));
+            }
+        }
+    }
+
+    TEST_CASE("next occurrence")
+    {
+        const Recurrence rule = Recurrence::fromString("FREQ=MONTHLY;BYDAY=2TU");
+        const DateTime start = at(2000, 1, 1);
+        CHECK(rule.next(start, at(2024, 1, 1)) == at(2024, 1, 9));
+        CHECK(rule.next(start, at(2024, 1, 9)) == at(2024, 2, 13));
+        CHECK(rule.next(start, at(1990, 1, 1)) == at(2000, 1, 11));
+        CHECK_FALSE(Recurrence::fromString("FREQ=DAILY;COUNT=3").next(start, at(2000, 1, 3)).isValid());
+        CHECK(Recurrence::fromString("FREQ=DAILY;COUNT=3").next(start, at(2000, 1, 2, 8)) == at(2000, 1, 2));
+        CHECK_FALSE(Recurrence::fromString("FREQ=YEARLY;BYMONTH=2;BYMONTHDAY=30").next(start, start).isValid());
+
+        // Jumping to the period of a datetime yields the same occurrences as generating every occurrence up to it.
+        for (const char* text : { "FREQ=YEARLY;INTERVAL=3;BYMONTH=2,8;BYDAY=-1SU", "FREQ=MONTHLY;INTERVAL=5;BYMONTHDAY=1,-1", "FREQ=WEEKLY;INTERVAL=3;BYDAY=MO,FR;WKST=SU", "FREQ=DAILY;INTERVAL=11;BYHOUR=6,18", "FREQ=HOURLY;INTERVAL=7;BYDAY=SA", "FREQ=MINUTELY;INTERVAL=97;BYHOUR=3", "FREQ=MONTHLY;BYDAY=MO,TU,WE,TH,FR;BYSETPOS=1,-1" }) {
+            const Recurrence recurrence = Recurrence::fromString(text);
+            REQUIRE(recurrence.isValid());
+            Recurrence::Cursor cursor = recurrence.occurrences(start);
+            DateTime previous = start.subtractDays(1), occurrence;
+            for (int i = 0; i < 200 && cursor.next(occurrence); ++i) {
+                CHECK(recurrence.next(start, previous) == occurrence);
+                CHECK(recurrence.next(start, occurrence.subtractMinutes(1)) == occurrence);
+                previous = occurrence;
+            }
+        }
+    }
+
+    TEST_CASE("expansion")
+    {
+        const Recurrence rule = Recurrence::fromString("FREQ=WEEKLY;BYDAY=MO,WE,FR");
+        std::vector<DateTime> buffer(10);
+        const DateTime start = at(2024, 1, 1);
+        CHECK(rule.expand(start, at(2024, 3, 1), at(2024, 3, 8), buffer.data(), buffer.size()) == 3);
+        CHECK(buffer[0] == at(2024, 3, 1));
+        CHECK(buffer[1] == at(2024, 3, 4));
+        CHECK(buffer[2] == at(2024, 3, 6));
+        CHECK(rule.expand(start, at(2024, 3, 1), at(2024, 6, 1), buffer.data(), buffer.size()) == 10);
+        CHECK(buffer[9] == at(2024, 3, 22));
+        CHECK(rule.expand(start, buffer[9].addSeconds(1), at(2024, 6, 1), buffer.data(), buffer.size()) == 10);
+        CHECK(buffer[0] == at(2024, 3, 25));
+        CHECK(rule.expand(start, at(2023, 1, 1), at(2024, 1, 2), buffer.data(), buffer.size()) == 1);
+        CHECK(rule.expand(start, at(2024, 1, 2), at(2024, 1, 2), buffer.data(), buffer.size()) == 0);
+    }
+
+    TEST_CASE("subseconds and negative years")
+    {
+        const DateTime start(Date(2024, 2, 29), Time(12, 30, 15, Time::Nanoseconds(250)));
+        CHECK(occurrencesOf("FREQ=YEARLY;COUNT=2", start) == std::vector<DateTime> { start, DateTime(Date(2028, 2, 29), Time(12, 30, 15, Time::Nanoseconds(250))) });
+        CHECK(occurrencesOf("FREQ=SECONDLY;INTERVAL=30;COUNT=2", start) == std::vector<DateTime> { start, DateTime(Date(2024, 2, 29), Time(12, 30, 45, Time::Nanoseconds(250))) });
+        CHECK(occurrencesOf("FREQ=MINUTELY;BYSECOND=60", start).empty());
+        CHECK(occurrencesOf("FREQ=SECONDLY;BYSECOND=60", start).empty());
+        CHECK(occurrencesOf("FREQ=YEARLY;COUNT=3", at(-2, 6, 1)) == std::vector<DateTime> { at(-2, 6, 1), at(-1, 6, 1), at(1, 6, 1) });
+        CHECK(occurrencesOf("FREQ=MONTHLY;INTERVAL=7;COUNT=2", at(-1, 9, 1)) == std::vector<DateTime> { at(-1, 9, 1), at(1, 4, 1) });
+    }
+}
@@ -313,6 +313,30 @@ TEST_SUITE("Time")
             CHECK(t.toString("hh:mm:ss.fffffffff") == "07:09:02.675869000");
             CHECK(t.toString("hh:mm:ss.fff fff fff") == "07:09:02.675 675 675");
         }
+        SUBCASE("character buffer")
+        {
+            char buffer[16];
+            CHECK(Time(7, 9, 2, 675).toChars(buffer, buffer + sizeof(buffer), "hh:mm:ss.fff") == 12);
+            CHECK(std::string(buffer, 12) == "07:09:02.675");
+            CHECK(Time(7, 9, 2, 675).toChars(buffer, buffer + sizeof(buffer), std::string("h a")) == 4);
+            CHECK(std::string(buffer, 4) == "7 am");
+            CHECK(Time(7, 9, 2, 675).toChars(buffer, buffer + sizeof(buffer), Format("hhmmss")) == 6);
+            CHECK(std::string(buffer, 6) == "070902");
+            CHECK(Time().toChars(buffer, buffer + sizeof(buffer), "hh:mm:ss") == 0);
+            SUBCASE("too small")
+            {
+                char small[4] = { 'x', 'x', 'x', 'x' };
+                CHECK(Time(7, 9, 2).toChars(small, small + 3, "hh:mm:ss") == 8);
+                CHECK(std::string(small, 4) == "07:x");
+            }
+        }
+        SUBCASE("precompiled format")
+        {
+            const Format format("hh:mm:ss.fff A");
+            CHECK(Time(3, 45, 2, 18).toString(format) == "03:45:02.018 AM");
+            CHECK(Time(13, 45, 2, 18).toString(format) == "13:45:02.018 PM");
+            CHECK(Time().toString(format) == "");
+        }
     }
 
     TEST_CASE("parsing")
@@ -340,6 +364,62 @@ TEST_SUITE("Time")
         CHECK(Time::fromString("14:32:09.123456789", "hh:mm:ss.fffffffff") == Time(14, 32, 9, Time::Nanoseconds(123456789)));
         CHECK(Time::fromString("143209", "hhmmss") == Time(14, 32, 9));
         CHECK(Time::fromString("ieee 143209", "ieee hhmmss") == Time(14, 32, 9));
+        //
+        // precompiled format.
+        //
+        const Format format("HH:mm:ss.fff a");
+        CHECK(Time::fromString("01:02:03.004 am", format) == Time(1, 2, 3, 4));
+        CHECK(Time::fromString("01:02:03.004 pm", format) == Time(13, 2, 3, 4));
+    }
+
+    TEST_CASE("parsing without exceptions")
+    {
+        const auto parse = [](const std::string& input, const std::string& format, Time& time) {
+            return Time::fromChars(input.data(), input.data() + input.size(), Format(format), time);
+        };
+        Time time;
+        SUBCASE("success")
+        {
+            const ParseResult result = parse("14:32:09.123", "hh:mm:ss.fff", time);
+            CHECK(bool(result));
+            CHECK(result.error == ParseError::None);
+            CHECK(result.position == 12);
+            CHECK(time == Time(14, 32, 9, 123));
+            CHECK(parse("11:00 am", "hh:mm a", time).position == 8);
+            CHECK(time == Time(11, 0, 0));
+        }
+        SUBCASE("missing value")
+        {
+            CHECK(parse("14:3x:09", "hh:mm:ss", time).position == 5);
+            const ParseResult result = parse("14:x3:09", "hh:mm:ss", time);
+            CHECK(result.error == ParseError::MissingValue);
+            CHECK(result.position == 3);
+            CHECK(time.isValid() == false);
+            CHECK(parse("14:32:09.abc", "hh:mm:ss.fff", time).position == 9);
+        }
+        SUBCASE("invalid pattern")
+        {
+            CHECK(parse("14:32:09.1234567890", "hh:mm:ss.ffffffffff", time).error == ParseError::InvalidPattern);
+        }
+        SUBCASE("invalid value")
+        {
+            const ParseResult result = parse("24:00:00", "hh:mm:ss", time);
+            CHECK(result.error == ParseError::InvalidValue);
+            CHECK(result.position == 8);
+            CHECK(time.isValid() == false);
+        }
+        SUBCASE("malformed input does not throw")
+        {
+            CHECK(Time::fromString("ab:cd:ef", "hh:mm:ss").isValid() == false);
+            CHECK(Time::fromString("12:34:56.x", "hh:mm:ss.fff").isValid() == false);
+        }
+#ifdef XCLOX_HAS_STRING_VIEW
+        SUBCASE("string view")
+        {
+            CHECK(bool(Time::fromChars(std::string_view("01:02:03"), Format("hh:mm:ss"), time)));
+            CHECK(time == Time(1, 2, 3));
+        }
+#endif
     }
 
     TEST_CASE("conversion")
@@ -384,6 +464,19 @@ TEST_SUITE("Time")
         }
     }
 
+#ifdef XCLOX_HAS_CONSTEXPR14
+    TEST_CASE("constant expressions")
+    {
+        static_assert(!Time().isValid() && Time::midnight().isValid(), "");
+        static_assert(Time(13, 45, 30, 250).millisecond() == 250, "");
+        static_assert(Time(13, 45, 30).toSecondsSinceMidnight() == 49530, "");
+        static_assert(Time(23, 59, 59).addSeconds(1) == Time(24, 0, 0), "");
+        static_assert(Time(1, 0, 0).subtractMinutes(30) < Time(1, 0, 0), "");
+        static_assert(Time(12, 0, 0) - Time(11, 0, 0) == hours(1), "");
+        static_assert(Time::minutesBetween(Time(9, 0, 0), Time(17, 30, 0)) == 510, "");
+    }
+#endif
+
     TEST_CASE("serialization & deserialization")
     {
         Time t;
@@ -0,0 +1,362 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/timezone.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <string>
+#include <vector>
+
+using namespace xclox;
+
+namespace {
+
+struct TzifType {
+    std::int32_t offset;
+    bool daylight;
+    std::string abbreviation;
+};
+
+void appendBigEndian(std::string& output, std::int64_t value, int size)
+{
+    for (int i = size - 1; i >= 0; --i)
+        output.push_back(static_cast<char>((static_cast<std::uint64_t>(value) >> (i * 8)) & 0xFF));
+}
+
+void appendTzifHeader(std::string& output, char version, std::size_t transitions, std::size_t types, std::size_t characters)
+{
+    output += "TZif";
+    output.push_back(version);
+    output.append(15, '\0');
+    for (std::size_t count : { std::size_t(0), std::size_t(0), std::size_t(0), transitions, types, characters })
+        appendBigEndian(output, static_cast<std::int64_t>(count), 4);
+}
+
+// Returns a TZif file of the transitions, given as pairs of times and type indices, with a minimal block of version 1 unless version is '1'.
+std::string makeTzif(const std::vector<std::pair<std::int64_t, int>>& transitions, const std::vector<TzifType>& types, const std::string& footer, char version = '2')
+{
+    std::string characters;
+    std::vector<std::size_t> indices;
+    for (const TzifType& type : types) {
+        indices.push_back(characters.size());
+        characters += type.abbreviation;
+        characters.push_back('\0');
+    }
+    const int timeSize = version == '1' ? 4 : 8;
+    std::string output;
+    if (version != '1') {
+        appendTzifHeader(output, version, 0, 1, 1);
+        output.append(7, '\0');
+    }
+    appendTzifHeader(output, version, transitions.size(), types.size(), characters.size());
+    for (const auto& transition : transitions)
+        appendBigEndian(output, transition.first, timeSize);
+    for (const auto& transition : transitions)
+        output.push_back(static_cast<char>(transition.second));
+    for (std::size_t i = 0; i < types.size(); ++i) {
+        appendBigEndian(output, types[i].offset, 4);
+        output.push_back(types[i].daylight ? 1 : 0);
+        output.push_back(static_cast<char>(indices[i]));
+    }
+    output += characters;
+    if (version != '1')
+        output += '\n' + footer + '\n';
+    return output;
+}
+
+TimeZone fromTzif(const std::string& data, const std::string& name = "Test/Zone")
+{
+    return TimeZone::fromTzif(data.data(), data.size(), name);
+}
+
+DateTime dateTime(int year, int month, int day, int hour, int minute = 0, int second = 0)
+{
+    return DateTime(Date(year, month, day), Time(hour, minute, second));
+}
+
+// A zone like Europe/Berlin, with two transitions in 2020 and the rule of the European Union after them.
+const std::string centralEurope = makeTzif({ { -2422054408LL, 1 }, { 1585443600LL, 2 }, { 1603587600LL, 1 } }, { { 3208, false, "LMT" }, { 3600, false, "CET" }, { 7200, true, "CEST" } }, "CET-1CEST,M3.5.0,M10.5.0/3");
+
+} // namespace
+
+TEST_SUITE("TimeZone")
+{
+    TEST_CASE("invalid")
+    {
+        CHECK_FALSE(TimeZone().isValid());
+        CHECK_FALSE(TimeZone().toLocal(dateTime(2024, 1, 1, 0)).isValid());
+        CHECK_FALSE(TimeZone().toUtc(dateTime(2024, 1, 1, 0)).isValid());
+        CHECK(TimeZone().abbreviation(dateTime(2024, 1, 1, 0)).empty());
+        CHECK_FALSE(fromTzif("").isValid());
+        CHECK_FALSE(fromTzif("TZjf" + centralEurope.substr(4)).isValid());
+        CHECK_FALSE(fromTzif(centralEurope.substr(0, centralEurope.size() - 40)).isValid());
+        CHECK_FALSE(fromTzif(makeTzif({ { 1603587600LL, 1 }, { 1585443600LL, 0 } }, { { 0, false, "UTC" }, { 3600, false, "CET" } }, "CET-1")).isValid());
+        CHECK_FALSE(fromTzif(makeTzif({ { 0, 2 } }, { { 0, false, "UTC" }, { 3600, false, "CET" } }, "CET-1")).isValid());
+        CHECK_FALSE(fromTzif(makeTzif({}, { { 3600, false, "CET" } }, "CET-1CEST,M3.5.0")).isValid());
+        CHECK_FALSE(fromTzif(makeTzif({}, { { 3600, false, "CET" } }, "C-1")).isValid());
+        CHECK_FALSE(TimeZone::fromName("No/Such_Zone").isValid());
+        CHECK_FALSE(TimeZone::fromName("../zoneinfo/UTC").isValid());
+        CHECK_FALSE(TimeZone::fromName("").isValid());
+        CHECK_FALSE(TimeZone::fromFile("").isValid());
+        CHECK_FALSE(TimeZone::utc().toLocal(DateTime()).isValid());
+    }
+
+    TEST_CASE("utc")
+    {
+        const TimeZone utc = TimeZone::utc();
+        CHECK(utc.isValid());
+        CHECK(utc.name() == "UTC");
+        CHECK(utc.toLocal(dateTime(2024, 7, 1, 12)) == dateTime(2024, 7, 1, 12));
+        CHECK(utc.toUtc(dateTime(2024, 7, 1, 12)) == dateTime(2024, 7, 1, 12));
+        CHECK(utc.offset(dateTime(2024, 7, 1, 12)) == TimeZone::Seconds(0));
+        CHECK(utc.abbreviation(dateTime(2024, 7, 1, 12)) == "UTC");
+        CHECK_FALSE(utc.isDaylightTime(dateTime(2024, 7, 1, 12)));
+    }
+
+    TEST_CASE("transitions")
+    {
+        const TimeZone zone = fromTzif(centralEurope);
+        REQUIRE(zone.isValid());
+        CHECK(zone.name() == "Test/Zone");
+        CHECK(zone.toLocal(dateTime(1850, 1, 1, 0)) == dateTime(1850, 1, 1, 0, 53, 28));
+        CHECK(zone.abbreviation(dateTime(1850, 1, 1, 0)) == "LMT");
+        CHECK(zone.toLocal(dateTime(2020, 1, 1, 0)) == dateTime(2020, 1, 1, 1));
+        CHECK(zone.toLocal(dateTime(2020, 3, 29, 0, 59, 59)) == dateTime(2020, 3, 29, 1, 59, 59));
+        CHECK(zone.toLocal(dateTime(2020, 3, 29, 1)) == dateTime(2020, 3, 29, 3));
+        CHECK(zone.isDaylightTime(dateTime(2020, 3, 29, 1)));
+        CHECK(zone.abbreviation(dateTime(2020, 7, 1, 0)) == "CEST");
+        CHECK(zone.offset(dateTime(2020, 7, 1, 0)) == TimeZone::Seconds(7200));
+        CHECK(zone.toLocal(dateTime(2020, 10, 25, 0, 59, 59)) == dateTime(2020, 10, 25, 2, 59, 59));
+        CHECK(zone.toLocal(dateTime(2020, 10, 25, 1)) == dateTime(2020, 10, 25, 2));
+        CHECK_FALSE(zone.isDaylightTime(dateTime(2020, 10, 25, 1)));
+        CHECK(zone.toLocal(DateTime(Date(2020, 7, 1), Time(23, 30, 0, std::chrono::nanoseconds(123456789)))) == DateTime(Date(2020, 7, 2), Time(1, 30, 0, std::chrono::nanoseconds(123456789))));
+    }
+
+    TEST_CASE("footer")
+    {
+        const TimeZone zone = fromTzif(centralEurope);
+        CHECK(zone.toLocal(dateTime(2024, 3, 31, 0, 59, 59)) == dateTime(2024, 3, 31, 1, 59, 59));
+        CHECK(zone.toLocal(dateTime(2024, 3, 31, 1)) == dateTime(2024, 3, 31, 3));
+        CHECK(zone.toLocal(dateTime(2024, 10, 27, 1)) == dateTime(2024, 10, 27, 2));
+        CHECK(zone.abbreviation(dateTime(2100, 12, 31, 23)) == "CET");
+        CHECK(zone.toLocal(dateTime(2150, 1, 1, 12)) == dateTime(2150, 1, 1, 13));
+        CHECK(zone.toLocal(dateTime(2150, 7, 1, 12)) == dateTime(2150, 7, 1, 14));
+        CHECK(zone.abbreviation(dateTime(2150, 7, 1, 12)) == "CEST");
+        CHECK(zone.toLocal(dateTime(2150, 3, 29, 0, 59, 59)) == dateTime(2150, 3, 29, 1, 59, 59));
+        CHECK(zone.toLocal(dateTime(2150, 3, 29, 1)) == dateTime(2150, 3, 29, 3));
+        CHECK(zone.toLocal(dateTime(2150, 10, 25, 1)) == dateTime(2150, 10, 25, 2));
+        CHECK(zone.toUtc(dateTime(2150, 7, 1, 14)) == dateTime(2150, 7, 1, 12));
+        CHECK(zone.toUtc(dateTime(2150, 3, 29, 2, 30)) == dateTime(2150, 3, 29, 1, 30));
+        CHECK(zone.toUtc(dateTime(2150, 10, 25, 2, 30)) == dateTime(2150, 10, 25, 0, 30));
+        CHECK(zone.toUtc(dateTime(2150, 10, 25, 3)) == dateTime(2150, 10, 25, 2));
+    }
+
+    TEST_CASE("local to utc")
+    {
+        const TimeZone zone = fromTzif(centralEurope);
+        CHECK(zone.toUtc(dateTime(1850, 1, 1, 0, 53, 28)) == dateTime(1850, 1, 1, 0));
+        CHECK(zone.toUtc(dateTime(2020, 1, 1, 1)) == dateTime(2020, 1, 1, 0));
+        CHECK(zone.toUtc(dateTime(2020, 7, 1, 2)) == dateTime(2020, 7, 1, 0));
+        SUBCASE("gap")
+        {
+            CHECK(zone.toUtc(dateTime(2020, 3, 29, 1, 59, 59)) == dateTime(2020, 3, 29, 0, 59, 59));
+            CHECK(zone.toUtc(dateTime(2020, 3, 29, 2)) == dateTime(2020, 3, 29, 1));
+            CHECK(zone.toUtc(dateTime(2020, 3, 29, 2, 30)) == dateTime(2020, 3, 29, 1, 30));
+            CHECK(zone.toLocal(zone.toUtc(dateTime(2020, 3, 29, 2, 30))) == dateTime(2020, 3, 29, 3, 30));
+            CHECK(zone.toUtc(dateTime(2020, 3, 29, 3)) == dateTime(2020, 3, 29, 1));
+        }
+        SUBCASE("overlap")
+        {
+            CHECK(zone.toUtc(dateTime(2020, 10, 25, 1, 59, 59)) == dateTime(2020, 10, 24, 23, 59, 59));
+            CHECK(zone.toUtc(dateTime(2020, 10, 25, 2)) == dateTime(2020, 10, 25, 0));
+            CHECK(zone.toUtc(dateTime(2020, 10, 25, 2, 59, 59)) == dateTime(2020, 10, 25, 0, 59, 59));
+            CHECK(zone.toUtc(dateTime(2020, 10, 25, 3)) == dateTime(2020, 10, 25, 2));
+        }
+        SUBCASE("round trip")
+        {
+            for (DateTime utc = dateTime(2019, 1, 1, 0, 7, 13); utc < dateTime(2030, 1, 1, 0); utc = utc.addSeconds(24683)) {
+                if (zone.offset(utc.subtractHours(1)) == zone.offset(utc) && zone.offset(utc.addHours(1)) == zone.offset(utc))
+                    CHECK(zone.toUtc(zone.toLocal(utc)) == utc);
+            }
+        }
+    }
+
+    TEST_CASE("rules")
+    {
+        SUBCASE("southern hemisphere")
+        {
+            const TimeZone zone = fromTzif(makeTzif({}, { { 36000, false, "AEST" } }, "AEST-10AEDT,M10.1.0,M4.1.0/3"));
+            REQUIRE(zone.isValid());
+            CHECK(zone.toLocal(dateTime(2024, 1, 1, 0)) == dateTime(2024, 1, 1, 11));
+            CHECK(zone.toLocal(dateTime(2024, 7, 1, 0)) == dateTime(2024, 7, 1, 10));
+            CHECK(zone.toLocal(dateTime(2024, 4, 6, 15, 59, 59)) == dateTime(2024, 4, 7, 2, 59, 59));
+            CHECK(zone.toLocal(dateTime(2024, 4, 6, 16)) == dateTime(2024, 4, 7, 2));
+            CHECK(zone.toLocal(dateTime(2024, 10, 5, 15, 59, 59)) == dateTime(2024, 10, 6, 1, 59, 59));
+            CHECK(zone.toLocal(dateTime(2024, 10, 5, 16)) == dateTime(2024, 10, 6, 3));
+            CHECK(zone.abbreviation(dateTime(2024, 12, 1, 0)) == "AEDT");
+            CHECK(zone.toLocal(dateTime(2250, 1, 1, 0)) == dateTime(2250, 1, 1, 11));
+            CHECK(zone.toLocal(dateTime(2250, 7, 1, 0)) == dateTime(2250, 7, 1, 10));
+        }
+        SUBCASE("negative daylight saving time")
+        {
+            const TimeZone zone = fromTzif(makeTzif({}, { { 3600, false, "IST" } }, "IST-1GMT0,M10.5.0,M3.5.0/1"));
+            REQUIRE(zone.isValid());
+            CHECK(zone.toLocal(dateTime(2024, 1, 15, 12)) == dateTime(2024, 1, 15, 12));
+            CHECK(zone.isDaylightTime(dateTime(2024, 1, 15, 12)));
+            CHECK(zone.toLocal(dateTime(2024, 7, 15, 12)) == dateTime(2024, 7, 15, 13));
+            CHECK(zone.abbreviation(dateTime(2024, 7, 15, 12)) == "IST");
+            CHECK(zone.toLocal(dateTime(2150, 7, 15, 12)) == dateTime(2150, 7, 15, 13));
+        }
+        SUBCASE("julian days and quoted abbreviations")
+        {
+            const TimeZone zone = fromTzif(makeTzif({}, { { -10800, false, "-03" } }, "<-03>3<-02>,J60/0,300/0"));
+            REQUIRE(zone.isValid());
+            CHECK(zone.toLocal(dateTime(2024, 3, 1, 2, 59, 59)) == dateTime(2024, 2, 29, 23, 59, 59));
+            CHECK(zone.toLocal(dateTime(2024, 3, 1, 3)) == dateTime(2024, 3, 1, 1));
+            CHECK(zone.abbreviation(dateTime(2024, 3, 1, 3)) == "-02");
+            CHECK(zone.toLocal(dateTime(2024, 10, 27, 1, 59, 59)) == dateTime(2024, 10, 26, 23, 59, 59));
+            CHECK(zone.toLocal(dateTime(2024, 10, 27, 2)) == dateTime(2024, 10, 26, 23));
+        }
+        SUBCASE("fixed offset")
+        {
+            const TimeZone zone = fromTzif(makeTzif({}, { { 19800, false, "IST" } }, "IST-5:30"));
+            CHECK(zone.toLocal(dateTime(2024, 1, 1, 0)) == dateTime(2024, 1, 1, 5, 30));
+            CHECK(zone.toUtc(dateTime(2024, 1, 1, 5, 30)) == dateTime(2024, 1, 1, 0));
+        }
+        SUBCASE("version 1")
+        {
+            const TimeZone zone = fromTzif(makeTzif({ { 1585443600LL, 1 }, { 1603587600LL, 0 } }, { { 3600, false, "CET" }, { 7200, true, "CEST" } }, "", '1'));
+            REQUIRE(zone.isValid());
+            CHECK(zone.toLocal(dateTime(2020, 7, 1, 0)) == dateTime(2020, 7, 1, 2));
+            CHECK(zone.toLocal(dateTime(2024, 7, 1, 0)) == dateTime(2024, 7, 1, 1));
+        }
+    }
+
+    TEST_CASE("hints")
+    {
+        const TimeZone zone = fromTzif(centralEurope);
+        const TimeZone other = zone;
+        std::vector<DateTime> times;
+        for (long seed = 7, i = 0; i < 2000; ++i) {
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+            times.push_back(dateTime(1960, 1, 1, 0).addSeconds(static_cast<int>(seed % 2000000000)));
+        }
+        for (const DateTime& time : times)
+            CHECK(zone.toLocal(time) == other.toLocal(time));
+        std::sort(times.begin(), times.end());
+        for (const DateTime& time : times) {
+            CHECK(zone.toLocal(time) == time.addSeconds(static_cast<int>(other.offset(time).count())));
+            CHECK(zone.toUtc(zone.toLocal(time)) == other.toUtc(other.toLocal(time)));
+        }
+    }
+
+    TEST_CASE("batch conversions")
+    {
+        const TimeZone zone = fromTzif(centralEurope);
+        const std::int64_t second = 1000000000;
+        std::vector<std::int64_t> utc;
+        for (long seed = 11, i = 0; i < 1000; ++i) {
+            seed = (seed * 1103515245 + 12345) & 0x7FFFFFFF;
+            const std::int64_t seconds = (static_cast<std::int64_t>(seed) << 3) % 9467020800LL - 2208988800LL; // 1900 through 2199
+            utc.push_back(seconds * second + seed % second);
+        }
+        const auto check = [&](const std::vector<std::int64_t>& input) {
+            std::vector<std::int64_t> local(input.size());
+            std::vector<DateTime> datetimes(input.size());
+            zone.toLocal(input.data(), input.size(), local.data());
+            zone.toLocal(input.data(), input.size(), datetimes.data());
+            long mismatches = 0;
+            for (size_t i = 0; i < input.size(); ++i) {
+                const DateTime expected = zone.toLocal(DateTime(DateTime::Nanoseconds(input[i])));
+                mismatches += DateTime(DateTime::Nanoseconds(local[i])) != expected;
+                mismatches += datetimes[i] != expected;
+            }
+            CHECK(mismatches == 0);
+        };
+        SUBCASE("unsorted")
+        {
+            check(utc);
+        }
+        SUBCASE("sorted")
+        {
+            std::sort(utc.begin(), utc.end());
+            check(utc);
+        }
+        SUBCASE("around transitions")
+        {
+            std::vector<std::int64_t> input;
+            for (std::int64_t time : { 1585443600LL, 1603587600LL, 1616893200LL, 4133984400LL, 4152128400LL })
+                for (std::int64_t offset : { -second, std::int64_t(-1), std::int64_t(0), std::int64_t(1) })
+                    input.push_back(time * second + offset);
+            check(input);
+            std::reverse(input.begin(), input.end());
+            check(input);
+        }
+        SUBCASE("between two transitions")
+        {
+            std::vector<std::int64_t> input;
+            for (int i = 0; i < 300; ++i)
+                input.push_back((1704067200LL + (i * 7919) % 86400) * second);
+            std::vector<std::int64_t> local = input;
+            zone.toLocal(local.data(), local.size(), local.data());
+            for (size_t i = 0; i < input.size(); ++i)
+                CHECK(local[i] == input[i] + 3600 * second);
+        }
+        SUBCASE("invalid")
+        {
+            std::vector<std::int64_t> local(utc.size());
+            std::vector<DateTime> datetimes(utc.size(), dateTime(2024, 1, 1, 0));
+            TimeZone().toLocal(utc.data(), utc.size(), local.data());
+            TimeZone().toLocal(utc.data(), utc.size(), datetimes.data());
+            CHECK(local == utc);
+            CHECK(std::none_of(datetimes.begin(), datetimes.end(), [](const DateTime& datetime) { return datetime.isValid(); }));
+            zone.toLocal(utc.data(), 0, local.data());
+        }
+    }
+
+    TEST_CASE("system database")
+    {
+        const TimeZone berlin = TimeZone::fromName("Europe/Berlin");
+        if (berlin.isValid()) {
+            CHECK(berlin.name() == "Europe/Berlin");
+            CHECK(berlin.toLocal(dateTime(2024, 7, 1, 12)) == dateTime(2024, 7, 1, 14));
+            CHECK(berlin.toUtc(dateTime(2024, 1, 1, 12)) == dateTime(2024, 1, 1, 11));
+            CHECK(berlin.abbreviation(dateTime(2024, 7, 1, 12)) == "CEST");
+            CHECK(berlin.toLocal(dateTime(2150, 7, 1, 12)) == dateTime(2150, 7, 1, 14));
+        }
+#if defined(__unix__) || defined(__APPLE__)
+        const char* previous = std::getenv("TZ");
+        const std::string saved = previous ? previous : "";
+        for (const char* name : { "Europe/Berlin", "America/New_York", "Australia/Sydney", "Europe/Dublin", "Asia/Kolkata", "America/St_Johns", "Africa/Casablanca", "Pacific/Apia" }) {
+            const TimeZone zone = TimeZone::fromName(name);
+            if (!zone.isValid())
+                continue;
+            setenv("TZ", name, 1);
+            tzset();
+            long mismatches = 0;
+            for (std::int64_t seconds = -1000000000; seconds < 4200000000LL; seconds += 24691) {
+                const std::time_t time = static_cast<std::time_t>(seconds);
+                std::tm fields = {};
+                localtime_r(&time, &fields);
+                const DateTime expected(Date(fields.tm_year + 1900, fields.tm_mon + 1, fields.tm_mday), Time(fields.tm_hour, fields.tm_min, fields.tm_sec));
+                const DateTime utc(std::chrono::seconds(static_cast<long long>(seconds)));
+                mismatches += zone.toLocal(utc) != expected;
+                mismatches += zone.isDaylightTime(utc) != (fields.tm_isdst > 0);
+            }
+            CHECK(mismatches == 0);
+        }
+        if (previous)
+            setenv("TZ", saved.c_str(), 1);
+        else
+            unsetenv("TZ");
+        tzset();
+#endif
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+#include "xclox/tzdb.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+using namespace xclox;
+
+TEST_SUITE("TimeZoneDatabase")
+{
+    TEST_CASE("names")
+    {
+        const TimeZoneDatabase& database = tzdb::database();
+        REQUIRE(database.zoneCount > 0);
+        CHECK(std::strlen(database.version) > 0);
+        for (std::uint32_t i = 0; i < database.zoneCount; ++i) {
+            const char* name = database.characters + database.zones[i].name;
+            CHECK(database.find(name) == &database.zones[i]);
+            const TimeZone zone = TimeZone::fromDatabase(name, database);
+            CHECK(zone.isValid());
+            CHECK(zone.name() == name);
+        }
+        for (const char* name : { "", "No/Such_Zone", "europe/berlin", "Europe/Berlin ", "Europe" }) {
+            CHECK(database.find(name) == nullptr);
+            CHECK_FALSE(TimeZone::fromDatabase(name, database).isValid());
+        }
+        CHECK_FALSE(TimeZone::fromDatabase("UTC", TimeZoneDatabase()).isValid());
+    }
+
+    TEST_CASE("conversions")
+    {
+        const TimeZoneDatabase& database = tzdb::database();
+        const TimeZone berlin = TimeZone::fromDatabase("Europe/Berlin", database);
+        CHECK(berlin.toLocal(dateTime(2024, 7, 1, 12)) == dateTime(2024, 7, 1, 14));
+        CHECK(berlin.toUtc(dateTime(2024, 1, 1, 12)) == dateTime(2024, 1, 1, 11));
+        CHECK(berlin.abbreviation(dateTime(2024, 7, 1, 12)) == "CEST");
+        CHECK(berlin.toLocal(dateTime(2150, 1, 1, 12)) == dateTime(2150, 1, 1, 13));
+        CHECK(berlin.abbreviation(dateTime(1900, 1, 1, 12)) == "CET");
+        const TimeZone newYork = TimeZone::fromDatabase("America/New_York", database);
+        CHECK(newYork.toLocal(dateTime(2024, 3, 10, 6, 59, 59)) == dateTime(2024, 3, 10, 1, 59, 59));
+        CHECK(newYork.toLocal(dateTime(2024, 3, 10, 7)) == dateTime(2024, 3, 10, 3));
+        CHECK(newYork.isDaylightTime(dateTime(2024, 7, 1, 12)));
+        const TimeZone kolkata = TimeZone::fromDatabase("Asia/Kolkata", database);
+        const TimeZone calcutta = TimeZone::fromDatabase("Asia/Calcutta", database);
+        CHECK(database.find("Asia/Kolkata")->firstTransition == database.find("Asia/Calcutta")->firstTransition);
+        CHECK(kolkata.toLocal(dateTime(2024, 7, 1, 12)) == dateTime(2024, 7, 1, 17, 30));
+        CHECK(calcutta.toLocal(dateTime(1942, 7, 1, 12)) == kolkata.toLocal(dateTime(1942, 7, 1, 12)));
+        CHECK(TimeZone::fromDatabase("UTC", database).toLocal(dateTime(2024, 7, 1, 12)) == dateTime(2024, 7, 1, 12));
+    }
+
+    TEST_CASE("system database")
+    {
+        // The time zones are compared only with those of the same version, which may have other transitions in other versions.
+        const TimeZoneDatabase& database = tzdb::database();
+        std::ifstream source("/usr/share/zoneinfo/tzdata.zi");
+        std::string version;
+        if (!std::getline(source, version) || version != std::string("# version ") + database.version)
+            return;
+        for (std::uint32_t i = 0; i < database.zoneCount; ++i) {
+            const char* name = database.characters + database.zones[i].name;
+            const TimeZone expected = TimeZone::fromName(name);
+            if (!expected.isValid())
+                continue;
+            const TimeZone zone = TimeZone::fromDatabase(name, database);
+            long mismatches = 0;
+            for (std::int64_t seconds = -2000000000; seconds < 4200000000LL; seconds += 86400 * 3 + 3601) {
+                const DateTime utc(std::chrono::seconds(static_cast<long long>(seconds)));
+                mismatches += zone.toLocal(utc) != expected.toLocal(utc);
+                mismatches += zone.toUtc(utc) != expected.toUtc(utc);
+                mismatches += zone.abbreviation(utc) != expected.abbreviation(utc);
+            }
+            CHECK(mismatches == 0);
+        }
+    }
+}
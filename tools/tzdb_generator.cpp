@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024 Abdullatif Kalla.
+ *
+ * This source code is licensed under the MIT license found in the
+ * LICENSE.txt file in the root directory of this source tree.
+ */
+
+// Generates a header of a TimeZoneDatabase from the TZif files of selected time zones:
+//
+//     tzdb_generator <directory> <output> <zone>...
+//
+// e.g. "tzdb_generator /usr/share/zoneinfo include/xclox/tzdb.hpp Europe/Berlin America/New_York".
+
+#include "xclox/timezone.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace xclox;
+
+namespace {
+
+struct Input {
+    std::string name;
+    std::string data;
+    internal::TzifFile file;
+};
+
+struct Tables {
+    std::string characters;
+    std::map<std::string, std::uint32_t> strings;
+    std::vector<TimeZoneDatabase::Type> types;
+    std::vector<std::int64_t> times;
+    std::vector<std::uint16_t> transitionTypes;
+    std::vector<TimeZoneDatabase::Zone> zones;
+    std::vector<std::uint16_t> displacements;
+    std::string version;
+    TimeZoneDatabase database;
+
+    std::uint32_t addString(const std::string& value)
+    {
+        const auto it = strings.find(value);
+        if (it != strings.end())
+            return it->second;
+        const std::uint32_t position = static_cast<std::uint32_t>(characters.size());
+        characters += value;
+        characters.push_back('\0');
+        strings[value] = position;
+        return position;
+    }
+
+    std::uint16_t addType(const internal::LocalTimeType& type)
+    {
+        const std::uint32_t abbreviation = addString(type.abbreviation);
+        for (size_t i = 0; i < types.size(); ++i) {
+            if (types[i].offset == type.offset && types[i].daylight == type.daylight && types[i].abbreviation == abbreviation)
+                return static_cast<std::uint16_t>(i);
+        }
+        types.push_back(TimeZoneDatabase::Type { type.offset, type.daylight, abbreviation });
+        return static_cast<std::uint16_t>(types.size() - 1);
+    }
+};
+
+bool readFile(const std::string& path, std::string& data)
+{
+    std::ifstream file(path, std::ios::binary);
+    data.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return file.good() || file.eof();
+}
+
+// Returns whether a file that ends with the first \p count transitions reproduces the rest of them by the rule of its footer, as TimeZone follows it.
+bool reproduces(const internal::TzifFile& file, const internal::PosixTimeZone& rule, size_t count)
+{
+    const std::int64_t last = file.times[count - 1];
+    const internal::LocalTimeType& type = file.types[file.typeIndices[count - 1]];
+    const bool daylight = rule.isDaylightTime(last);
+    if (type.daylight != daylight || type.offset != (daylight ? rule.daylightOffset : rule.standardOffset) || type.abbreviation != (daylight ? rule.daylightAbbreviation : rule.standardAbbreviation))
+        return false;
+    int year = 0, month = 0, day = 0;
+    internal::daysToYmd(internal::Days(static_cast<long>(internal::floorDivide(last, 86400))), &year, &month, &day);
+    size_t i = count;
+    for (; i < file.times.size(); ++year) {
+        std::int64_t toDaylight = 0, fromDaylight = 0;
+        rule.transitions(year, &toDaylight, &fromDaylight);
+        for (std::int64_t time : { std::min(toDaylight, fromDaylight), std::max(toDaylight, fromDaylight) }) {
+            if (time <= last || i == file.times.size())
+                continue;
+            if (time != file.times[i] || file.types[file.typeIndices[i]].daylight != (time == toDaylight))
+                return false;
+            ++i;
+        }
+    }
+    return true;
+}
+
+// Removes the last transitions of the file that the rule of its footer reproduces.
+void trim(internal::TzifFile& file)
+{
+    internal::PosixTimeZone rule;
+    if (file.times.empty() || file.footer.empty() || !rule.parse(file.footer) || !rule.hasDaylight)
+        return;
+    size_t count = 1;
+    while (count < file.times.size() && !reproduces(file, rule, count))
+        ++count;
+    file.times.resize(count);
+    file.typeIndices.resize(count);
+}
+
+// Builds the tables of the zones, leaving the transitions of the zones named in untrimmed as they are, and returns false if the perfect hash cannot be built.
+bool build(const std::vector<Input>& inputs, const std::set<std::string>& untrimmed, Tables& tables)
+{
+    const std::string version = tables.version;
+    tables = Tables();
+    tables.version = version;
+    std::map<std::vector<std::pair<std::int64_t, std::uint16_t>>, std::uint32_t> runs;
+    std::vector<TimeZoneDatabase::Zone> zones;
+    for (const Input& input : inputs) {
+        internal::TzifFile file = input.file;
+        if (!untrimmed.count(input.name))
+            trim(file);
+        std::vector<std::pair<std::int64_t, std::uint16_t>> run;
+        for (size_t i = 0; i < file.times.size(); ++i)
+            run.push_back(std::make_pair(file.times[i], tables.addType(file.types[file.typeIndices[i]])));
+        auto it = runs.find(run);
+        if (it == runs.end()) {
+            it = runs.insert(std::make_pair(run, static_cast<std::uint32_t>(tables.times.size()))).first;
+            for (const auto& transition : run) {
+                tables.times.push_back(transition.first);
+                tables.transitionTypes.push_back(transition.second);
+            }
+        }
+        zones.push_back(TimeZoneDatabase::Zone { tables.addString(input.name), tables.addString(file.footer), it->second, static_cast<std::uint32_t>(run.size()), tables.addType(file.types[0]) });
+    }
+
+    // The buckets are displaced from the largest to the smallest, each by the first seed that hashes its names into free slots.
+    const std::uint32_t count = static_cast<std::uint32_t>(zones.size());
+    for (std::uint32_t bucketCount = (count + 3) / 4; bucketCount <= count; ++bucketCount) {
+        std::vector<std::vector<std::uint32_t>> buckets(bucketCount);
+        for (std::uint32_t i = 0; i < count; ++i)
+            buckets[internal::hashName(tables.characters.c_str() + zones[i].name, 0) % bucketCount].push_back(i);
+        std::vector<std::uint32_t> order(bucketCount);
+        for (std::uint32_t i = 0; i < bucketCount; ++i)
+            order[i] = i;
+        std::stable_sort(order.begin(), order.end(), [&](std::uint32_t a, std::uint32_t b) { return buckets[a].size() > buckets[b].size(); });
+        std::vector<std::uint16_t> displacements(bucketCount, 0);
+        std::vector<std::int64_t> slots(count, -1);
+        bool displaced = true;
+        for (std::uint32_t bucket : order) {
+            if (buckets[bucket].empty())
+                continue;
+            displaced = false;
+            for (std::uint32_t seed = 1; seed <= 0xFFFF && !displaced; ++seed) {
+                std::vector<std::uint32_t> taken;
+                for (std::uint32_t zone : buckets[bucket]) {
+                    const std::uint32_t slot = internal::hashName(tables.characters.c_str() + zones[zone].name, seed) % count;
+                    if (slots[slot] >= 0 || std::find(taken.begin(), taken.end(), slot) != taken.end())
+                        break;
+                    taken.push_back(slot);
+                }
+                if (taken.size() == buckets[bucket].size()) {
+                    for (size_t i = 0; i < taken.size(); ++i)
+                        slots[taken[i]] = buckets[bucket][i];
+                    displacements[bucket] = static_cast<std::uint16_t>(seed);
+                    displaced = true;
+                }
+            }
+            if (!displaced)
+                break;
+        }
+        if (!displaced)
+            continue;
+        for (std::uint32_t slot = 0; slot < count; ++slot)
+            tables.zones.push_back(zones[static_cast<size_t>(slots[slot])]);
+        tables.displacements = displacements;
+        tables.database = TimeZoneDatabase { tables.version.c_str(), tables.characters.c_str(), tables.types.data(), tables.times.data(), tables.transitionTypes.data(), tables.zones.data(), count, tables.displacements.data(), bucketCount };
+        return true;
+    }
+    return false;
+}
+
+// Returns whether the zone of the database converts like the zone of its file at and around every transition and throughout the years 1800 through 2200.
+bool verify(const Input& input, const TimeZoneDatabase& database)
+{
+    const TimeZone expected = TimeZone::fromTzif(input.data.data(), input.data.size(), input.name);
+    const TimeZone actual = TimeZone::fromDatabase(input.name, database);
+    std::vector<std::int64_t> seconds;
+    for (std::int64_t time : input.file.times) {
+        seconds.push_back(time - 1);
+        seconds.push_back(time);
+    }
+    for (std::int64_t time = -5364662400LL; time < 7258118400LL; time += 86400 * 7 + 3607)
+        seconds.push_back(time);
+    for (std::int64_t time : seconds) {
+        const DateTime utc(std::chrono::seconds(static_cast<long long>(time)));
+        if (actual.toLocal(utc) != expected.toLocal(utc) || actual.abbreviation(utc) != expected.abbreviation(utc) || actual.isDaylightTime(utc) != expected.isDaylightTime(utc) || actual.toUtc(utc) != expected.toUtc(utc))
+            return false;
+    }
+    return actual.isValid();
+}
+
+std::string quote(const std::string& value)
+{
+    std::string output = "\"";
+    for (char c : value) {
+        if (c == '"' || c == '\\')
+            output.push_back('\\');
+        output.push_back(c);
+    }
+    return output + '"';
+}
+
+template <typename T, typename Function>
+void writeArray(std::ofstream& output, const char* declaration, const std::vector<T>& values, const Function& write)
+{
+    output << "        static constexpr " << declaration << "[] = {";
+    for (size_t i = 0; i < values.size(); ++i) {
+        output << (i % 8 == 0 ? "\n            " : " ");
+        write(values[i]);
+        output << ',';
+    }
+    output << "\n        };\n";
+}
+
+bool write(const std::string& path, const Tables& tables, const std::vector<Input>& inputs)
+{
+    std::ofstream output(path);
+    output << "/*\n"
+              " * Copyright (c) 2024 Abdullatif Kalla.\n"
+              " *\n"
+              " * This source code is licensed under the MIT license found in the\n"
+              " * LICENSE.txt file in the root directory of this source tree.\n"
+              " */\n\n"
+              "// This file is generated by tools/tzdb_generator.cpp from the time zone database "
+           << tables.version << "; regenerate it by building the target \"tzdb\" instead of editing it.\n\n"
+                                "#ifndef XCLOX_TZDB_HPP\n"
+                                "#define XCLOX_TZDB_HPP\n\n"
+                                "#include \"timezone.hpp\"\n\n"
+                                "namespace xclox {\n\n"
+                                "namespace tzdb {\n\n"
+                                "    // The tables of the database, which are members of a class template so that every program has one copy of them.\n"
+                                "    template <typename T = void>\n"
+                                "    struct Tables {\n"
+                                "        static constexpr char characters[] =";
+    size_t start = 0;
+    for (size_t i = 0; i < tables.characters.size(); ++i) {
+        if (tables.characters[i] == '\0') {
+            output << "\n            " << quote(tables.characters.substr(start, i - start)).insert(i - start + 1, "\\0");
+            start = i + 1;
+        }
+    }
+    output << ";\n";
+    writeArray(output, "TimeZoneDatabase::Type types", tables.types, [&](const TimeZoneDatabase::Type& type) { output << "{ " << type.offset << ", " << (type.daylight ? "true" : "false") << ", " << type.abbreviation << " }"; });
+    std::vector<std::int64_t> times = tables.times.empty() ? std::vector<std::int64_t>(1, 0) : tables.times;
+    std::vector<std::uint16_t> transitionTypes = tables.transitionTypes.empty() ? std::vector<std::uint16_t>(1, 0) : tables.transitionTypes;
+    writeArray(output, "std::int64_t times", times, [&](std::int64_t time) { output << time << (time < -2147483647 || time > 2147483647 ? "LL" : ""); });
+    writeArray(output, "std::uint16_t transitionTypes", transitionTypes, [&](std::uint16_t type) { output << type; });
+    writeArray(output, "TimeZoneDatabase::Zone zones", tables.zones, [&](const TimeZoneDatabase::Zone& zone) { output << "{ " << zone.name << ", " << zone.footer << ", " << zone.firstTransition << ", " << zone.transitionCount << ", " << zone.initialType << " }"; });
+    writeArray(output, "std::uint16_t displacements", tables.displacements, [&](std::uint16_t displacement) { output << displacement; });
+    output << "    };\n\n";
+    for (const char* declaration : { "char Tables<T>::characters", "TimeZoneDatabase::Type Tables<T>::types", "std::int64_t Tables<T>::times", "std::uint16_t Tables<T>::transitionTypes", "TimeZoneDatabase::Zone Tables<T>::zones", "std::uint16_t Tables<T>::displacements" })
+        output << "    template <typename T>\n    constexpr " << declaration << "[];\n";
+    output << "\n    /**\n"
+              "     * Returns the database of the time zones ";
+    for (size_t i = 0; i < inputs.size(); ++i)
+        output << (i == 0 ? "" : i + 1 == inputs.size() ? ", and " : ", ") << '"' << inputs[i].name << '"';
+    output << ", from the version " << tables.version << " of the IANA time zone database.\n"
+                                                        "     * @see TimeZone::fromDatabase()\n"
+                                                        "     */\n"
+                                                        "    inline const TimeZoneDatabase& database()\n"
+                                                        "    {\n"
+                                                        "        static constexpr TimeZoneDatabase value = { "
+           << quote(tables.version) << ", Tables<>::characters, Tables<>::types, Tables<>::times, Tables<>::transitionTypes, Tables<>::zones, "
+           << tables.database.zoneCount << ", Tables<>::displacements, " << tables.database.bucketCount << " };\n"
+                                                                                                              "        return value;\n"
+                                                                                                              "    }\n\n"
+                                                                                                              "} // namespace tzdb\n\n"
+                                                                                                              "} // namespace xclox\n\n"
+                                                                                                              "#endif // XCLOX_TZDB_HPP\n";
+    return output.good();
+}
+
+} // namespace
+
+int main(int argc, char** argv)
+{
+    if (argc < 4) {
+        std::fprintf(stderr, "usage: %s <directory> <output> <zone>...\n", argv[0]);
+        return 2;
+    }
+    const std::string directory = argv[1];
+    std::vector<Input> inputs;
+    for (int i = 3; i < argc; ++i) {
+        Input input;
+        input.name = argv[i];
+        if (!readFile(directory + '/' + input.name, input.data) || !input.file.parse(input.data.data(), input.data.size()) || !TimeZone::fromTzif(input.data.data(), input.data.size()).isValid()) {
+            std::fprintf(stderr, "%s: cannot read the time zone %s\n", argv[0], argv[i]);
+            return 1;
+        }
+        inputs.push_back(input);
+    }
+
+    Tables tables;
+    tables.version = "unknown";
+    std::ifstream source(directory + "/tzdata.zi");
+    std::string line;
+    if (std::getline(source, line) && line.compare(0, 10, "# version ") == 0)
+        tables.version = line.substr(10);
+
+    // A zone whose transitions are not reproduced by its footer as the trimming assumes keeps all of them.
+    std::set<std::string> untrimmed;
+    for (;;) {
+        if (!build(inputs, untrimmed, tables)) {
+            std::fprintf(stderr, "%s: cannot build a perfect hash of the names\n", argv[0]);
+            return 1;
+        }
+        size_t failures = 0;
+        for (const Input& input : inputs) {
+            if (!verify(input, tables.database)) {
+                if (untrimmed.count(input.name)) {
+                    std::fprintf(stderr, "%s: the time zone %s cannot be embedded\n", argv[0], input.name.c_str());
+                    return 1;
+                }
+                untrimmed.insert(input.name);
+                ++failures;
+            }
+        }
+        if (failures == 0)
+            break;
+    }
+    if (!write(argv[2], tables, inputs)) {
+        std::fprintf(stderr, "%s: cannot write %s\n", argv[0], argv[2]);
+        return 1;
+    }
+    std::printf("%s: %zu time zones (%zu untrimmed), %zu types, %zu transitions, %zu characters\n", argv[2], inputs.size(), untrimmed.size(), tables.types.size(), tables.times.size(), tables.characters.size());
+    return 0;
+}